@@ -0,0 +1,161 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+#pragma once
+
+/* ************************************************************************* */
+
+// C++
+#include <cstddef>
+#include <new>
+#include <utility>
+
+// Shard
+#include "shard/UniquePtr.hpp"
+#include "shard/Vector.hpp"
+
+/* ************************************************************************* */
+
+namespace shard {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Bump allocator.
+ *
+ * @details    Memory is taken from large blocks by advancing a pointer and is
+ *             released all at once when the arena is destroyed. Destructors
+ *             of created objects are not called by the arena.
+ */
+class Arena
+{
+public:
+    // Ctors & Dtors
+
+    /**
+     * @brief      Constructor.
+     *
+     * @param      blockSize  Size of allocated memory blocks.
+     */
+    explicit Arena(std::size_t blockSize = 64 * 1024) noexcept
+        : m_blockSize(blockSize)
+    {
+        // Nothing to do
+    }
+
+    Arena(const Arena&) = delete;
+
+    /**
+     * @brief      Move constructor.
+     *
+     * @param      rhs   The source arena, left empty.
+     */
+    Arena(Arena&& rhs) noexcept
+        : m_blockSize(rhs.m_blockSize)
+        , m_blocks(std::move(rhs.m_blocks))
+        , m_current(std::exchange(rhs.m_current, nullptr))
+        , m_end(std::exchange(rhs.m_end, nullptr))
+    {
+        rhs.m_blocks.clear();
+    }
+
+public:
+    // Operators
+
+    Arena& operator=(const Arena&) = delete;
+
+    /**
+     * @brief      Move assignment, releases own blocks.
+     *
+     * @param      rhs   The source arena, left empty.
+     *
+     * @return     *this.
+     */
+    Arena& operator=(Arena&& rhs) noexcept
+    {
+        m_blockSize = rhs.m_blockSize;
+        m_blocks    = std::move(rhs.m_blocks);
+        m_current   = std::exchange(rhs.m_current, nullptr);
+        m_end       = std::exchange(rhs.m_end, nullptr);
+        rhs.m_blocks.clear();
+
+        return *this;
+    }
+
+public:
+    // Accessors & Mutators
+
+    /**
+     * @brief      Returns number of allocated blocks.
+     *
+     * @return     The number of blocks.
+     */
+    std::size_t blockCount() const noexcept
+    {
+        return m_blocks.size();
+    }
+
+public:
+    // Operations
+
+    /**
+     * @brief      Allocates memory.
+     *
+     * @param      size       The size in bytes.
+     * @param      alignment  The alignment, power of two.
+     *
+     * @return     Pointer to memory valid until arena is destroyed.
+     */
+    void* allocate(std::size_t size, std::size_t alignment);
+
+    /**
+     * @brief      Creates object in the arena.
+     *
+     * @param      args  The construction arguments.
+     *
+     * @tparam     T     Created type.
+     * @tparam     Args  Argument types.
+     *
+     * @return     The created object.
+     */
+    template<typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+        return new (allocate(sizeof(T), alignof(T)))
+            T(std::forward<Args>(args)...);
+    }
+
+private:
+    // Data Members
+
+    /// Size of regular blocks.
+    std::size_t m_blockSize;
+
+    /// Allocated blocks.
+    Vector<UniquePtr<std::max_align_t[]>> m_blocks;
+
+    /// Free memory in the last block.
+    char* m_current = nullptr;
+
+    /// End of the last block.
+    char* m_end = nullptr;
+};
+
+/* ************************************************************************* */
+
+} // namespace shard
+
+/* ************************************************************************* */
@@ -0,0 +1,60 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+#pragma once
+
+/* ************************************************************************* */
+
+// C++
+#include <iosfwd>
+
+// Shard
+#include "shard/FilePath.hpp"
+#include "shard/Optional.hpp"
+#include "shard/String.hpp"
+
+/* ************************************************************************* */
+
+namespace shard {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Reads whole file into string.
+ *
+ * @details    The file size is queried first and the content is read by
+ *             large block reads directly into the result.
+ *
+ * @param      path  The file path.
+ *
+ * @return     The file content or nullopt if file cannot be read.
+ */
+Optional<String> readFile(const FilePath& path);
+
+/**
+ * @brief      Reads whole stream into string.
+ *
+ * @param      input  The input stream.
+ *
+ * @return     The stream content.
+ */
+String readStream(std::istream& input);
+
+/* ************************************************************************* */
+
+} // namespace shard
+
+/* ************************************************************************* */
@@ -0,0 +1,269 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+#pragma once
+
+/* ************************************************************************* */
+
+// C++
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+// Shard
+#include "shard/Assert.hpp"
+#include "shard/Vector.hpp"
+
+/* ************************************************************************* */
+
+namespace shard {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Dynamic array with a gap at the edit position.
+ *
+ * @details    Elements are stored in a single array with unused slots in
+ *             the middle. Elements are inserted before the gap and erased
+ *             after it without moving the other elements, moving the gap
+ *             moves only the elements between the old and the new position.
+ *             Successive edits close to each other are cheap regardless of
+ *             the array size.
+ *
+ * @tparam     T     Element type, default constructible.
+ */
+template<typename T>
+class GapBuffer
+{
+public:
+    // Ctors & Dtors
+
+    /**
+     * @brief      Default constructor.
+     */
+    GapBuffer() = default;
+
+    /**
+     * @brief      Constructor.
+     *
+     * @param      values  The elements, the gap is at the end.
+     */
+    explicit GapBuffer(Vector<T> values) noexcept
+        : m_data(std::move(values))
+        , m_gapStart(m_data.size())
+        , m_gapEnd(m_data.size())
+    {
+        // Nothing to do
+    }
+
+public:
+    // Operators
+
+    /**
+     * @brief      Returns element at index.
+     *
+     * @param      index  The element index.
+     *
+     * @return     The element.
+     */
+    T& operator[](std::size_t index) noexcept
+    {
+        return m_data[physical(index)];
+    }
+
+    /**
+     * @brief      Returns element at index.
+     *
+     * @param      index  The element index.
+     *
+     * @return     The element.
+     */
+    const T& operator[](std::size_t index) const noexcept
+    {
+        return m_data[physical(index)];
+    }
+
+public:
+    // Accessors & Mutators
+
+    /**
+     * @brief      Returns number of elements.
+     *
+     * @return     The number of elements.
+     */
+    std::size_t size() const noexcept
+    {
+        return m_data.size() - (m_gapEnd - m_gapStart);
+    }
+
+    /**
+     * @brief      Check if buffer is empty.
+     *
+     * @return     True if empty.
+     */
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    /**
+     * @brief      Returns position of the gap.
+     *
+     * @return     Index of the first element after the gap or `size()`.
+     */
+    std::size_t gap() const noexcept
+    {
+        return m_gapStart;
+    }
+
+public:
+    // Operations
+
+    /**
+     * @brief      Reserve space for elements.
+     *
+     * @param      size  The number of elements.
+     */
+    void reserve(std::size_t size)
+    {
+        if (size > m_data.size())
+            grow(size - this->size());
+    }
+
+    /**
+     * @brief      Append element, the gap is moved to the end.
+     *
+     * @param      value  The element.
+     */
+    void push(T value)
+    {
+        moveGap(size());
+        insert(std::move(value));
+    }
+
+    /**
+     * @brief      Moves the gap before element.
+     *
+     * @details    Moved elements are transformed, it allows the elements
+     *             before and after the gap to be stored differently. The
+     *             function is applied in both directions.
+     *
+     * @param      position  The element index.
+     * @param      fn        The transform function.
+     *
+     * @tparam     Fn        The transform function type.
+     */
+    template<typename Fn>
+    void moveGap(std::size_t position, Fn fn)
+    {
+        SHARD_ASSERT(position <= size());
+
+        while (m_gapStart > position)
+            m_data[--m_gapEnd] = fn(std::move(m_data[--m_gapStart]));
+
+        while (m_gapStart < position)
+            m_data[m_gapStart++] = fn(std::move(m_data[m_gapEnd++]));
+    }
+
+    /**
+     * @brief      Moves the gap before element.
+     *
+     * @param      position  The element index.
+     */
+    void moveGap(std::size_t position)
+    {
+        moveGap(position, [](T&& value) { return std::move(value); });
+    }
+
+    /**
+     * @brief      Erase elements following the gap.
+     *
+     * @param      count  The number of elements.
+     */
+    void erase(std::size_t count) noexcept
+    {
+        SHARD_ASSERT(m_gapEnd + count <= m_data.size());
+        m_gapEnd += count;
+    }
+
+    /**
+     * @brief      Insert element before the gap.
+     *
+     * @param      value  The element.
+     */
+    void insert(T value)
+    {
+        if (m_gapStart == m_gapEnd)
+            grow(1);
+
+        m_data[m_gapStart++] = std::move(value);
+    }
+
+private:
+    // Operations
+
+    /**
+     * @brief      Returns storage index of element.
+     *
+     * @param      index  The element index.
+     *
+     * @return     The storage index.
+     */
+    std::size_t physical(std::size_t index) const noexcept
+    {
+        return index < m_gapStart ? index : index + (m_gapEnd - m_gapStart);
+    }
+
+    /**
+     * @brief      Enlarge the gap.
+     *
+     * @details    The gap grows with the buffer so appending and inserting
+     *             at one position is amortized constant.
+     *
+     * @param      count  The minimum size of the gap.
+     */
+    void grow(std::size_t count)
+    {
+        const auto gap  = std::max(count, size() / 2 + 8);
+        const auto tail = m_data.size() - m_gapEnd;
+
+        Vector<T> data(size() + gap);
+        std::move(
+            m_data.begin(), m_data.begin() + m_gapStart, data.begin());
+        std::move(m_data.begin() + m_gapEnd, m_data.end(), data.end() - tail);
+
+        m_data   = std::move(data);
+        m_gapEnd = m_data.size() - tail;
+    }
+
+private:
+    // Data Members
+
+    /// Elements with the gap.
+    Vector<T> m_data;
+
+    /// Index of the first unused slot.
+    std::size_t m_gapStart = 0;
+
+    /// Index after the last unused slot.
+    std::size_t m_gapEnd = 0;
+};
+
+/* ************************************************************************* */
+
+} // namespace shard
+
+/* ************************************************************************* */
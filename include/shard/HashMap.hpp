@@ -32,9 +32,15 @@ namespace shard {
  *
  * @tparam     Key        Key type.
  * @tparam     T          Value type.
+ * @tparam     Hash       Key hash function.
+ * @tparam     KeyEqual   Key comparison function.
  */
-template<typename Key, typename T>
-using HashMap = std::unordered_map<Key, T>;
+template<
+    typename Key,
+    typename T,
+    typename Hash     = std::hash<Key>,
+    typename KeyEqual = std::equal_to<Key>>
+using HashMap = std::unordered_map<Key, T, Hash, KeyEqual>;
 
 /* ************************************************************************* */
 
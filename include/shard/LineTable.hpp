@@ -0,0 +1,156 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+#pragma once
+
+/* ************************************************************************* */
+
+// C++
+#include <cstdint>
+
+// Shard
+#include "shard/GapBuffer.hpp"
+#include "shard/SourceLocation.hpp"
+#include "shard/StringView.hpp"
+
+/* ************************************************************************* */
+
+namespace shard {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Maps source byte offsets to line and column numbers.
+ *
+ * @details    Tokens and AST nodes store only byte offsets, the line table
+ *             is consulted when a location is reported to the user. Line
+ *             starts are kept in a gap buffer like tokens, starts after the
+ *             gap are distances from a common end offset so a replacement
+ *             doesn't shift the following lines one by one.
+ */
+class LineTable
+{
+public:
+    // Ctors & Dtors
+
+    /**
+     * @brief      Default constructor.
+     */
+    LineTable() = default;
+
+    /**
+     * @brief      Constructor.
+     *
+     * @param      text  The source text with `\n` line endings.
+     */
+    explicit LineTable(StringView text);
+
+public:
+    // Accessors & Mutators
+
+    /**
+     * @brief      Returns number of lines.
+     *
+     * @return     The number of lines.
+     */
+    std::size_t size() const noexcept
+    {
+        return m_lines.size();
+    }
+
+    /**
+     * @brief      Returns offset of the first character of given line.
+     *
+     * @param      line  The line index (zero based).
+     *
+     * @return     The offset.
+     */
+    std::uint32_t lineStart(std::size_t line) const noexcept
+    {
+        const auto start = m_lines[line];
+        return line < m_lines.gap() ? start : m_end - start;
+    }
+
+public:
+    // Operations
+
+    /**
+     * @brief      Records line starts of text appended to the source.
+     *
+     * @details    Newlines are found by memchr. Large text is split into
+     *             parts scanned by separate threads and merged in order.
+     *
+     * @param      text    The appended text with `\n` line endings.
+     * @param      offset  Offset of the text in the source.
+     */
+    void append(StringView text, std::uint32_t offset);
+
+    /**
+     * @brief      Updates line starts after source text replacement.
+     *
+     * @details    Line starts inside replaced text are dropped, the following
+     *             ones are shifted at once and new text is scanned for line
+     *             starts.
+     *
+     * @param      offset  Offset of the replaced text.
+     * @param      length  Length of the replaced text.
+     * @param      text    The new text.
+     */
+    void replace(std::uint32_t offset, std::uint32_t length, StringView text);
+
+    /**
+     * @brief      Returns source location for given offset.
+     *
+     * @param      offset  The byte offset.
+     *
+     * @return     The source location.
+     */
+    SourceLocation location(std::uint32_t offset) const noexcept;
+
+private:
+    // Operations
+
+    /**
+     * @brief      Finds first line starting after offset.
+     *
+     * @param      offset  The byte offset.
+     *
+     * @return     The line index or `size()`.
+     */
+    std::size_t upperBound(std::uint32_t offset) const noexcept;
+
+    /**
+     * @brief      Moves the gap before line.
+     *
+     * @param      line  The line index.
+     */
+    void moveGap(std::size_t line);
+
+private:
+    // Data Members
+
+    /// Offsets where lines start, distances from `m_end` after the gap.
+    GapBuffer<std::uint32_t> m_lines{Vector<std::uint32_t>{0}};
+
+    /// Offset the distances after the gap are measured from.
+    std::uint32_t m_end = 0;
+};
+
+/* ************************************************************************* */
+
+} // namespace shard
+
+/* ************************************************************************* */
@@ -19,6 +19,7 @@
 /* ************************************************************************* */
 
 // C++
+#include <functional>
 #include <map>
 
 /* ************************************************************************* */
@@ -30,11 +31,12 @@ namespace shard {
 /**
  * @brief      Map type.
  *
- * @tparam     Key   Key type.
- * @tparam     T     Value type.
+ * @tparam     Key      Key type.
+ * @tparam     T        Value type.
+ * @tparam     Compare  Key comparison function.
  */
-template<typename Key, typename T>
-using Map = std::map<Key, T>;
+template<typename Key, typename T, typename Compare = std::less<Key>>
+using Map = std::map<Key, T, Compare>;
 
 /* ************************************************************************* */
 
@@ -19,6 +19,7 @@
 /* ************************************************************************* */
 
 // C++
+#include <functional>
 #include <set>
 
 /* ************************************************************************* */
@@ -30,10 +31,11 @@ namespace shard {
 /**
  * @brief      Set type.
  *
- * @tparam     Key   Key type.
+ * @tparam     Key      Key type.
+ * @tparam     Compare  Key comparison function.
  */
-template<typename T>
-using Set = std::set<T>;
+template<typename T, typename Compare = std::less<T>>
+using Set = std::set<T, Compare>;
 
 /* ************************************************************************* */
 
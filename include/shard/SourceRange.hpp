@@ -18,8 +18,8 @@
 
 /* ************************************************************************* */
 
-// Shard
-#include "shard/SourceLocation.hpp"
+// C++
+#include <cstdint>
 
 /* ************************************************************************* */
 
@@ -28,7 +28,10 @@ namespace shard {
 /* ************************************************************************* */
 
 /**
- * @brief      Range of source code locations.
+ * @brief      Range of source code byte offsets.
+ *
+ * @details    Line and column numbers are not stored, they can be resolved
+ *             on demand by `LineTable`.
  */
 class SourceRange
 {
@@ -44,10 +47,10 @@ public:
     /**
      * @brief      Constructor.
      *
-     * @param      start  Start location.
-     * @param      end    End location.
+     * @param      start  Start offset.
+     * @param      end    End offset (past the last character).
      */
-    constexpr SourceRange(SourceLocation start, SourceLocation end) noexcept
+    constexpr SourceRange(std::uint32_t start, std::uint32_t end) noexcept
         : m_start(start)
         , m_end(end)
     {
@@ -58,41 +61,21 @@ public:
     // Accessors & Mutators
 
     /**
-     * @brief      Returns start location.
+     * @brief      Returns start offset.
      *
-     * @return     Start location.
+     * @return     Start offset.
      */
-    [[deprecated]] const SourceLocation& getStart() const noexcept
+    constexpr std::uint32_t start() const noexcept
     {
         return m_start;
     }
 
     /**
-     * @brief      Returns start location.
+     * @brief      Returns end offset.
      *
-     * @return     Start location.
+     * @return     End offset.
      */
-    constexpr const SourceLocation& start() const noexcept
-    {
-        return m_start;
-    }
-
-    /**
-     * @brief      Returns end location
-     *
-     * @return     End location.
-     */
-    [[deprecated]] const SourceLocation& getEnd() const noexcept
-    {
-        return m_end;
-    }
-
-    /**
-     * @brief      Returns end location
-     *
-     * @return     End location.
-     */
-    constexpr const SourceLocation& end() const noexcept
+    constexpr std::uint32_t end() const noexcept
     {
         return m_end;
     }
@@ -100,11 +83,11 @@ public:
 private:
     // Data Members
 
-    /// Start location.
-    SourceLocation m_start;
+    /// Start offset.
+    std::uint32_t m_start = 0;
 
-    /// End location.
-    SourceLocation m_end;
+    /// End offset.
+    std::uint32_t m_end = 0;
 };
 
 /* ************************************************************************* */
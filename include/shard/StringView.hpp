@@ -19,7 +19,7 @@
 /* ************************************************************************* */
 
 // C++
-#include <experimental/string_view>
+#include <string_view>
 
 /* ************************************************************************* */
 
@@ -30,7 +30,7 @@ namespace shard {
 /**
  * @brief      String view type.
  */
-using StringView = std::experimental::string_view;
+using StringView = std::string_view;
 
 /* ************************************************************************* */
 
@@ -0,0 +1,302 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+#pragma once
+
+/* ************************************************************************* */
+
+// C++
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <utility>
+
+// Shard
+#include "shard/String.hpp"
+#include "shard/StringView.hpp"
+
+/* ************************************************************************* */
+
+namespace shard {
+
+/* ************************************************************************* */
+
+namespace detail {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Interned string entry.
+ */
+struct SymbolEntry
+{
+    /// Symbol identifier.
+    std::uint32_t id;
+
+    /// Symbol name.
+    String name;
+};
+
+/* ************************************************************************* */
+
+} // namespace detail
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Interned identifier.
+ *
+ * @details    Names are stored once in a global interner, a symbol is a
+ *             pointer to the entry. Symbols of the same name are equal and
+ *             compared as integers. Ids are dense, starting from 1, the empty
+ *             symbol has id 0. Interning is thread safe and entries are
+ *             never freed.
+ */
+class Symbol
+{
+public:
+    // Ctors & Dtors
+
+    /**
+     * @brief      Constructs the empty symbol.
+     */
+    constexpr Symbol() noexcept = default;
+
+    /**
+     * @brief      Interns a name.
+     *
+     * @param      name  The name.
+     */
+    Symbol(StringView name);
+
+    /**
+     * @brief      Interns a name.
+     *
+     * @param      name  The name.
+     */
+    Symbol(const String& name)
+        : Symbol(StringView(name))
+    {
+        // Nothing to do
+    }
+
+    /**
+     * @brief      Interns a name.
+     *
+     * @param      name  The name.
+     */
+    Symbol(const char* name)
+        : Symbol(StringView(name))
+    {
+        // Nothing to do
+    }
+
+public:
+    // Accessors & Mutators
+
+    /**
+     * @brief      Returns symbol identifier.
+     *
+     * @return     The identifier, 0 for the empty symbol.
+     */
+    std::uint32_t id() const noexcept
+    {
+        return m_entry ? m_entry->id : 0;
+    }
+
+    /**
+     * @brief      Returns symbol name.
+     *
+     * @return     The name.
+     */
+    const String& str() const noexcept;
+
+    /**
+     * @brief      Check if symbol is the empty symbol.
+     *
+     * @return     True if empty.
+     */
+    bool empty() const noexcept
+    {
+        return m_entry == nullptr;
+    }
+
+    /**
+     * @brief      Returns number of interned symbols.
+     *
+     * @return     The number of symbols, the empty symbol excluded.
+     */
+    static std::size_t count();
+
+public:
+    // Operators
+
+    /**
+     * @brief      Compare symbols.
+     *
+     * @param      lhs   The left symbol.
+     * @param      rhs   The right symbol.
+     *
+     * @return     If symbols are the same.
+     */
+    friend bool operator==(Symbol lhs, Symbol rhs) noexcept
+    {
+        return lhs.m_entry == rhs.m_entry;
+    }
+
+    /**
+     * @brief      Compare symbols.
+     *
+     * @param      lhs   The left symbol.
+     * @param      rhs   The right symbol.
+     *
+     * @return     If symbols differ.
+     */
+    friend bool operator!=(Symbol lhs, Symbol rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    /**
+     * @brief      Order symbols by identifier.
+     *
+     * @param      lhs   The left symbol.
+     * @param      rhs   The right symbol.
+     *
+     * @return     If left symbol was interned first.
+     */
+    friend bool operator<(Symbol lhs, Symbol rhs) noexcept
+    {
+        return lhs.id() < rhs.id();
+    }
+
+    /**
+     * @brief      Compare symbol with name without interning.
+     *
+     * @param      lhs   The symbol.
+     * @param      rhs   The name.
+     *
+     * @return     If symbol has the name.
+     */
+    friend bool operator==(Symbol lhs, StringView rhs) noexcept
+    {
+        return StringView(lhs.str()) == rhs;
+    }
+
+    /**
+     * @brief      Compare symbol with name without interning.
+     *
+     * @param      lhs   The symbol.
+     * @param      rhs   The name.
+     *
+     * @return     If symbol has the name.
+     */
+    friend bool operator==(Symbol lhs, const String& rhs) noexcept
+    {
+        return lhs.str() == rhs;
+    }
+
+    /**
+     * @brief      Compare symbol with name without interning.
+     *
+     * @param      lhs   The symbol.
+     * @param      rhs   The name.
+     *
+     * @return     If symbol has the name.
+     */
+    friend bool operator==(Symbol lhs, const char* rhs) noexcept
+    {
+        return lhs.str() == rhs;
+    }
+
+    /**
+     * @brief      Compare symbol with name without interning.
+     *
+     * @param      lhs   The name.
+     * @param      rhs   The symbol.
+     *
+     * @return     If symbol has the name.
+     */
+    template<
+        typename T,
+        typename = decltype(std::declval<Symbol>() == std::declval<T>())>
+    friend bool operator==(const T& lhs, Symbol rhs) noexcept
+    {
+        return rhs == lhs;
+    }
+
+    /**
+     * @brief      Compare symbol with name without interning.
+     *
+     * @param      lhs   The symbol.
+     * @param      rhs   The name.
+     *
+     * @return     If symbol doesn't have the name.
+     */
+    template<
+        typename T,
+        typename = decltype(std::declval<Symbol>() == std::declval<T>())>
+    friend bool operator!=(Symbol lhs, const T& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    // Data Members
+
+    /// Interned entry.
+    const detail::SymbolEntry* m_entry = nullptr;
+};
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Write symbol name to stream.
+ *
+ * @param      os      The output stream.
+ * @param      symbol  The symbol.
+ *
+ * @return     The output stream.
+ */
+std::ostream& operator<<(std::ostream& os, Symbol symbol);
+
+/* ************************************************************************* */
+
+} // namespace shard
+
+/* ************************************************************************* */
+
+namespace std {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Symbol hash, the identifier.
+ */
+template<>
+struct hash<shard::Symbol>
+{
+    std::size_t operator()(shard::Symbol symbol) const noexcept
+    {
+        return symbol.id();
+    }
+};
+
+/* ************************************************************************* */
+
+} // namespace std
+
+/* ************************************************************************* */
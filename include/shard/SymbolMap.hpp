@@ -0,0 +1,228 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+#pragma once
+
+/* ************************************************************************* */
+
+// C++
+#include <cstdint>
+#include <utility>
+
+// Shard
+#include "shard/Assert.hpp"
+#include "shard/Symbol.hpp"
+#include "shard/Vector.hpp"
+#include "shard/ViewPtr.hpp"
+
+/* ************************************************************************* */
+
+namespace shard {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Flat hash map keyed by symbol.
+ *
+ * @details    Open addressing with linear probing in a single array, the
+ *             empty symbol marks a free slot. Symbol identifiers are spread
+ *             by Fibonacci hashing. Elements cannot be erased.
+ *
+ * @tparam     T     Value type, default constructible.
+ */
+template<typename T>
+class SymbolMap
+{
+public:
+    // Accessors & Mutators
+
+    /**
+     * @brief      Returns number of elements.
+     *
+     * @return     The number of elements.
+     */
+    std::size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+    /**
+     * @brief      Check if map is empty.
+     *
+     * @return     True if empty.
+     */
+    bool empty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+public:
+    // Operations
+
+    /**
+     * @brief      Find value for symbol.
+     *
+     * @param      symbol  The symbol.
+     *
+     * @return     Pointer to value or nullptr, always nullptr for the empty
+     *             symbol.
+     */
+    ViewPtr<T> find(Symbol symbol) noexcept
+    {
+        // Empty symbol would match a free slot
+        if (m_slots.empty() || symbol.empty())
+            return nullptr;
+
+        for (auto index = slot(symbol);; index = next(index))
+        {
+            auto& entry = m_slots[index];
+
+            if (entry.first == symbol)
+                return &entry.second;
+
+            if (entry.first.empty())
+                return nullptr;
+        }
+    }
+
+    /**
+     * @brief      Find value for symbol.
+     *
+     * @param      symbol  The symbol.
+     *
+     * @return     Pointer to value or nullptr.
+     */
+    ViewPtr<const T> find(Symbol symbol) const noexcept
+    {
+        return const_cast<SymbolMap*>(this)->find(symbol).get();
+    }
+
+    /**
+     * @brief      Insert value if symbol is not present.
+     *
+     * @param      symbol  The symbol, not empty.
+     * @param      value   The value.
+     *
+     * @return     Pair of pointer to value in map and if it was inserted.
+     */
+    std::pair<ViewPtr<T>, bool> insert(Symbol symbol, T value)
+    {
+        SHARD_ASSERT(!symbol.empty());
+
+        // Keep load factor at most one half
+        if ((m_size + 1) * 2 > m_slots.size())
+            rehash(m_slots.empty() ? 8 : m_slots.size() * 2);
+
+        for (auto index = slot(symbol);; index = next(index))
+        {
+            auto& entry = m_slots[index];
+
+            if (entry.first == symbol)
+                return {&entry.second, false};
+
+            if (entry.first.empty())
+            {
+                entry.first  = symbol;
+                entry.second = std::move(value);
+                ++m_size;
+                return {&entry.second, true};
+            }
+        }
+    }
+
+    /**
+     * @brief      Remove all elements.
+     */
+    void clear() noexcept
+    {
+        m_slots.clear();
+        m_size = 0;
+    }
+
+private:
+    // Operations
+
+    /**
+     * @brief      Returns home slot of symbol.
+     *
+     * @param      symbol  The symbol.
+     *
+     * @return     The slot index.
+     */
+    std::size_t slot(Symbol symbol) const noexcept
+    {
+        const auto hash = symbol.id() * std::uint64_t(0x9E3779B97F4A7C15);
+        return static_cast<std::size_t>(hash >> m_shift);
+    }
+
+    /**
+     * @brief      Returns slot following index.
+     *
+     * @param      index  The slot index.
+     *
+     * @return     The next slot index.
+     */
+    std::size_t next(std::size_t index) const noexcept
+    {
+        return (index + 1) & (m_slots.size() - 1);
+    }
+
+    /**
+     * @brief      Change number of slots.
+     *
+     * @param      count  The number of slots, power of two.
+     */
+    void rehash(std::size_t count)
+    {
+        auto slots = std::move(m_slots);
+        m_slots    = Vector<std::pair<Symbol, T>>(count);
+
+        m_shift = 64;
+        for (auto size = count; size > 1; size >>= 1)
+            --m_shift;
+
+        for (auto& entry : slots)
+        {
+            if (entry.first.empty())
+                continue;
+
+            auto index = slot(entry.first);
+
+            while (!m_slots[index].first.empty())
+                index = next(index);
+
+            m_slots[index] = std::move(entry);
+        }
+    }
+
+private:
+    // Data Members
+
+    /// Slots, empty symbol marks a free slot.
+    Vector<std::pair<Symbol, T>> m_slots;
+
+    /// Number of elements.
+    std::size_t m_size = 0;
+
+    /// Hash shift selecting slot bits.
+    unsigned m_shift = 64;
+};
+
+/* ************************************************************************* */
+
+} // namespace shard
+
+/* ************************************************************************* */
@@ -0,0 +1,209 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+#pragma once
+
+/* ************************************************************************* */
+
+// C++
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+// Shard
+#include "shard/Vector.hpp"
+
+/* ************************************************************************* */
+
+namespace shard {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Persistent pool of worker threads.
+ *
+ * @details    Workers are started on the first batch which has more than one
+ *             item and then wait for next batches, so repeated batches don't
+ *             pay for thread creation. Workers take next index from a shared
+ *             counter, so one large item doesn't hold back items assigned to
+ *             the same worker. The calling thread works too. Only one batch
+ *             runs at a time and batches cannot be nested.
+ */
+class ThreadPool
+{
+public:
+    // Ctors & Dtors
+
+    /**
+     * @brief      Constructor.
+     *
+     * @param      threads  Number of threads including the calling one, 0 for
+     *                      hardware concurrency.
+     */
+    explicit ThreadPool(unsigned threads = 0) noexcept;
+
+    ThreadPool(const ThreadPool&) = delete;
+
+    /**
+     * @brief      Destructor, stops workers.
+     */
+    ~ThreadPool();
+
+public:
+    // Operators
+
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+public:
+    // Accessors & Mutators
+
+    /**
+     * @brief      Returns number of threads including the calling one.
+     *
+     * @details    Worker indices passed to batch functions are lower.
+     *
+     * @return     The number of threads.
+     */
+    unsigned size() const noexcept
+    {
+        return m_size;
+    }
+
+public:
+    // Operations
+
+    /**
+     * @brief      Call function for each index.
+     *
+     * @details    The function is called with the worker index, 0 for the
+     *             calling thread, and the item index. A worker processes one
+     *             item at a time, so state indexed by worker needs no locks.
+     *
+     * @param      count  Number of items.
+     * @param      fn     The function, must not throw.
+     *
+     * @tparam     Fn     Function type.
+     */
+    template<typename Fn>
+    void parallelFor(std::size_t count, Fn fn)
+    {
+        // Single item is not worth waking workers
+        if (count <= 1 || m_size <= 1)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+                fn(0u, i);
+
+            return;
+        }
+
+        run(count, &call<Fn>, &fn);
+    }
+
+private:
+    // Types
+
+    /// Type erased batch function.
+    using Task = void (*)(void* fn, unsigned worker, std::size_t index);
+
+private:
+    // Operations
+
+    /**
+     * @brief      Calls batch function.
+     *
+     * @param      fn      The function.
+     * @param      worker  The worker index.
+     * @param      index   The item index.
+     *
+     * @tparam     Fn      Function type.
+     */
+    template<typename Fn>
+    static void call(void* fn, unsigned worker, std::size_t index)
+    {
+        (*static_cast<Fn*>(fn))(worker, index);
+    }
+
+    /**
+     * @brief      Runs batch on all threads and waits for its end.
+     *
+     * @param      count  Number of items.
+     * @param      task   The batch function.
+     * @param      fn     The function data.
+     */
+    void run(std::size_t count, Task task, void* fn);
+
+    /**
+     * @brief      Processes items of current batch.
+     *
+     * @param      worker  The worker index.
+     */
+    void work(unsigned worker) noexcept;
+
+    /**
+     * @brief      Worker thread loop.
+     *
+     * @param      worker  The worker index.
+     */
+    void loop(unsigned worker) noexcept;
+
+private:
+    // Data Members
+
+    /// Number of threads including the calling one.
+    unsigned m_size;
+
+    /// Worker threads, started by the first batch.
+    Vector<std::thread> m_threads;
+
+    /// Guards batch state.
+    std::mutex m_mutex;
+
+    /// Signals new batch or stop.
+    std::condition_variable m_wake;
+
+    /// Signals finished workers.
+    std::condition_variable m_done;
+
+    /// Current batch function.
+    Task m_task = nullptr;
+
+    /// Current batch function data.
+    void* m_fn = nullptr;
+
+    /// Number of items in current batch.
+    std::size_t m_count = 0;
+
+    /// Next item index.
+    std::atomic<std::size_t> m_next{0};
+
+    /// Batch counter, workers wait for its change.
+    std::uint64_t m_batch = 0;
+
+    /// Number of workers processing current batch.
+    unsigned m_running = 0;
+
+    /// If workers should exit.
+    bool m_stop = false;
+};
+
+/* ************************************************************************* */
+
+} // namespace shard
+
+/* ************************************************************************* */
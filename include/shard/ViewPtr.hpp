@@ -19,6 +19,8 @@
 /* ************************************************************************* */
 
 // C++
+#include <cstddef>
+#include <functional>
 #include <type_traits>
 #include <utility>
 
@@ -359,3 +361,27 @@ bool operator>=(ViewPtr<T> lhs, ViewPtr<U> rhs) noexcept
 } // namespace shard
 
 /* ************************************************************************* */
+
+namespace std {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Hash support for view pointers.
+ *
+ * @tparam     T     The pointee type.
+ */
+template<typename T>
+struct hash<shard::ViewPtr<T>>
+{
+    size_t operator()(shard::ViewPtr<T> ptr) const noexcept
+    {
+        return hash<T*>{}(ptr.get());
+    }
+};
+
+/* ************************************************************************* */
+
+} // namespace std
+
+/* ************************************************************************* */
@@ -0,0 +1,682 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+#pragma once
+
+/* ************************************************************************* */
+
+// C++
+#include <type_traits>
+
+// Shard
+#include "shard/ast/Decls.hpp"
+#include "shard/ast/Exprs.hpp"
+#include "shard/ast/Node.hpp"
+#include "shard/ast/Stmts.hpp"
+#include "shard/ast/visit.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::ast {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Statically dispatched AST visitor.
+ *
+ * @details    The derived class hides `visit*` functions for the nodes it is
+ *             interested in. `visit` selects the final node type with
+ *             `ast::visit` and calls the derived function directly, without
+ *             a virtual call. Functions which are not hidden forward to the
+ *             function of the base node type, ending in `visitNode` which
+ *             returns a default constructed result.
+ *
+ * @tparam     Derived  The derived visitor class.
+ * @tparam     Result   The visit result type.
+ * @tparam     Const    If nodes are visited as constant.
+ */
+template<typename Derived, typename Result = void, bool Const = false>
+class ASTVisitor
+{
+public:
+    // Types
+
+    /// Reference to visited node.
+    template<typename T>
+    using Ref = std::conditional_t<Const, const T&, T&>;
+
+public:
+    // Operations
+
+    /**
+     * @brief      Visits node by its final type.
+     *
+     * @param      node  The node.
+     *
+     * @return     Visit result.
+     */
+    Result visit(Ref<Node> node)
+    {
+        return ast::visit(node, [this](auto& typed) -> Result {
+            return dispatch(typed);
+        });
+    }
+
+    /**
+     * @brief      Visits any node.
+     *
+     * @param      node  The node.
+     *
+     * @return     Default constructed result.
+     */
+    Result visitNode([[maybe_unused]] Ref<Node> node)
+    {
+        return Result();
+    }
+
+    /**
+     * @brief      Visits declaration.
+     *
+     * @details    Calls `visitNode` by default.
+     *
+     * @param      decl  The declaration.
+     *
+     * @return     Visit result.
+     */
+    Result visitDecl(Ref<Decl> decl)
+    {
+        return derived().visitNode(decl);
+    }
+
+    /**
+     * @brief      Visits compound declaration.
+     *
+     * @details    Calls `visitDecl` by default.
+     *
+     * @param      decl  The compound declaration.
+     *
+     * @return     Visit result.
+     */
+    Result visitCompoundDecl(Ref<CompoundDecl> decl)
+    {
+        return derived().visitDecl(decl);
+    }
+
+    /**
+     * @brief      Visits statement.
+     *
+     * @details    Calls `visitNode` by default.
+     *
+     * @param      stmt  The statement.
+     *
+     * @return     Visit result.
+     */
+    Result visitStmt(Ref<Stmt> stmt)
+    {
+        return derived().visitNode(stmt);
+    }
+
+    /**
+     * @brief      Visits expression.
+     *
+     * @details    Calls `visitNode` by default.
+     *
+     * @param      expr  The expression.
+     *
+     * @return     Visit result.
+     */
+    Result visitExpr(Ref<Expr> expr)
+    {
+        return derived().visitNode(expr);
+    }
+
+    /**
+     * @brief      Visits unary expression.
+     *
+     * @details    Calls `visitExpr` by default.
+     *
+     * @param      expr  The unary expression.
+     *
+     * @return     Visit result.
+     */
+    Result visitUnaryExpr(Ref<UnaryExpr> expr)
+    {
+        return derived().visitExpr(expr);
+    }
+
+    /**
+     * @brief      Visits variable declaration.
+     *
+     * @details    Calls `visitDecl` by default.
+     *
+     * @param      decl  The variable declaration.
+     *
+     * @return     Visit result.
+     */
+    Result visitVariableDecl(Ref<VariableDecl> decl)
+    {
+        return derived().visitDecl(decl);
+    }
+
+    /**
+     * @brief      Visits function declaration.
+     *
+     * @details    Calls `visitDecl` by default.
+     *
+     * @param      decl  The function declaration.
+     *
+     * @return     Visit result.
+     */
+    Result visitFunctionDecl(Ref<FunctionDecl> decl)
+    {
+        return derived().visitDecl(decl);
+    }
+
+    /**
+     * @brief      Visits namespace declaration.
+     *
+     * @details    Calls `visitCompoundDecl` by default.
+     *
+     * @param      decl  The namespace declaration.
+     *
+     * @return     Visit result.
+     */
+    Result visitNamespaceDecl(Ref<NamespaceDecl> decl)
+    {
+        return derived().visitCompoundDecl(decl);
+    }
+
+    /**
+     * @brief      Visits class declaration.
+     *
+     * @details    Calls `visitCompoundDecl` by default.
+     *
+     * @param      decl  The class declaration.
+     *
+     * @return     Visit result.
+     */
+    Result visitClassDecl(Ref<ClassDecl> decl)
+    {
+        return derived().visitCompoundDecl(decl);
+    }
+
+    /**
+     * @brief      Visits break statement.
+     *
+     * @details    Calls `visitStmt` by default.
+     *
+     * @param      stmt  The break statement.
+     *
+     * @return     Visit result.
+     */
+    Result visitBreakStmt(Ref<BreakStmt> stmt)
+    {
+        return derived().visitStmt(stmt);
+    }
+
+    /**
+     * @brief      Visits compound statement.
+     *
+     * @details    Calls `visitStmt` by default.
+     *
+     * @param      stmt  The compound statement.
+     *
+     * @return     Visit result.
+     */
+    Result visitCompoundStmt(Ref<CompoundStmt> stmt)
+    {
+        return derived().visitStmt(stmt);
+    }
+
+    /**
+     * @brief      Visits continue statement.
+     *
+     * @details    Calls `visitStmt` by default.
+     *
+     * @param      stmt  The continue statement.
+     *
+     * @return     Visit result.
+     */
+    Result visitContinueStmt(Ref<ContinueStmt> stmt)
+    {
+        return derived().visitStmt(stmt);
+    }
+
+    /**
+     * @brief      Visits declaration statement.
+     *
+     * @details    Calls `visitStmt` by default.
+     *
+     * @param      stmt  The declaration statement.
+     *
+     * @return     Visit result.
+     */
+    Result visitDeclStmt(Ref<DeclStmt> stmt)
+    {
+        return derived().visitStmt(stmt);
+    }
+
+    /**
+     * @brief      Visits expression statement.
+     *
+     * @details    Calls `visitStmt` by default.
+     *
+     * @param      stmt  The expression statement.
+     *
+     * @return     Visit result.
+     */
+    Result visitExprStmt(Ref<ExprStmt> stmt)
+    {
+        return derived().visitStmt(stmt);
+    }
+
+    /**
+     * @brief      Visits if statement.
+     *
+     * @details    Calls `visitStmt` by default.
+     *
+     * @param      stmt  The if statement.
+     *
+     * @return     Visit result.
+     */
+    Result visitIfStmt(Ref<IfStmt> stmt)
+    {
+        return derived().visitStmt(stmt);
+    }
+
+    /**
+     * @brief      Visits return statement.
+     *
+     * @details    Calls `visitStmt` by default.
+     *
+     * @param      stmt  The return statement.
+     *
+     * @return     Visit result.
+     */
+    Result visitReturnStmt(Ref<ReturnStmt> stmt)
+    {
+        return derived().visitStmt(stmt);
+    }
+
+    /**
+     * @brief      Visits while statement.
+     *
+     * @details    Calls `visitStmt` by default.
+     *
+     * @param      stmt  The while statement.
+     *
+     * @return     Visit result.
+     */
+    Result visitWhileStmt(Ref<WhileStmt> stmt)
+    {
+        return derived().visitStmt(stmt);
+    }
+
+    /**
+     * @brief      Visits bool literal expression.
+     *
+     * @details    Calls `visitExpr` by default.
+     *
+     * @param      expr  The bool literal expression.
+     *
+     * @return     Visit result.
+     */
+    Result visitBoolLiteralExpr(Ref<BoolLiteralExpr> expr)
+    {
+        return derived().visitExpr(expr);
+    }
+
+    /**
+     * @brief      Visits int literal expression.
+     *
+     * @details    Calls `visitExpr` by default.
+     *
+     * @param      expr  The int literal expression.
+     *
+     * @return     Visit result.
+     */
+    Result visitIntLiteralExpr(Ref<IntLiteralExpr> expr)
+    {
+        return derived().visitExpr(expr);
+    }
+
+    /**
+     * @brief      Visits float literal expression.
+     *
+     * @details    Calls `visitExpr` by default.
+     *
+     * @param      expr  The float literal expression.
+     *
+     * @return     Visit result.
+     */
+    Result visitFloatLiteralExpr(Ref<FloatLiteralExpr> expr)
+    {
+        return derived().visitExpr(expr);
+    }
+
+    /**
+     * @brief      Visits char literal expression.
+     *
+     * @details    Calls `visitExpr` by default.
+     *
+     * @param      expr  The char literal expression.
+     *
+     * @return     Visit result.
+     */
+    Result visitCharLiteralExpr(Ref<CharLiteralExpr> expr)
+    {
+        return derived().visitExpr(expr);
+    }
+
+    /**
+     * @brief      Visits string literal expression.
+     *
+     * @details    Calls `visitExpr` by default.
+     *
+     * @param      expr  The string literal expression.
+     *
+     * @return     Visit result.
+     */
+    Result visitStringLiteralExpr(Ref<StringLiteralExpr> expr)
+    {
+        return derived().visitExpr(expr);
+    }
+
+    /**
+     * @brief      Visits null literal expression.
+     *
+     * @details    Calls `visitExpr` by default.
+     *
+     * @param      expr  The null literal expression.
+     *
+     * @return     Visit result.
+     */
+    Result visitNullLiteralExpr(Ref<NullLiteralExpr> expr)
+    {
+        return derived().visitExpr(expr);
+    }
+
+    /**
+     * @brief      Visits binary expression.
+     *
+     * @details    Calls `visitExpr` by default.
+     *
+     * @param      expr  The binary expression.
+     *
+     * @return     Visit result.
+     */
+    Result visitBinaryExpr(Ref<BinaryExpr> expr)
+    {
+        return derived().visitExpr(expr);
+    }
+
+    /**
+     * @brief      Visits prefix unary expression.
+     *
+     * @details    Calls `visitUnaryExpr` by default.
+     *
+     * @param      expr  The prefix unary expression.
+     *
+     * @return     Visit result.
+     */
+    Result visitPrefixUnaryExpr(Ref<PrefixUnaryExpr> expr)
+    {
+        return derived().visitUnaryExpr(expr);
+    }
+
+    /**
+     * @brief      Visits postfix unary expression.
+     *
+     * @details    Calls `visitUnaryExpr` by default.
+     *
+     * @param      expr  The postfix unary expression.
+     *
+     * @return     Visit result.
+     */
+    Result visitPostfixUnaryExpr(Ref<PostfixUnaryExpr> expr)
+    {
+        return derived().visitUnaryExpr(expr);
+    }
+
+    /**
+     * @brief      Visits identifier expression.
+     *
+     * @details    Calls `visitExpr` by default.
+     *
+     * @param      expr  The identifier expression.
+     *
+     * @return     Visit result.
+     */
+    Result visitIdentifierExpr(Ref<IdentifierExpr> expr)
+    {
+        return derived().visitExpr(expr);
+    }
+
+    /**
+     * @brief      Visits member access expression.
+     *
+     * @details    Calls `visitExpr` by default.
+     *
+     * @param      expr  The member access expression.
+     *
+     * @return     Visit result.
+     */
+    Result visitMemberAccessExpr(Ref<MemberAccessExpr> expr)
+    {
+        return derived().visitExpr(expr);
+    }
+
+    /**
+     * @brief      Visits function call expression.
+     *
+     * @details    Calls `visitExpr` by default.
+     *
+     * @param      expr  The function call expression.
+     *
+     * @return     Visit result.
+     */
+    Result visitFunctionCallExpr(Ref<FunctionCallExpr> expr)
+    {
+        return derived().visitExpr(expr);
+    }
+
+    /**
+     * @brief      Visits subscript expression.
+     *
+     * @details    Calls `visitExpr` by default.
+     *
+     * @param      expr  The subscript expression.
+     *
+     * @return     Visit result.
+     */
+    Result visitSubscriptExpr(Ref<SubscriptExpr> expr)
+    {
+        return derived().visitExpr(expr);
+    }
+
+    /**
+     * @brief      Visits paren expression.
+     *
+     * @details    Calls `visitExpr` by default.
+     *
+     * @param      expr  The paren expression.
+     *
+     * @return     Visit result.
+     */
+    Result visitParenExpr(Ref<ParenExpr> expr)
+    {
+        return derived().visitExpr(expr);
+    }
+
+protected:
+    // Accessors & Mutators
+
+    /**
+     * @brief      Returns the derived visitor.
+     *
+     * @return     The derived visitor.
+     */
+    Derived& derived() noexcept
+    {
+        return static_cast<Derived&>(*this);
+    }
+
+private:
+    // Operations
+
+    /// Calls the derived visit function of the final node type.
+    Result dispatch(Ref<VariableDecl> node)
+    {
+        return derived().visitVariableDecl(node);
+    }
+
+    Result dispatch(Ref<FunctionDecl> node)
+    {
+        return derived().visitFunctionDecl(node);
+    }
+
+    Result dispatch(Ref<NamespaceDecl> node)
+    {
+        return derived().visitNamespaceDecl(node);
+    }
+
+    Result dispatch(Ref<ClassDecl> node)
+    {
+        return derived().visitClassDecl(node);
+    }
+
+    Result dispatch(Ref<BreakStmt> node)
+    {
+        return derived().visitBreakStmt(node);
+    }
+
+    Result dispatch(Ref<CompoundStmt> node)
+    {
+        return derived().visitCompoundStmt(node);
+    }
+
+    Result dispatch(Ref<ContinueStmt> node)
+    {
+        return derived().visitContinueStmt(node);
+    }
+
+    Result dispatch(Ref<DeclStmt> node)
+    {
+        return derived().visitDeclStmt(node);
+    }
+
+    Result dispatch(Ref<ExprStmt> node)
+    {
+        return derived().visitExprStmt(node);
+    }
+
+    Result dispatch(Ref<IfStmt> node)
+    {
+        return derived().visitIfStmt(node);
+    }
+
+    Result dispatch(Ref<ReturnStmt> node)
+    {
+        return derived().visitReturnStmt(node);
+    }
+
+    Result dispatch(Ref<WhileStmt> node)
+    {
+        return derived().visitWhileStmt(node);
+    }
+
+    Result dispatch(Ref<BoolLiteralExpr> node)
+    {
+        return derived().visitBoolLiteralExpr(node);
+    }
+
+    Result dispatch(Ref<IntLiteralExpr> node)
+    {
+        return derived().visitIntLiteralExpr(node);
+    }
+
+    Result dispatch(Ref<FloatLiteralExpr> node)
+    {
+        return derived().visitFloatLiteralExpr(node);
+    }
+
+    Result dispatch(Ref<CharLiteralExpr> node)
+    {
+        return derived().visitCharLiteralExpr(node);
+    }
+
+    Result dispatch(Ref<StringLiteralExpr> node)
+    {
+        return derived().visitStringLiteralExpr(node);
+    }
+
+    Result dispatch(Ref<NullLiteralExpr> node)
+    {
+        return derived().visitNullLiteralExpr(node);
+    }
+
+    Result dispatch(Ref<BinaryExpr> node)
+    {
+        return derived().visitBinaryExpr(node);
+    }
+
+    Result dispatch(Ref<PrefixUnaryExpr> node)
+    {
+        return derived().visitPrefixUnaryExpr(node);
+    }
+
+    Result dispatch(Ref<PostfixUnaryExpr> node)
+    {
+        return derived().visitPostfixUnaryExpr(node);
+    }
+
+    Result dispatch(Ref<IdentifierExpr> node)
+    {
+        return derived().visitIdentifierExpr(node);
+    }
+
+    Result dispatch(Ref<MemberAccessExpr> node)
+    {
+        return derived().visitMemberAccessExpr(node);
+    }
+
+    Result dispatch(Ref<FunctionCallExpr> node)
+    {
+        return derived().visitFunctionCallExpr(node);
+    }
+
+    Result dispatch(Ref<SubscriptExpr> node)
+    {
+        return derived().visitSubscriptExpr(node);
+    }
+
+    Result dispatch(Ref<ParenExpr> node)
+    {
+        return derived().visitParenExpr(node);
+    }
+};
+
+/* ************************************************************************* */
+
+/// Visitor of constant nodes.
+template<typename Derived, typename Result = void>
+using ConstASTVisitor = ASTVisitor<Derived, Result, true>;
+
+/* ************************************************************************* */
+
+} // namespace shard::ast
+
+/* ************************************************************************* */
@@ -18,9 +18,13 @@
 
 /* ************************************************************************* */
 
+// C++
+#include <cstdint>
+
 // Shard
-#include "shard/String.hpp"
-#include "shard/Map.hpp"
+#include "shard/Symbol.hpp"
+#include "shard/SymbolMap.hpp"
+#include "shard/Vector.hpp"
 #include "shard/ViewPtr.hpp"
 
 /* ************************************************************************* */
@@ -35,48 +39,196 @@ class Decl;
 
 /**
  * @brief      Helper class for semantic analysis of the AST.
+ *
+ * @details    Visible declarations are kept in a single binding stack. Each
+ *             binding links to the previous binding of the same symbol so
+ *             the innermost declaration is found by looking up the binding
+ *             head of the symbol. Heads are kept in a map of the symbols
+ *             declared in this context, so its size doesn't depend on the
+ *             number of interned symbols. Scopes are markers into the
+ *             stack, leaving a scope pops its bindings and restores the
+ *             shadowed ones.
+ *
+ *             A context can be created on top of a read-only context with
+ *             global declarations. Names not bound locally are searched
+ *             there, so function bodies can be analysed concurrently, each
+ *             with own context sharing the globals.
  */
 class AnalysisContext
 {
+public:
+    // Types
+
+    /**
+     * @brief      Scope guard, leaves the scope when destroyed.
+     */
+    class Scope
+    {
+    public:
+        // Ctors & Dtors
+
+        /**
+         * @brief      Constructor.
+         *
+         * @param      context  The context with entered scope.
+         */
+        explicit Scope(AnalysisContext& context) noexcept
+            : m_context(context)
+        {
+            // Nothing to do
+        }
+
+        Scope(const Scope&) = delete;
+
+        /**
+         * @brief      Destructor.
+         */
+        ~Scope()
+        {
+            m_context.leaveScope();
+        }
+
+    public:
+        // Operators
+
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        // Data Members
+
+        /// The context.
+        AnalysisContext& m_context;
+    };
+
+public:
+    // Ctors & Dtors
+
+    /**
+     * @brief      Constructor.
+     *
+     * @param      globals  Optional context with global declarations, it must
+     *                      not be modified while this context is used.
+     */
+    explicit AnalysisContext(
+        ViewPtr<const AnalysisContext> globals = nullptr) noexcept
+        : m_globals(globals)
+    {
+        // Nothing to do
+    }
+
+public:
+    // Accessors & Mutators
+
+    /**
+     * @brief      Returns context with global declarations.
+     *
+     * @return     The global context or nullptr.
+     */
+    ViewPtr<const AnalysisContext> globals() const noexcept
+    {
+        return m_globals;
+    }
+
+    /**
+     * @brief      Returns context with builtin functions.
+     *
+     * @details    Builtins are provided by the interpreter, the context is
+     *             meant to be the globals of the context of source top-level
+     *             declarations.
+     *
+     * @return     The builtin context.
+     */
+    static const AnalysisContext& builtins();
+
+    /**
+     * @brief      Returns number of entered scopes.
+     *
+     * @return     The scope depth, 0 for the global scope.
+     */
+    std::size_t depth() const noexcept
+    {
+        return m_scopes.size();
+    }
+
 public:
     // Operations
 
     /**
-     * @brief      Create child context.
+     * @brief      Enter nested scope until the returned guard is destroyed.
      *
-     * @return     The context.
+     * @return     The scope guard.
      */
-    AnalysisContext push()
+    [[nodiscard]] Scope push()
     {
-        AnalysisContext context;
-        context.m_parent = this;
-        return context;
+        enterScope();
+        return Scope(*this);
     }
 
     /**
-     * @brief      Add new declaration.
+     * @brief      Enter nested scope.
+     */
+    void enterScope()
+    {
+        m_scopes.push_back(static_cast<std::uint32_t>(m_bindings.size()));
+    }
+
+    /**
+     * @brief      Leave current scope and remove its declarations.
+     *
+     * @pre        `depth() > 0`.
+     */
+    void leaveScope() noexcept;
+
+    /**
+     * @brief      Add new declaration to current scope.
      *
      * @param      decl  The declaration.
      */
     void addDecl(ViewPtr<Decl> decl);
 
     /**
-     * @brief      Try to find declaration by name.
+     * @brief      Try to find innermost declaration by name, including the
+     *             global context.
      *
      * @param      name  The name.
      *
      * @return     Declaration or nullptr.
      */
-    ViewPtr<Decl> findDecl(const String& name) const;
+    ViewPtr<Decl> findDecl(Symbol name) const noexcept;
+
+private:
+    // Types
+
+    /**
+     * @brief      Declaration visible in a scope.
+     */
+    struct Binding
+    {
+        /// Declaration name.
+        Symbol name;
+
+        /// The declaration.
+        ViewPtr<Decl> decl;
+
+        /// Index of shadowed binding plus one, 0 if none.
+        std::uint32_t previous;
+    };
 
 private:
     // Data Members
 
-    /// Parent context.
-    ViewPtr<AnalysisContext> m_parent;
+    /// Binding stack.
+    Vector<Binding> m_bindings;
+
+    /// Index of innermost binding plus one for each declared symbol, 0 if
+    /// the symbol is not bound anymore.
+    SymbolMap<std::uint32_t> m_heads;
+
+    /// Binding stack sizes at scope entries.
+    Vector<std::uint32_t> m_scopes;
 
-    /// Context declarations.
-    Map<String, ViewPtr<Decl>> m_declarations;
+    /// Context with global declarations.
+    ViewPtr<const AnalysisContext> m_globals;
 };
 
 /* ************************************************************************* */
@@ -0,0 +1,126 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+#pragma once
+
+/* ************************************************************************* */
+
+// C++
+#include <utility>
+
+// Shard
+#include "shard/Arena.hpp"
+#include "shard/Vector.hpp"
+#include "shard/ViewPtr.hpp"
+#include "shard/ast/Node.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::ast {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Owner of AST nodes.
+ *
+ * @details    Nodes are created in an arena so parsing makes a few large
+ *             allocations. Destroying the context runs node destructors in
+ *             a flat loop and releases the arena at once, trees are not
+ *             walked and nodes are not freed one by one.
+ */
+class Context
+{
+public:
+    // Ctors & Dtors
+
+    /**
+     * @brief      Default constructor.
+     */
+    Context() = default;
+
+    Context(const Context&) = delete;
+
+    /**
+     * @brief      Destructor.
+     */
+    ~Context();
+
+public:
+    // Operators
+
+    Context& operator=(const Context&) = delete;
+
+public:
+    // Accessors & Mutators
+
+    /**
+     * @brief      Returns number of owned nodes.
+     *
+     * @return     The number of nodes.
+     */
+    std::size_t size() const noexcept
+    {
+        return m_nodes.size();
+    }
+
+    /**
+     * @brief      Returns the arena.
+     *
+     * @return     The arena.
+     */
+    Arena& arena() noexcept
+    {
+        return m_arena;
+    }
+
+public:
+    // Operations
+
+    /**
+     * @brief      Creates node owned by context.
+     *
+     * @param      args  The construction arguments.
+     *
+     * @tparam     T     Node type.
+     * @tparam     Args  Argument types.
+     *
+     * @return     The node, releasing the pointer doesn't destroy it.
+     */
+    template<typename T, typename... Args>
+    NodePtr<T> make(Args&&... args)
+    {
+        T* node = m_arena.create<T>(std::forward<Args>(args)...);
+        static_cast<Node*>(node)->m_arena = true;
+        m_nodes.push_back(node);
+
+        return NodePtr<T>(node, NodeDeleter::arena());
+    }
+
+private:
+    // Data Members
+
+    /// Node memory.
+    Arena m_arena;
+
+    /// Created nodes.
+    Vector<ViewPtr<Node>> m_nodes;
+};
+
+/* ************************************************************************* */
+
+} // namespace shard::ast
+
+/* ************************************************************************* */
@@ -20,6 +20,7 @@
 
 // Shard
 #include "shard/String.hpp"
+#include "shard/Symbol.hpp"
 #include "shard/UniquePtr.hpp"
 #include "shard/Vector.hpp"
 #include "shard/ast/Node.hpp"
@@ -72,6 +73,15 @@ enum class DeclAccessSpecifier
  */
 class Decl : public Node
 {
+public:
+    // Constants
+
+    /// First kind of declaration.
+    static constexpr NodeKind firstKind = NodeKind::VariableDecl;
+
+    /// Last kind of declaration.
+    static constexpr NodeKind lastKind = NodeKind::ClassDecl;
+
 public:
     // Ctors & Dtors
 
@@ -88,7 +98,7 @@ public:
      *
      * @return     The declaration name.
      */
-    const String& name() const noexcept
+    Symbol name() const noexcept
     {
         return m_name;
     }
@@ -98,9 +108,9 @@ public:
      *
      * @return     The declaration name in local scope naming scheme.
      */
-    void setName(String name)
+    void setName(Symbol name)
     {
-        m_name = std::move(name);
+        m_name = name;
     }
 
     /**
@@ -153,9 +163,9 @@ protected:
      * @param      name   The declaration name in local scope naming scheme.
      * @param      range  The declaration location within the source.
      */
-    explicit Decl(String name, SourceRange range)
-        : Node(range)
-        , m_name(std::move(name))
+    explicit Decl(NodeKind kind, Symbol name, SourceRange range)
+        : Node(kind, range)
+        , m_name(name)
     {
         // Nothing to do
     }
@@ -164,7 +174,7 @@ private:
     // Data Members
 
     /// Declaration name.
-    String m_name;
+    Symbol m_name;
 
     /// Declaration access specifier
     DeclAccessSpecifier m_accessSpecifier = DeclAccessSpecifier::Default;
@@ -175,7 +185,7 @@ private:
 /**
  * @brief A pointer to declaration.
  */
-using DeclPtr = UniquePtr<Decl>;
+using DeclPtr = NodePtr<Decl>;
 
 /* ************************************************************************* */
 
@@ -22,8 +22,8 @@
 #include <iosfwd>
 
 // Shard
+#include "shard/LineTable.hpp"
 #include "shard/Set.hpp"
-#include "shard/SourceLocation.hpp"
 #include "shard/SourceRange.hpp"
 #include "shard/ViewPtr.hpp"
 
@@ -49,10 +49,16 @@ public:
      * @brief      Constructor.
      *
      * @param      output  The output stream.
+     * @param      lines   Optional line table for printing source ranges
+     *                     as line and column instead of offsets.
      * @param      level   The level.
      */
-    explicit DumpContext(std::ostream& output, int level = 0) noexcept
+    explicit DumpContext(
+        std::ostream& output,
+        ViewPtr<const LineTable> lines = nullptr,
+        int level                      = 0) noexcept
         : m_output(output)
+        , m_lines(lines)
         , m_level(level)
     {
         // Nothing to do
@@ -96,7 +102,7 @@ public:
      */
     DumpContext child() const noexcept
     {
-        return DumpContext{m_output, m_level + 1};
+        return DumpContext{m_output, m_lines, m_level + 1};
     }
 
     /**
@@ -139,6 +145,9 @@ private:
     /// Output stream.
     std::ostream& m_output;
 
+    /// Line table.
+    ViewPtr<const LineTable> m_lines;
+
     /// Indentation level.
     int m_level;
 };
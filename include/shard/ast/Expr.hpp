@@ -42,12 +42,21 @@ class AnalysisContext;
  *
  * @details    An instance of this class cannot be created directly a child
  *             class must be created. Type of child class can be determined from
- *             ExprKind value obtained by calling `getKind`. Kind cannot be
+ *             NodeKind value obtained by calling `kind`. Kind cannot be
  *             changed because it's bind to the child class.
  */
 class Expr : public Node
 {
 
+public:
+    // Constants
+
+    /// First kind of expression.
+    static constexpr NodeKind firstKind = NodeKind::BoolLiteralExpr;
+
+    /// Last kind of expression.
+    static constexpr NodeKind lastKind = NodeKind::ParenExpr;
+
 public:
     // Ctors & Dtors
 
@@ -85,8 +94,8 @@ protected:
      * @param      kind   Expression kind.
      * @param      range  Source range.
      */
-    explicit Expr(SourceRange range) noexcept
-        : Node(range)
+    explicit Expr(NodeKind kind, SourceRange range) noexcept
+        : Node(kind, range)
     {
         // Nothing to do
     }
@@ -142,8 +151,11 @@ protected:
      * @param      value  The literal value.
      * @param      range  Location in source.
      */
-    explicit LiteralExpr(Value value, SourceRange range = {}) noexcept
-        : Expr(range)
+    explicit LiteralExpr(
+        NodeKind kind,
+        Value value,
+        SourceRange range = {}) noexcept
+        : Expr(kind, range)
         , m_value(value)
     {
         // Nothing to do
@@ -161,7 +173,7 @@ private:
 /**
  * @brief A pointer to expression.
  */
-using ExprPtr = UniquePtr<Expr>;
+using ExprPtr = NodePtr<Expr>;
 
 /* ************************************************************************* */
 
@@ -18,10 +18,15 @@
 
 /* ************************************************************************* */
 
+// C++
+#include <memory>
+#include <type_traits>
+
 // Shard
 #include "shard/Assert.hpp"
 #include "shard/SourceLocation.hpp"
 #include "shard/SourceRange.hpp"
+#include "shard/ast/NodeKind.hpp"
 
 /* ************************************************************************* */
 
@@ -29,6 +34,40 @@ namespace shard::ast {
 
 /* ************************************************************************* */
 
+class Context;
+
+/* ************************************************************************* */
+
+namespace detail {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Tests if node type is a single kind or a range of kinds.
+ *
+ * @tparam     NODE  Node type.
+ */
+template<typename NODE, typename = void>
+struct HasTypeKind : std::false_type
+{
+    // Nothing to do
+};
+
+/* ************************************************************************* */
+
+template<typename NODE>
+struct HasTypeKind<NODE, std::void_t<decltype(NODE::typeKind)>>
+    : std::true_type
+{
+    // Nothing to do
+};
+
+/* ************************************************************************* */
+
+} // namespace detail
+
+/* ************************************************************************* */
+
 /**
  * @brief      Base class for all AST nodes.
  *
@@ -37,9 +76,28 @@ namespace shard::ast {
  */
 class Node
 {
+public:
+    // Constants
+
+    /// First kind of node.
+    static constexpr NodeKind firstKind = NodeKind::VariableDecl;
+
+    /// Last kind of node.
+    static constexpr NodeKind lastKind = NodeKind::ParenExpr;
+
 public:
     // Accessors & Mutators
 
+    /**
+     * @brief      Returns node kind.
+     *
+     * @return     The node kind.
+     */
+    constexpr NodeKind kind() const noexcept
+    {
+        return m_kind;
+    }
+
     /**
      * @brief      Returns source range.
      *
@@ -50,20 +108,48 @@ public:
         return m_sourceRange;
     }
 
+    /**
+     * @brief      If node was created in a context arena.
+     *
+     * @details    Such nodes are destroyed by the context.
+     *
+     * @return     True if node memory is owned by context.
+     */
+    bool isArenaAllocated() const noexcept
+    {
+        return m_arena;
+    }
+
 public:
     // Operations
 
     /**
      * @brief      Test if current node match required node type.
      *
+     * @details    Final node types define `typeKind` constant and are tested
+     *             by kind equality. Base types define `firstKind` and
+     *             `lastKind` constants and are tested by a single unsigned
+     *             range compare.
+     *
      * @tparam     NODE  Node type.
      *
      * @return     Returns `true` if this is `NODE`, `false` otherwise.
      */
     template<typename NODE>
-    bool is() const noexcept
+    constexpr bool is() const noexcept
     {
-        return dynamic_cast<const NODE*>(this) != nullptr;
+        if constexpr (detail::HasTypeKind<NODE>::value)
+        {
+            return m_kind == NODE::typeKind;
+        }
+        else
+        {
+            const auto first = static_cast<unsigned>(NODE::firstKind);
+            const auto last  = static_cast<unsigned>(NODE::lastKind);
+
+            // Kinds before first wrap around to large values
+            return static_cast<unsigned>(m_kind) - first <= last - first;
+        }
     }
 
     /**
@@ -104,10 +190,12 @@ protected:
     /**
      * @brief      Constructor.
      *
+     * @param      kind   Node kind.
      * @param      range  Source range.
      */
-    constexpr Node(SourceRange range) noexcept
+    constexpr Node(NodeKind kind, SourceRange range) noexcept
         : m_sourceRange(range)
+        , m_kind(kind)
     {
         // Nothing to do
     }
@@ -122,10 +210,105 @@ private:
 
     /// Source range.
     SourceRange m_sourceRange;
+
+    /// Node kind.
+    NodeKind m_kind;
+
+    /// Node is owned by context arena.
+    bool m_arena = false;
+
+    friend Context;
+};
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Deleter of node pointers.
+ *
+ * @details    Heap nodes are deleted, nodes from context arena are left to
+ *             the context so releasing a tree doesn't walk it. Ownership is
+ *             kept in the deleter, the context destroys nodes in any order
+ *             and the pointee may already be gone.
+ */
+class NodeDeleter
+{
+public:
+    // Ctors & Dtors
+
+    /**
+     * @brief      Default constructor, deleter of heap nodes.
+     */
+    constexpr NodeDeleter() noexcept = default;
+
+    /**
+     * @brief      Conversion from default deleter of heap nodes.
+     */
+    template<typename T>
+    constexpr NodeDeleter(std::default_delete<T>) noexcept
+    {
+        // Nothing to do
+    }
+
+public:
+    // Accessors & Mutators
+
+    /**
+     * @brief      Returns if deleter belongs to node from context arena.
+     *
+     * @return     If node is not deleted.
+     */
+    constexpr bool isArena() const noexcept
+    {
+        return m_arena;
+    }
+
+public:
+    // Operators
+
+    /**
+     * @brief      Release node.
+     *
+     * @param      node  The node.
+     *
+     * @tparam     T     Node type.
+     */
+    template<typename T>
+    void operator()(T* node) const noexcept
+    {
+        if (!m_arena)
+            delete node;
+    }
+
+public:
+    // Operations
+
+    /**
+     * @brief      Returns deleter of nodes from context arena.
+     *
+     * @return     The deleter.
+     */
+    static constexpr NodeDeleter arena() noexcept
+    {
+        NodeDeleter deleter;
+        deleter.m_arena = true;
+        return deleter;
+    }
+
+private:
+    // Data Members
+
+    /// If node is owned by context arena.
+    bool m_arena = false;
 };
 
 /* ************************************************************************* */
 
+/// Owning pointer to node either on heap or in context arena.
+template<typename T>
+using NodePtr = std::unique_ptr<T, NodeDeleter>;
+
+/* ************************************************************************* */
+
 } // namespace shard::ast
 
 /* ************************************************************************* */
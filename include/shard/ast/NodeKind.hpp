@@ -0,0 +1,79 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+#pragma once
+
+/* ************************************************************************* */
+
+// C++
+#include <cstdint>
+
+/* ************************************************************************* */
+
+namespace shard::ast {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Kind of AST node.
+ *
+ * @details    Kinds of one base class are kept together so testing for the
+ *             base class is a range check (see `Node::is`). Order of the
+ *             groups must match `firstKind` and `lastKind` constants of the
+ *             base classes.
+ */
+enum class NodeKind : std::uint8_t
+{
+    // Decl
+    VariableDecl,
+    FunctionDecl,
+    // CompoundDecl
+    NamespaceDecl,
+    ClassDecl,
+
+    // Stmt
+    BreakStmt,
+    CompoundStmt,
+    ContinueStmt,
+    DeclStmt,
+    ExprStmt,
+    IfStmt,
+    ReturnStmt,
+    WhileStmt,
+
+    // Expr
+    BoolLiteralExpr,
+    IntLiteralExpr,
+    FloatLiteralExpr,
+    CharLiteralExpr,
+    StringLiteralExpr,
+    NullLiteralExpr,
+    BinaryExpr,
+    // UnaryExpr
+    PrefixUnaryExpr,
+    PostfixUnaryExpr,
+    IdentifierExpr,
+    MemberAccessExpr,
+    FunctionCallExpr,
+    SubscriptExpr,
+    ParenExpr,
+};
+
+/* ************************************************************************* */
+
+} // namespace shard::ast
+
+/* ************************************************************************* */
@@ -0,0 +1,678 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+#pragma once
+
+/* ************************************************************************* */
+
+// Shard
+#include "shard/Vector.hpp"
+#include "shard/ast/ASTVisitor.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::ast {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Statically dispatched recursive AST visitor.
+ *
+ * @details    `traverse` walks a tree and calls `visit*` functions of the
+ *             derived class for every node, parents before children or, when
+ *             `shouldTraversePostOrder` returns `true`, children before
+ *             parents. Returning `false` from a visit function stops the
+ *             whole traversal. Hiding a `traverse*` function changes how the
+ *             children of that node type are walked, e.g. skips them.
+ *
+ * @tparam     Derived  The derived visitor class.
+ * @tparam     Const    If nodes are visited as constant.
+ */
+template<typename Derived, bool Const = false>
+class RecursiveASTVisitor : public ASTVisitor<Derived, bool, Const>
+{
+public:
+    // Types
+
+    /// Reference to visited node.
+    template<typename T>
+    using Ref = typename ASTVisitor<Derived, bool, Const>::template Ref<T>;
+
+public:
+    // Accessors & Mutators
+
+    /**
+     * @brief      If nodes are visited after their children.
+     *
+     * @return     `false` by default, nodes are visited before children.
+     */
+    bool shouldTraversePostOrder() const noexcept
+    {
+        return false;
+    }
+
+public:
+    // Operations
+
+    /**
+     * @brief      Visits any node.
+     *
+     * @param      node  The node.
+     *
+     * @return     `true`, the traversal continues.
+     */
+    bool visitNode([[maybe_unused]] Ref<Node> node)
+    {
+        return true;
+    }
+
+    /**
+     * @brief      Traverses node and its children.
+     *
+     * @param      node  The node.
+     *
+     * @return     If traversal should continue.
+     */
+    bool traverse(Ref<Node> node)
+    {
+        return ast::visit(node, [this](auto& typed) {
+            return dispatch(typed);
+        });
+    }
+
+    /**
+     * @brief      Traverses optional node.
+     *
+     * @param      node  The node, can be null.
+     *
+     * @tparam     T     Node type.
+     *
+     * @return     If traversal should continue.
+     */
+    template<typename T>
+    bool traverse(const NodePtr<T>& node)
+    {
+        return !node || traverse(*node);
+    }
+
+    /**
+     * @brief      Traverses nodes in order.
+     *
+     * @param      nodes  The nodes, e.g. statements of a source.
+     *
+     * @tparam     T      Node type.
+     *
+     * @return     If traversal should continue.
+     */
+    template<typename T>
+    bool traverse(const Vector<NodePtr<T>>& nodes)
+    {
+        for (const auto& node : nodes)
+        {
+            if (!traverse(node))
+                return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief      Traverses variable declaration.
+     *
+     * @param      decl  The variable declaration.
+     *
+     * @return     If traversal should continue.
+     */
+    bool traverseVariableDecl(Ref<VariableDecl> decl)
+    {
+        return preVisit(decl, &Derived::visitVariableDecl) &&
+               traverse(decl.initExpr()) &&
+               postVisit(decl, &Derived::visitVariableDecl);
+    }
+
+    /**
+     * @brief      Traverses function declaration.
+     *
+     * @param      decl  The function declaration.
+     *
+     * @return     If traversal should continue.
+     */
+    bool traverseFunctionDecl(Ref<FunctionDecl> decl)
+    {
+        return preVisit(decl, &Derived::visitFunctionDecl) &&
+               traverse(decl.parameters()) &&
+               traverse(decl.bodyStmt()) &&
+               postVisit(decl, &Derived::visitFunctionDecl);
+    }
+
+    /**
+     * @brief      Traverses namespace declaration.
+     *
+     * @param      decl  The namespace declaration.
+     *
+     * @return     If traversal should continue.
+     */
+    bool traverseNamespaceDecl(Ref<NamespaceDecl> decl)
+    {
+        return preVisit(decl, &Derived::visitNamespaceDecl) &&
+               traverse(decl.decls()) &&
+               postVisit(decl, &Derived::visitNamespaceDecl);
+    }
+
+    /**
+     * @brief      Traverses class declaration.
+     *
+     * @param      decl  The class declaration.
+     *
+     * @return     If traversal should continue.
+     */
+    bool traverseClassDecl(Ref<ClassDecl> decl)
+    {
+        return preVisit(decl, &Derived::visitClassDecl) &&
+               traverse(decl.decls()) &&
+               postVisit(decl, &Derived::visitClassDecl);
+    }
+
+    /**
+     * @brief      Traverses break statement.
+     *
+     * @param      stmt  The break statement.
+     *
+     * @return     If traversal should continue.
+     */
+    bool traverseBreakStmt(Ref<BreakStmt> stmt)
+    {
+        return preVisit(stmt, &Derived::visitBreakStmt) &&
+               postVisit(stmt, &Derived::visitBreakStmt);
+    }
+
+    /**
+     * @brief      Traverses compound statement.
+     *
+     * @param      stmt  The compound statement.
+     *
+     * @return     If traversal should continue.
+     */
+    bool traverseCompoundStmt(Ref<CompoundStmt> stmt)
+    {
+        return preVisit(stmt, &Derived::visitCompoundStmt) &&
+               traverse(stmt.stmts()) &&
+               postVisit(stmt, &Derived::visitCompoundStmt);
+    }
+
+    /**
+     * @brief      Traverses continue statement.
+     *
+     * @param      stmt  The continue statement.
+     *
+     * @return     If traversal should continue.
+     */
+    bool traverseContinueStmt(Ref<ContinueStmt> stmt)
+    {
+        return preVisit(stmt, &Derived::visitContinueStmt) &&
+               postVisit(stmt, &Derived::visitContinueStmt);
+    }
+
+    /**
+     * @brief      Traverses declaration statement.
+     *
+     * @param      stmt  The declaration statement.
+     *
+     * @return     If traversal should continue.
+     */
+    bool traverseDeclStmt(Ref<DeclStmt> stmt)
+    {
+        return preVisit(stmt, &Derived::visitDeclStmt) &&
+               traverse(stmt.decl()) &&
+               postVisit(stmt, &Derived::visitDeclStmt);
+    }
+
+    /**
+     * @brief      Traverses expression statement.
+     *
+     * @param      stmt  The expression statement.
+     *
+     * @return     If traversal should continue.
+     */
+    bool traverseExprStmt(Ref<ExprStmt> stmt)
+    {
+        return preVisit(stmt, &Derived::visitExprStmt) &&
+               traverse(stmt.expr()) &&
+               postVisit(stmt, &Derived::visitExprStmt);
+    }
+
+    /**
+     * @brief      Traverses if statement.
+     *
+     * @param      stmt  The if statement.
+     *
+     * @return     If traversal should continue.
+     */
+    bool traverseIfStmt(Ref<IfStmt> stmt)
+    {
+        return preVisit(stmt, &Derived::visitIfStmt) &&
+               traverse(stmt.condExpr()) &&
+               traverse(stmt.thenStmt()) &&
+               traverse(stmt.elseStmt()) &&
+               postVisit(stmt, &Derived::visitIfStmt);
+    }
+
+    /**
+     * @brief      Traverses return statement.
+     *
+     * @param      stmt  The return statement.
+     *
+     * @return     If traversal should continue.
+     */
+    bool traverseReturnStmt(Ref<ReturnStmt> stmt)
+    {
+        return preVisit(stmt, &Derived::visitReturnStmt) &&
+               traverse(stmt.resExpr()) &&
+               postVisit(stmt, &Derived::visitReturnStmt);
+    }
+
+    /**
+     * @brief      Traverses while statement.
+     *
+     * @param      stmt  The while statement.
+     *
+     * @return     If traversal should continue.
+     */
+    bool traverseWhileStmt(Ref<WhileStmt> stmt)
+    {
+        return preVisit(stmt, &Derived::visitWhileStmt) &&
+               traverse(stmt.condExpr()) &&
+               traverse(stmt.bodyStmt()) &&
+               postVisit(stmt, &Derived::visitWhileStmt);
+    }
+
+    /**
+     * @brief      Traverses bool literal expression.
+     *
+     * @param      expr  The bool literal expression.
+     *
+     * @return     If traversal should continue.
+     */
+    bool traverseBoolLiteralExpr(Ref<BoolLiteralExpr> expr)
+    {
+        return preVisit(expr, &Derived::visitBoolLiteralExpr) &&
+               postVisit(expr, &Derived::visitBoolLiteralExpr);
+    }
+
+    /**
+     * @brief      Traverses int literal expression.
+     *
+     * @param      expr  The int literal expression.
+     *
+     * @return     If traversal should continue.
+     */
+    bool traverseIntLiteralExpr(Ref<IntLiteralExpr> expr)
+    {
+        return preVisit(expr, &Derived::visitIntLiteralExpr) &&
+               postVisit(expr, &Derived::visitIntLiteralExpr);
+    }
+
+    /**
+     * @brief      Traverses float literal expression.
+     *
+     * @param      expr  The float literal expression.
+     *
+     * @return     If traversal should continue.
+     */
+    bool traverseFloatLiteralExpr(Ref<FloatLiteralExpr> expr)
+    {
+        return preVisit(expr, &Derived::visitFloatLiteralExpr) &&
+               postVisit(expr, &Derived::visitFloatLiteralExpr);
+    }
+
+    /**
+     * @brief      Traverses char literal expression.
+     *
+     * @param      expr  The char literal expression.
+     *
+     * @return     If traversal should continue.
+     */
+    bool traverseCharLiteralExpr(Ref<CharLiteralExpr> expr)
+    {
+        return preVisit(expr, &Derived::visitCharLiteralExpr) &&
+               postVisit(expr, &Derived::visitCharLiteralExpr);
+    }
+
+    /**
+     * @brief      Traverses string literal expression.
+     *
+     * @param      expr  The string literal expression.
+     *
+     * @return     If traversal should continue.
+     */
+    bool traverseStringLiteralExpr(Ref<StringLiteralExpr> expr)
+    {
+        return preVisit(expr, &Derived::visitStringLiteralExpr) &&
+               postVisit(expr, &Derived::visitStringLiteralExpr);
+    }
+
+    /**
+     * @brief      Traverses null literal expression.
+     *
+     * @param      expr  The null literal expression.
+     *
+     * @return     If traversal should continue.
+     */
+    bool traverseNullLiteralExpr(Ref<NullLiteralExpr> expr)
+    {
+        return preVisit(expr, &Derived::visitNullLiteralExpr) &&
+               postVisit(expr, &Derived::visitNullLiteralExpr);
+    }
+
+    /**
+     * @brief      Traverses binary expression.
+     *
+     * @param      expr  The binary expression.
+     *
+     * @return     If traversal should continue.
+     */
+    bool traverseBinaryExpr(Ref<BinaryExpr> expr)
+    {
+        return preVisit(expr, &Derived::visitBinaryExpr) &&
+               traverse(expr.lhs()) &&
+               traverse(expr.rhs()) &&
+               postVisit(expr, &Derived::visitBinaryExpr);
+    }
+
+    /**
+     * @brief      Traverses prefix unary expression.
+     *
+     * @param      expr  The prefix unary expression.
+     *
+     * @return     If traversal should continue.
+     */
+    bool traversePrefixUnaryExpr(Ref<PrefixUnaryExpr> expr)
+    {
+        return preVisit(expr, &Derived::visitPrefixUnaryExpr) &&
+               traverse(expr.expr()) &&
+               postVisit(expr, &Derived::visitPrefixUnaryExpr);
+    }
+
+    /**
+     * @brief      Traverses postfix unary expression.
+     *
+     * @param      expr  The postfix unary expression.
+     *
+     * @return     If traversal should continue.
+     */
+    bool traversePostfixUnaryExpr(Ref<PostfixUnaryExpr> expr)
+    {
+        return preVisit(expr, &Derived::visitPostfixUnaryExpr) &&
+               traverse(expr.expr()) &&
+               postVisit(expr, &Derived::visitPostfixUnaryExpr);
+    }
+
+    /**
+     * @brief      Traverses identifier expression.
+     *
+     * @param      expr  The identifier expression.
+     *
+     * @return     If traversal should continue.
+     */
+    bool traverseIdentifierExpr(Ref<IdentifierExpr> expr)
+    {
+        return preVisit(expr, &Derived::visitIdentifierExpr) &&
+               postVisit(expr, &Derived::visitIdentifierExpr);
+    }
+
+    /**
+     * @brief      Traverses member access expression.
+     *
+     * @param      expr  The member access expression.
+     *
+     * @return     If traversal should continue.
+     */
+    bool traverseMemberAccessExpr(Ref<MemberAccessExpr> expr)
+    {
+        return preVisit(expr, &Derived::visitMemberAccessExpr) &&
+               traverse(expr.expr()) &&
+               postVisit(expr, &Derived::visitMemberAccessExpr);
+    }
+
+    /**
+     * @brief      Traverses function call expression.
+     *
+     * @param      expr  The function call expression.
+     *
+     * @return     If traversal should continue.
+     */
+    bool traverseFunctionCallExpr(Ref<FunctionCallExpr> expr)
+    {
+        return preVisit(expr, &Derived::visitFunctionCallExpr) &&
+               traverse(expr.expr()) &&
+               traverse(expr.args()) &&
+               postVisit(expr, &Derived::visitFunctionCallExpr);
+    }
+
+    /**
+     * @brief      Traverses subscript expression.
+     *
+     * @param      expr  The subscript expression.
+     *
+     * @return     If traversal should continue.
+     */
+    bool traverseSubscriptExpr(Ref<SubscriptExpr> expr)
+    {
+        return preVisit(expr, &Derived::visitSubscriptExpr) &&
+               traverse(expr.expr()) &&
+               traverse(expr.args()) &&
+               postVisit(expr, &Derived::visitSubscriptExpr);
+    }
+
+    /**
+     * @brief      Traverses paren expression.
+     *
+     * @param      expr  The paren expression.
+     *
+     * @return     If traversal should continue.
+     */
+    bool traverseParenExpr(Ref<ParenExpr> expr)
+    {
+        return preVisit(expr, &Derived::visitParenExpr) &&
+               traverse(expr.expr()) &&
+               postVisit(expr, &Derived::visitParenExpr);
+    }
+
+private:
+    // Operations
+
+    /**
+     * @brief      Visits node before its children.
+     *
+     * @param      node   The node.
+     * @param      visit  The visit function.
+     *
+     * @tparam     T      Node type.
+     * @tparam     Visit  Visit function type.
+     *
+     * @return     If traversal should continue.
+     */
+    template<typename T, typename Visit>
+    bool preVisit(T& node, Visit visit)
+    {
+        return this->derived().shouldTraversePostOrder() ||
+               (this->derived().*visit)(node);
+    }
+
+    /**
+     * @brief      Visits node after its children.
+     *
+     * @param      node   The node.
+     * @param      visit  The visit function.
+     *
+     * @tparam     T      Node type.
+     * @tparam     Visit  Visit function type.
+     *
+     * @return     If traversal should continue.
+     */
+    template<typename T, typename Visit>
+    bool postVisit(T& node, Visit visit)
+    {
+        return !this->derived().shouldTraversePostOrder() ||
+               (this->derived().*visit)(node);
+    }
+
+private:
+    // Operations
+
+    /// Calls the derived traverse function of the final node type.
+    bool dispatch(Ref<VariableDecl> node)
+    {
+        return this->derived().traverseVariableDecl(node);
+    }
+
+    bool dispatch(Ref<FunctionDecl> node)
+    {
+        return this->derived().traverseFunctionDecl(node);
+    }
+
+    bool dispatch(Ref<NamespaceDecl> node)
+    {
+        return this->derived().traverseNamespaceDecl(node);
+    }
+
+    bool dispatch(Ref<ClassDecl> node)
+    {
+        return this->derived().traverseClassDecl(node);
+    }
+
+    bool dispatch(Ref<BreakStmt> node)
+    {
+        return this->derived().traverseBreakStmt(node);
+    }
+
+    bool dispatch(Ref<CompoundStmt> node)
+    {
+        return this->derived().traverseCompoundStmt(node);
+    }
+
+    bool dispatch(Ref<ContinueStmt> node)
+    {
+        return this->derived().traverseContinueStmt(node);
+    }
+
+    bool dispatch(Ref<DeclStmt> node)
+    {
+        return this->derived().traverseDeclStmt(node);
+    }
+
+    bool dispatch(Ref<ExprStmt> node)
+    {
+        return this->derived().traverseExprStmt(node);
+    }
+
+    bool dispatch(Ref<IfStmt> node)
+    {
+        return this->derived().traverseIfStmt(node);
+    }
+
+    bool dispatch(Ref<ReturnStmt> node)
+    {
+        return this->derived().traverseReturnStmt(node);
+    }
+
+    bool dispatch(Ref<WhileStmt> node)
+    {
+        return this->derived().traverseWhileStmt(node);
+    }
+
+    bool dispatch(Ref<BoolLiteralExpr> node)
+    {
+        return this->derived().traverseBoolLiteralExpr(node);
+    }
+
+    bool dispatch(Ref<IntLiteralExpr> node)
+    {
+        return this->derived().traverseIntLiteralExpr(node);
+    }
+
+    bool dispatch(Ref<FloatLiteralExpr> node)
+    {
+        return this->derived().traverseFloatLiteralExpr(node);
+    }
+
+    bool dispatch(Ref<CharLiteralExpr> node)
+    {
+        return this->derived().traverseCharLiteralExpr(node);
+    }
+
+    bool dispatch(Ref<StringLiteralExpr> node)
+    {
+        return this->derived().traverseStringLiteralExpr(node);
+    }
+
+    bool dispatch(Ref<NullLiteralExpr> node)
+    {
+        return this->derived().traverseNullLiteralExpr(node);
+    }
+
+    bool dispatch(Ref<BinaryExpr> node)
+    {
+        return this->derived().traverseBinaryExpr(node);
+    }
+
+    bool dispatch(Ref<PrefixUnaryExpr> node)
+    {
+        return this->derived().traversePrefixUnaryExpr(node);
+    }
+
+    bool dispatch(Ref<PostfixUnaryExpr> node)
+    {
+        return this->derived().traversePostfixUnaryExpr(node);
+    }
+
+    bool dispatch(Ref<IdentifierExpr> node)
+    {
+        return this->derived().traverseIdentifierExpr(node);
+    }
+
+    bool dispatch(Ref<MemberAccessExpr> node)
+    {
+        return this->derived().traverseMemberAccessExpr(node);
+    }
+
+    bool dispatch(Ref<FunctionCallExpr> node)
+    {
+        return this->derived().traverseFunctionCallExpr(node);
+    }
+
+    bool dispatch(Ref<SubscriptExpr> node)
+    {
+        return this->derived().traverseSubscriptExpr(node);
+    }
+
+    bool dispatch(Ref<ParenExpr> node)
+    {
+        return this->derived().traverseParenExpr(node);
+    }
+};
+
+/* ************************************************************************* */
+
+/// Recursive visitor of constant nodes.
+template<typename Derived>
+using ConstRecursiveASTVisitor = RecursiveASTVisitor<Derived, true>;
+
+/* ************************************************************************* */
+
+} // namespace shard::ast
+
+/* ************************************************************************* */
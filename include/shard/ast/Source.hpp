@@ -22,6 +22,11 @@
 #include <iosfwd>
 
 // Shard
+#include "shard/LineTable.hpp"
+#include "shard/UniquePtr.hpp"
+#include "shard/Vector.hpp"
+#include "shard/ViewPtr.hpp"
+#include "shard/ast/Context.hpp"
 #include "shard/ast/Stmt.hpp"
 
 /* ************************************************************************* */
@@ -30,6 +35,10 @@ namespace shard::ast {
 
 /* ************************************************************************* */
 
+class FunctionDecl;
+
+/* ************************************************************************* */
+
 /**
  * @brief      The top level AST container.
  */
@@ -46,10 +55,12 @@ public:
     /**
      * @brief      Constructor.
      *
-     * @param      stmts  The statements.
+     * @param      stmts    The statements.
+     * @param      context  The context owning arena nodes.
      */
-    explicit Source(StmtPtrVector stmts)
-        : m_statements(std::move(stmts))
+    explicit Source(StmtPtrVector stmts, UniquePtr<Context> context = nullptr)
+        : m_context(std::move(context))
+        , m_statements(std::move(stmts))
     {
         // Nothing to do
     }
@@ -102,19 +113,55 @@ public:
 
     /**
      * @brief      Perform semantic analysis.
+     *
+     * @details    Top-level functions are declared first, so they can be
+     *             used before their declaration. Other top-level statements
+     *             are analysed in order, a global variable is visible only
+     *             after its declaration. Then the function bodies are
+     *             analysed concurrently, each of them seeing the globals and
+     *             its own locals. Errors of function bodies are reported in
+     *             statement order.
+     *
+     * @param      threads  Maximum number of threads, 0 for hardware
+     *                      concurrency.
+     */
+    void analyse(unsigned threads = 0);
+
+    /**
+     * @brief      Add top-level function declarations to the global context.
+     *
+     * @param      context  The global context.
      */
-    void analyse();
+    void declare(AnalysisContext& context) const;
+
+    /**
+     * @brief      Analyse top-level statements other than functions in order.
+     *
+     * @param      context  The global context.
+     */
+    void analyseGlobals(AnalysisContext& context);
+
+    /**
+     * @brief      Returns top-level function declarations.
+     *
+     * @return     The function declarations in statement order.
+     */
+    Vector<ViewPtr<FunctionDecl>> functions() const;
 
     /**
      * @brief      Dump source to stream.
      *
-     * @param      os    Output stream.
+     * @param      os     Output stream.
+     * @param      lines  Optional line table for printing locations.
      */
-    void dump(std::ostream& os) const;
+    void dump(std::ostream& os, ViewPtr<const LineTable> lines = nullptr) const;
 
 private:
     // Data Members
 
+    /// Owner of arena nodes, must outlive statements.
+    UniquePtr<Context> m_context;
+
     /// Statements
     StmtPtrVector m_statements;
 };
@@ -40,6 +40,15 @@ class AnalysisContext;
 class Stmt : public Node
 {
 
+public:
+    // Constants
+
+    /// First kind of statement.
+    static constexpr NodeKind firstKind = NodeKind::BreakStmt;
+
+    /// Last kind of statement.
+    static constexpr NodeKind lastKind = NodeKind::WhileStmt;
+
 public:
     // Ctors & Dtors
 
@@ -77,8 +86,8 @@ protected:
      * @param      kind   Statement kind.
      * @param      range  Source range.
      */
-    explicit Stmt(SourceRange range)
-        : Node(range)
+    explicit Stmt(NodeKind kind, SourceRange range)
+        : Node(kind, range)
     {
         // Nothing to do
     }
@@ -89,7 +98,7 @@ protected:
 /**
  * @brief A pointer to statement.
  */
-using StmtPtr = UniquePtr<Stmt>;
+using StmtPtr = NodePtr<Stmt>;
 
 /* ************************************************************************* */
 
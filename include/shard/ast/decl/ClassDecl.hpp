@@ -20,7 +20,7 @@
 
 // Shard
 #include "shard/PtrVector.hpp"
-#include "shard/String.hpp"
+#include "shard/Symbol.hpp"
 #include "shard/ast/decl/CompoundDecl.hpp"
 #include "shard/ast/utility.hpp"
 
@@ -34,7 +34,7 @@ class ClassDecl;
 
 /* ************************************************************************* */
 
-using ClassDeclPtr = UniquePtr<ClassDecl>;
+using ClassDeclPtr = NodePtr<ClassDecl>;
 
 /* ************************************************************************* */
 
@@ -44,9 +44,15 @@ using ClassDeclPtr = UniquePtr<ClassDecl>;
  * @details    In the source it appears as: `class <name> { <decls> }`.
  */
 class ClassDecl final : public CompoundDecl,
-                        public PtrBuilder<ClassDecl, String, DeclPtrVector>
+                        public PtrBuilder<ClassDecl, Symbol, DeclPtrVector>
 {
 
+public:
+    // Constants
+
+    /// Kind constant.
+    static constexpr NodeKind typeKind = NodeKind::ClassDecl;
+
 public:
     // Ctors & Dtors
 
@@ -58,10 +64,14 @@ public:
      * @param      range  The declaration location within the source.
      */
     explicit ClassDecl(
-        String name,
+        Symbol name,
         DeclPtrVector decls = {},
         SourceRange range   = {})
-        : CompoundDecl(std::move(name), std::move(decls), std::move(range))
+        : CompoundDecl(
+              typeKind,
+              name,
+              std::move(decls),
+              std::move(range))
     {
         // Nothing to do
     }
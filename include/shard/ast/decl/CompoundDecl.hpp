@@ -34,6 +34,15 @@ namespace shard::ast {
 class CompoundDecl : public Decl
 {
 
+public:
+    // Constants
+
+    /// First kind of compound declaration.
+    static constexpr NodeKind firstKind = NodeKind::NamespaceDecl;
+
+    /// Last kind of compound declaration.
+    static constexpr NodeKind lastKind = NodeKind::ClassDecl;
+
 public:
     // Accessors & Mutators
 
@@ -83,12 +92,17 @@ protected:
     /**
      * @brief      Constructor.
      *
+     * @param      kind   The declaration kind.
      * @param      name   The declaration name in local scope naming scheme.
      * @param      decls  The declarations.
      * @param      range  The declaration location within the source.
      */
-    CompoundDecl(String name, DeclPtrVector decls, SourceRange range)
-        : Decl(std::move(name), std::move(range))
+    CompoundDecl(
+        NodeKind kind,
+        Symbol name,
+        DeclPtrVector decls,
+        SourceRange range)
+        : Decl(kind, name, std::move(range))
         , m_declarations(std::move(decls))
     {
         // Nothing to do
@@ -19,9 +19,10 @@
 /* ************************************************************************* */
 
 // Shard
-#include "shard/PtrVector.hpp"
 #include "shard/String.hpp"
+#include "shard/Symbol.hpp"
 #include "shard/UniquePtr.hpp"
+#include "shard/Vector.hpp"
 #include "shard/ast/Decl.hpp"
 #include "shard/ast/decl/VariableDecl.hpp"
 #include "shard/ast/stmt/CompoundStmt.hpp"
@@ -48,11 +49,17 @@ class FunctionDecl final : public Decl,
                            public PtrBuilder<
                                FunctionDecl,
                                String,
-                               String,
+                               Symbol,
                                CompoundStmtPtr,
-                               PtrVector<VariableDecl>>
+                               Vector<VariableDeclPtr>>
 {
 
+public:
+    // Constants
+
+    /// Kind constant.
+    static constexpr NodeKind typeKind = NodeKind::FunctionDecl;
+
 public:
     // Ctors & Dtors
 
@@ -67,11 +74,11 @@ public:
      */
     FunctionDecl(
         String retType,
-        String name,
+        Symbol name,
         CompoundStmtPtr bodyStmt,
-        PtrVector<VariableDecl> params = {},
+        Vector<VariableDeclPtr> params = {},
         SourceRange range              = {})
-        : Decl(std::move(name), std::move(range))
+        : Decl(typeKind, name, std::move(range))
         , m_retType(std::move(retType))
         , m_parameters(std::move(params))
         , m_bodyStmt(std::move(bodyStmt))
@@ -107,7 +114,7 @@ public:
      *
      * @return     A list of function parameters.
      */
-    const PtrVector<VariableDecl>& parameters() const noexcept
+    const Vector<VariableDeclPtr>& parameters() const noexcept
     {
         return m_parameters;
     }
@@ -117,7 +124,7 @@ public:
      *
      * @param      params  The function parameters.
      */
-    void setParameters(PtrVector<VariableDecl> params)
+    void setParameters(Vector<VariableDeclPtr> params)
     {
         m_parameters = std::move(params);
     }
@@ -166,7 +173,7 @@ private:
     String m_retType;
 
     /// Function parameters.
-    PtrVector<VariableDecl> m_parameters;
+    Vector<VariableDeclPtr> m_parameters;
 
     /// Function body.
     CompoundStmtPtr m_bodyStmt;
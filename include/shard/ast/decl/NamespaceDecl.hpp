@@ -19,7 +19,7 @@
 /* ************************************************************************* */
 
 // Shard
-#include "shard/String.hpp"
+#include "shard/Symbol.hpp"
 #include "shard/ast/decl/CompoundDecl.hpp"
 #include "shard/ast/utility.hpp"
 
@@ -33,7 +33,7 @@ class NamespaceDecl;
 
 /* ************************************************************************* */
 
-using NamespaceDeclPtr = UniquePtr<NamespaceDecl>;
+using NamespaceDeclPtr = NodePtr<NamespaceDecl>;
 
 /* ************************************************************************* */
 
@@ -42,9 +42,15 @@ using NamespaceDeclPtr = UniquePtr<NamespaceDecl>;
  */
 class NamespaceDecl final
     : public CompoundDecl,
-      public PtrBuilder<NamespaceDecl, String, DeclPtrVector>
+      public PtrBuilder<NamespaceDecl, Symbol, DeclPtrVector>
 {
 
+public:
+    // Constants
+
+    /// Kind constant.
+    static constexpr NodeKind typeKind = NodeKind::NamespaceDecl;
+
     // Public Ctors & Dtors
 public:
     /**
@@ -55,10 +61,14 @@ public:
      * @param      range  The declaration location within the source.
      */
     explicit NamespaceDecl(
-        String name,
+        Symbol name,
         DeclPtrVector decls = {},
         SourceRange range   = {})
-        : CompoundDecl(std::move(name), std::move(decls), std::move(range))
+        : CompoundDecl(
+              typeKind,
+              name,
+              std::move(decls),
+              std::move(range))
     {
         // Nothing to do
     }
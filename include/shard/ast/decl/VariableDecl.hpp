@@ -20,6 +20,7 @@
 
 // Shard
 #include "shard/String.hpp"
+#include "shard/Symbol.hpp"
 #include "shard/ast/Decl.hpp"
 #include "shard/ast/Expr.hpp"
 #include "shard/ast/utility.hpp"
@@ -35,9 +36,15 @@ namespace shard::ast {
  */
 class VariableDecl final
     : public Decl,
-      public PtrBuilder<VariableDecl, String, String, ExprPtr>
+      public PtrBuilder<VariableDecl, String, Symbol, ExprPtr>
 {
 
+public:
+    // Constants
+
+    /// Kind constant.
+    static constexpr NodeKind typeKind = NodeKind::VariableDecl;
+
 public:
     // Ctors & Dtors
 
@@ -51,10 +58,10 @@ public:
      */
     explicit VariableDecl(
         String type,
-        String name,
+        Symbol name,
         ExprPtr initExpr      = nullptr,
         SourceRange range     = {})
-        : Decl(std::move(name), std::move(range))
+        : Decl(typeKind, name, std::move(range))
         , m_type(std::move(type))
         , m_initExpr(std::move(initExpr))
     {
@@ -163,6 +170,10 @@ private:
 
 /* ************************************************************************* */
 
+using VariableDeclPtr = NodePtr<VariableDecl>;
+
+/* ************************************************************************* */
+
 } // namespace shard::ast
 
 /* ************************************************************************* */
@@ -18,8 +18,12 @@
 
 /* ************************************************************************* */
 
+// C++
+#include <cstdint>
+
 // Shard
-#include "shard/exceptions.hpp"
+#include "shard/Exception.hpp"
+#include "shard/String.hpp"
 
 /* ************************************************************************* */
 
@@ -29,8 +33,11 @@ namespace shard::ast {
 
 /**
  * @brief      Semantic error.
+ *
+ * @details    AST nodes know only source offsets, the location can be
+ *             resolved by source's line table when the error is reported.
  */
-class SemanticError : public LocationError
+class SemanticError : public Exception
 {
 public:
     // Ctors & Dtors
@@ -38,14 +45,47 @@ public:
     /**
      * @brief      Constructor.
      *
-     * @param      message   The message.
-     * @param      location  The source code location.
+     * @param      message  The message.
+     * @param      offset   The source code offset.
      */
-    SemanticError(String message, SourceLocation location)
-        : LocationError(std::move(message), std::move(location))
+    SemanticError(String message, std::uint32_t offset)
+        : m_message(std::move(message))
+        , m_offset(offset)
     {
         // Nothing to do
     }
+
+public:
+    // Accessors & Mutators
+
+    /**
+     * @brief      Returns error source offset.
+     *
+     * @return     The offset.
+     */
+    std::uint32_t offset() const noexcept
+    {
+        return m_offset;
+    }
+
+    /**
+     * @brief      Returns error message.
+     *
+     * @return     The message.
+     */
+    const char* what() const noexcept
+    {
+        return m_message.c_str();
+    }
+
+private:
+    // Data Members
+
+    /// Error message.
+    String m_message;
+
+    /// Offset where the error comes from.
+    std::uint32_t m_offset;
 };
 
 /* ************************************************************************* */
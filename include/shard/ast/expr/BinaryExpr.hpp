@@ -43,6 +43,12 @@ class BinaryExpr final : public Expr,
                          public PtrBuilder<BinaryExpr, String, ExprPtr, ExprPtr>
 {
 
+public:
+    // Constants
+
+    /// Kind constant.
+    static constexpr NodeKind typeKind = NodeKind::BinaryExpr;
+
 public:
     // Ctors & Dtors
 
@@ -59,7 +65,7 @@ public:
         ExprPtr lhs,
         ExprPtr rhs,
         SourceRange range = {})
-        : Expr(range)
+        : Expr(typeKind, range)
         , m_operator(op)
         , m_lhs(std::move(lhs))
         , m_rhs(std::move(rhs))
@@ -38,6 +38,12 @@ namespace shard::ast {
 class BoolLiteralExpr final : public LiteralExpr<bool>,
                               public PtrBuilder<BoolLiteralExpr, bool>
 {
+public:
+    // Constants
+
+    /// Kind constant.
+    static constexpr NodeKind typeKind = NodeKind::BoolLiteralExpr;
+
 public:
     // Ctors & Dtors
 
@@ -48,7 +54,7 @@ public:
      * @param      range  Location in source.
      */
     explicit BoolLiteralExpr(bool value, SourceRange range = {}) noexcept
-        : LiteralExpr<bool>(value, range)
+        : LiteralExpr<bool>(typeKind, value, range)
     {
         // Nothing to do
     }
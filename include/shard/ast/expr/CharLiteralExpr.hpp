@@ -38,6 +38,12 @@ namespace shard::ast {
 class CharLiteralExpr final : public LiteralExpr<char32_t>,
                               public PtrBuilder<CharLiteralExpr, char32_t>
 {
+public:
+    // Constants
+
+    /// Kind constant.
+    static constexpr NodeKind typeKind = NodeKind::CharLiteralExpr;
+
 public:
     // Ctors & Dtors
 
@@ -48,7 +54,7 @@ public:
      * @param      range  Location in source.
      */
     explicit CharLiteralExpr(char32_t value, SourceRange range = {}) noexcept
-        : LiteralExpr<char32_t>(value, range)
+        : LiteralExpr<char32_t>(typeKind, value, range)
     {
         // Nothing to do
     }
@@ -38,6 +38,12 @@ namespace shard::ast {
 class FloatLiteralExpr final : public LiteralExpr<float>,
                                public PtrBuilder<FloatLiteralExpr, float>
 {
+public:
+    // Constants
+
+    /// Kind constant.
+    static constexpr NodeKind typeKind = NodeKind::FloatLiteralExpr;
+
 public:
     // Ctors & Dtors
 
@@ -48,7 +54,7 @@ public:
      * @param      range  Location in source.
      */
     explicit FloatLiteralExpr(float value, SourceRange range = {}) noexcept
-        : LiteralExpr<float>(value, range)
+        : LiteralExpr<float>(typeKind, value, range)
     {
         // Nothing to do
     }
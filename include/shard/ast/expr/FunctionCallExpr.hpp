@@ -39,6 +39,12 @@ class FunctionCallExpr final
     : public Expr,
       public PtrBuilder<FunctionCallExpr, ExprPtr, ExprPtrVector>
 {
+public:
+    // Constants
+
+    /// Kind constant.
+    static constexpr NodeKind typeKind = NodeKind::FunctionCallExpr;
+
 public:
     // Ctors & Dtors
 
@@ -53,7 +59,7 @@ public:
         ExprPtr expr,
         ExprPtrVector args = {},
         SourceRange range  = {})
-        : Expr(range)
+        : Expr(typeKind, range)
         , m_expr(std::move(expr))
         , m_arguments(std::move(args))
     {
@@ -20,7 +20,7 @@
 
 // Shard
 #include "shard/Assert.hpp"
-#include "shard/String.hpp"
+#include "shard/Symbol.hpp"
 #include "shard/ViewPtr.hpp"
 #include "shard/ast/Expr.hpp"
 #include "shard/ast/utility.hpp"
@@ -40,8 +40,14 @@ class Decl;
  *             anything that can be declared.
  */
 class IdentifierExpr final : public Expr,
-                             public PtrBuilder<IdentifierExpr, String>
+                             public PtrBuilder<IdentifierExpr, Symbol>
 {
+public:
+    // Constants
+
+    /// Kind constant.
+    static constexpr NodeKind typeKind = NodeKind::IdentifierExpr;
+
 public:
     // Ctors & Dtors
 
@@ -51,9 +57,9 @@ public:
      * @param      name   Identifier name.
      * @param      range  Location in source.
      */
-    explicit IdentifierExpr(String name, SourceRange range = {})
-        : Expr(range)
-        , m_name(std::move(name))
+    explicit IdentifierExpr(Symbol name, SourceRange range = {})
+        : Expr(typeKind, range)
+        , m_name(name)
     {
         SHARD_ASSERT(!m_name.empty());
     }
@@ -65,7 +71,7 @@ public:
      *
      * @return     Identifier name.
      */
-    const String& name() const noexcept
+    Symbol name() const noexcept
     {
         return m_name;
     }
@@ -75,10 +81,10 @@ public:
      *
      * @param      name  The new identifier name.
      */
-    void setName(String name)
+    void setName(Symbol name)
     {
         SHARD_ASSERT(!name.empty());
-        m_name = std::move(name);
+        m_name = name;
     }
 
     /**
@@ -122,7 +128,7 @@ private:
     // Data Members
 
     /// Identifier name.
-    String m_name;
+    Symbol m_name;
 
     /// Pointer to identifier declaration.
     ViewPtr<Decl> m_decl;
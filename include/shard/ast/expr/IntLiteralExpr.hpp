@@ -34,6 +34,12 @@ namespace shard::ast {
 class IntLiteralExpr final : public LiteralExpr<int>,
                              public PtrBuilder<IntLiteralExpr, int>
 {
+public:
+    // Constants
+
+    /// Kind constant.
+    static constexpr NodeKind typeKind = NodeKind::IntLiteralExpr;
+
 public:
     // Ctors & Dtors
 
@@ -44,7 +50,7 @@ public:
      * @param      range  Location in source.
      */
     explicit IntLiteralExpr(int value, SourceRange range = {}) noexcept
-        : LiteralExpr<int>(value, range)
+        : LiteralExpr<int>(typeKind, value, range)
     {
         // Nothing to do
     }
@@ -41,6 +41,12 @@ class MemberAccessExpr final
     : public Expr,
       public PtrBuilder<MemberAccessExpr, ExprPtr, String>
 {
+public:
+    // Constants
+
+    /// Kind constant.
+    static constexpr NodeKind typeKind = NodeKind::MemberAccessExpr;
+
 public:
     // Ctors & Dtors
 
@@ -52,7 +58,7 @@ public:
      * @param      range  Location in source.
      */
     explicit MemberAccessExpr(ExprPtr expr, String name, SourceRange range = {})
-        : Expr(range)
+        : Expr(typeKind, range)
         , m_expr(std::move(expr))
         , m_name(std::move(name))
     {
@@ -35,6 +35,12 @@ namespace shard::ast {
  */
 class NullLiteralExpr final : public Expr, public PtrBuilder<NullLiteralExpr>
 {
+public:
+    // Constants
+
+    /// Kind constant.
+    static constexpr NodeKind typeKind = NodeKind::NullLiteralExpr;
+
 public:
     // Ctors & Dtors
 
@@ -44,7 +50,7 @@ public:
      * @param      range  Location in source.
      */
     explicit NullLiteralExpr(SourceRange range = {}) noexcept
-        : Expr(range)
+        : Expr(typeKind, range)
     {
         // Nothing to do
     }
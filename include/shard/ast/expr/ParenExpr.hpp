@@ -36,6 +36,12 @@ namespace shard::ast {
  */
 class ParenExpr final : public Expr, public PtrBuilder<ParenExpr, ExprPtr>
 {
+public:
+    // Constants
+
+    /// Kind constant.
+    static constexpr NodeKind typeKind = NodeKind::ParenExpr;
+
 public:
     // Ctors & Dtors
 
@@ -46,7 +52,7 @@ public:
      * @param      range  Location in source.
      */
     explicit ParenExpr(ExprPtr expr, SourceRange range = {})
-        : Expr(range)
+        : Expr(typeKind, range)
         , m_expr(std::move(expr))
     {
         SHARD_ASSERT(m_expr);
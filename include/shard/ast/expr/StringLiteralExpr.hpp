@@ -39,6 +39,12 @@ namespace shard::ast {
 class StringLiteralExpr final : public LiteralExpr<String>,
                                 public PtrBuilder<StringLiteralExpr, String>
 {
+public:
+    // Constants
+
+    /// Kind constant.
+    static constexpr NodeKind typeKind = NodeKind::StringLiteralExpr;
+
 public:
     // Ctors & Dtors
 
@@ -49,7 +55,7 @@ public:
      * @param      range  Location in source.
      */
     explicit StringLiteralExpr(String value, SourceRange range = {})
-        : LiteralExpr<String>(std::move(value), range)
+        : LiteralExpr<String>(typeKind, std::move(value), range)
     {
         // Nothing to do
     }
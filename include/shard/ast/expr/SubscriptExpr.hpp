@@ -39,6 +39,12 @@ class SubscriptExpr final
     : public Expr,
       public PtrBuilder<SubscriptExpr, ExprPtr, ExprPtrVector>
 {
+public:
+    // Constants
+
+    /// Kind constant.
+    static constexpr NodeKind typeKind = NodeKind::SubscriptExpr;
+
 public:
     // Ctors & Dtors
 
@@ -53,7 +59,7 @@ public:
         ExprPtr expr,
         ExprPtrVector args = {},
         SourceRange range  = {})
-        : Expr(range)
+        : Expr(typeKind, range)
         , m_expr(std::move(expr))
         , m_arguments(std::move(args))
     {
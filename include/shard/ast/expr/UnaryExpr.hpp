@@ -42,6 +42,15 @@ namespace shard::ast {
 class UnaryExpr : public Expr
 {
 
+public:
+    // Constants
+
+    /// First kind of unary expression.
+    static constexpr NodeKind firstKind = NodeKind::PrefixUnaryExpr;
+
+    /// Last kind of unary expression.
+    static constexpr NodeKind lastKind = NodeKind::PostfixUnaryExpr;
+
 public:
     // Accessors & Mutators
 
@@ -149,12 +158,17 @@ protected:
     /**
      * @brief      Constructor.
      *
+     * @param      kind   Expression kind.
      * @param      op     Operation kind.
      * @param      expr   Operand expression.
      * @param      range  Location in source.
      */
-    explicit UnaryExpr(String op, ExprPtr expr, SourceRange range = {})
-        : Expr(range)
+    explicit UnaryExpr(
+        NodeKind kind,
+        String op,
+        ExprPtr expr,
+        SourceRange range = {})
+        : Expr(kind, range)
         , m_operator(std::move(op))
         , m_expr(std::move(expr))
     {
@@ -181,6 +195,12 @@ class PrefixUnaryExpr final
       public PtrBuilder<PrefixUnaryExpr, String, ExprPtr>
 {
 
+public:
+    // Constants
+
+    /// Kind constant.
+    static constexpr NodeKind typeKind = NodeKind::PrefixUnaryExpr;
+
 public:
     // Ctors & Dtors
 
@@ -192,7 +212,7 @@ public:
      * @param      range  Location in source.
      */
     explicit PrefixUnaryExpr(String op, ExprPtr expr, SourceRange range = {})
-        : UnaryExpr(std::move(op), std::move(expr), range)
+        : UnaryExpr(typeKind, std::move(op), std::move(expr), range)
     {
         // Nothing to do
     }
@@ -208,6 +228,12 @@ class PostfixUnaryExpr final
       public PtrBuilder<PrefixUnaryExpr, ExprPtr, String>
 {
 
+public:
+    // Constants
+
+    /// Kind constant.
+    static constexpr NodeKind typeKind = NodeKind::PostfixUnaryExpr;
+
 public:
     // Ctors & Dtors
 
@@ -219,7 +245,7 @@ public:
      * @param      range  Location in source.
      */
     explicit PostfixUnaryExpr(ExprPtr expr, String op, SourceRange range = {})
-        : UnaryExpr(std::move(op), std::move(expr), range)
+        : UnaryExpr(typeKind, std::move(op), std::move(expr), range)
     {
         // Nothing to do
     }
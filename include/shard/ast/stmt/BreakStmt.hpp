@@ -32,7 +32,7 @@ class BreakStmt;
 
 /* ************************************************************************* */
 
-using BreakStmtPtr = UniquePtr<BreakStmt>;
+using BreakStmtPtr = NodePtr<BreakStmt>;
 
 /* ************************************************************************* */
 
@@ -44,6 +44,12 @@ using BreakStmtPtr = UniquePtr<BreakStmt>;
 class BreakStmt final : public Stmt, public PtrBuilder<BreakStmt>
 {
 
+public:
+    // Constants
+
+    /// Kind constant.
+    static constexpr NodeKind typeKind = NodeKind::BreakStmt;
+
 public:
     // Ctors & Dtors
 
@@ -53,7 +59,7 @@ public:
      * @param      range  Source range.
      */
     explicit BreakStmt(SourceRange range = {})
-        : Stmt(range)
+        : Stmt(typeKind, range)
     {
         // Nothing to do
     }
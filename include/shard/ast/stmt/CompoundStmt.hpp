@@ -32,7 +32,7 @@ class CompoundStmt;
 
 /* ************************************************************************* */
 
-using CompoundStmtPtr = UniquePtr<CompoundStmt>;
+using CompoundStmtPtr = NodePtr<CompoundStmt>;
 
 /* ************************************************************************* */
 
@@ -45,6 +45,12 @@ using CompoundStmtPtr = UniquePtr<CompoundStmt>;
 class CompoundStmt final : public Stmt,
                            public PtrBuilder<CompoundStmt, StmtPtrVector>
 {
+public:
+    // Constants
+
+    /// Kind constant.
+    static constexpr NodeKind typeKind = NodeKind::CompoundStmt;
+
 public:
     // Ctors & Dtors
 
@@ -55,7 +61,7 @@ public:
      * @param      range  Source range.
      */
     explicit CompoundStmt(StmtPtrVector stmts = {}, SourceRange range = {})
-        : Stmt(range)
+        : Stmt(typeKind, range)
         , m_statements(std::move(stmts))
     {
         // Nothing to do
@@ -32,7 +32,7 @@ class ContinueStmt;
 
 /* ************************************************************************* */
 
-using ContinueStmtPtr = UniquePtr<ContinueStmt>;
+using ContinueStmtPtr = NodePtr<ContinueStmt>;
 
 /* ************************************************************************* */
 
@@ -44,6 +44,12 @@ using ContinueStmtPtr = UniquePtr<ContinueStmt>;
 class ContinueStmt final : public Stmt, public PtrBuilder<ContinueStmt>
 {
 
+public:
+    // Constants
+
+    /// Kind constant.
+    static constexpr NodeKind typeKind = NodeKind::ContinueStmt;
+
 public:
     // Ctors & Dtors
 
@@ -53,7 +59,7 @@ public:
      * @param      range  Source range.
      */
     explicit ContinueStmt(SourceRange range = {})
-        : Stmt(range)
+        : Stmt(typeKind, range)
     {
         // Nothing to do
     }
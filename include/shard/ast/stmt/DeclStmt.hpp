@@ -34,7 +34,7 @@ class DeclStmt;
 
 /* ************************************************************************* */
 
-using DeclStmtPtr = UniquePtr<DeclStmt>;
+using DeclStmtPtr = NodePtr<DeclStmt>;
 
 /* ************************************************************************* */
 
@@ -46,6 +46,12 @@ using DeclStmtPtr = UniquePtr<DeclStmt>;
  */
 class DeclStmt final : public Stmt, public PtrBuilder<DeclStmt, DeclPtr>
 {
+public:
+    // Constants
+
+    /// Kind constant.
+    static constexpr NodeKind typeKind = NodeKind::DeclStmt;
+
 public:
     // Ctors & Dtors
 
@@ -56,7 +62,7 @@ public:
      * @param      range  Source range.
      */
     explicit DeclStmt(DeclPtr decl, SourceRange range = {})
-        : Stmt(range)
+        : Stmt(typeKind, range)
         , m_decl(std::move(decl))
     {
         SHARD_ASSERT(m_decl);
@@ -33,7 +33,7 @@ class ExprStmt;
 
 /* ************************************************************************* */
 
-using ExprStmtPtr = UniquePtr<ExprStmt>;
+using ExprStmtPtr = NodePtr<ExprStmt>;
 
 /* ************************************************************************* */
 
@@ -45,6 +45,12 @@ using ExprStmtPtr = UniquePtr<ExprStmt>;
  */
 class ExprStmt final : public Stmt, public PtrBuilder<ExprStmt, ExprPtr>
 {
+public:
+    // Constants
+
+    /// Kind constant.
+    static constexpr NodeKind typeKind = NodeKind::ExprStmt;
+
 public:
     // Ctors & Dtors
 
@@ -55,7 +61,7 @@ public:
      * @param      range  Source range.
      */
     explicit ExprStmt(ExprPtr expr = nullptr, SourceRange range = {})
-        : Stmt(range)
+        : Stmt(typeKind, range)
         , m_expr(std::move(expr))
     {
         // Nothing to do
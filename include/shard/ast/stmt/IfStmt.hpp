@@ -34,7 +34,7 @@ class IfStmt;
 
 /* ************************************************************************* */
 
-using IfStmtPtr = UniquePtr<IfStmt>;
+using IfStmtPtr = NodePtr<IfStmt>;
 
 /* ************************************************************************* */
 
@@ -48,6 +48,12 @@ class IfStmt final : public Stmt,
                      public PtrBuilder<IfStmt, ExprPtr, StmtPtr, StmtPtr>
 {
 
+public:
+    // Constants
+
+    /// Kind constant.
+    static constexpr NodeKind typeKind = NodeKind::IfStmt;
+
 public:
     // Ctors & Dtors
 
@@ -64,7 +70,7 @@ public:
         StmtPtr thenStmt,
         StmtPtr elseStmt  = nullptr,
         SourceRange range = {})
-        : Stmt(range)
+        : Stmt(typeKind, range)
         , m_condExpr(std::move(condExpr))
         , m_thenStmt(std::move(thenStmt))
         , m_elseStmt(std::move(elseStmt))
@@ -37,6 +37,12 @@ namespace shard::ast {
 class ReturnStmt final : public Stmt, public PtrBuilder<ReturnStmt, ExprPtr>
 {
 
+public:
+    // Constants
+
+    /// Kind constant.
+    static constexpr NodeKind typeKind = NodeKind::ReturnStmt;
+
 public:
     // Ctors & Dtors
 
@@ -47,7 +53,7 @@ public:
      * @param      range    Source range.
      */
     explicit ReturnStmt(ExprPtr resExpr = nullptr, SourceRange range = {})
-        : Stmt(range)
+        : Stmt(typeKind, range)
         , m_resExpr(std::move(resExpr))
     {
         // Nothing to do
@@ -101,7 +107,7 @@ public:
      *
      * @param      expr  The new result expression.
      */
-    void setResExpr(UniquePtr<Expr> expr)
+    void setResExpr(ExprPtr expr)
     {
         m_resExpr = std::move(expr);
     }
@@ -37,7 +37,7 @@ class WhileStmt;
 
 /* ************************************************************************* */
 
-using WhileStmtPtr = UniquePtr<WhileStmt>;
+using WhileStmtPtr = NodePtr<WhileStmt>;
 
 /* ************************************************************************* */
 
@@ -50,6 +50,12 @@ class WhileStmt final : public Stmt,
                         public PtrBuilder<WhileStmt, ExprPtr, StmtPtr>
 {
 
+public:
+    // Constants
+
+    /// Kind constant.
+    static constexpr NodeKind typeKind = NodeKind::WhileStmt;
+
 public:
     // Ctors & Dtors
 
@@ -61,7 +67,7 @@ public:
      * @param      range     Source range.
      */
     WhileStmt(ExprPtr condExpr, StmtPtr bodyStmt, SourceRange range = {})
-        : Stmt(range)
+        : Stmt(typeKind, range)
         , m_condExpr(std::move(condExpr))
         , m_bodyStmt(std::move(bodyStmt))
     {
@@ -117,7 +123,7 @@ public:
      *
      * @param      expr  The new condition expression.
      */
-    void setCondExpr(UniquePtr<Expr> expr)
+    void setCondExpr(ExprPtr expr)
     {
         m_condExpr = std::move(expr);
     }
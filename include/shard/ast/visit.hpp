@@ -0,0 +1,175 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+#pragma once
+
+/* ************************************************************************* */
+
+// C++
+#include <type_traits>
+#include <utility>
+
+// Shard
+#include "shard/Assert.hpp"
+#include "shard/ast/Decls.hpp"
+#include "shard/ast/Exprs.hpp"
+#include "shard/ast/Node.hpp"
+#include "shard/ast/Stmts.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::ast {
+
+/* ************************************************************************* */
+
+namespace detail {
+
+/* ************************************************************************* */
+
+/// Node type with constness of the visited node.
+template<typename NODE, typename T>
+using VisitCast = std::conditional_t<std::is_const_v<NODE>, const T, T>;
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Node dispatch implementation.
+ *
+ * @param      node     The node.
+ * @param      visitor  The visitor.
+ *
+ * @tparam     NODE     `Node` or `const Node`.
+ * @tparam     Visitor  Visitor type.
+ *
+ * @return     Result of the visitor call.
+ */
+template<typename NODE, typename Visitor>
+decltype(auto) visit(NODE& node, Visitor&& visitor)
+{
+    switch (node.kind())
+    {
+    // Decl
+    case NodeKind::VariableDecl:
+        return visitor(static_cast<VisitCast<NODE, VariableDecl>&>(node));
+    case NodeKind::FunctionDecl:
+        return visitor(static_cast<VisitCast<NODE, FunctionDecl>&>(node));
+    case NodeKind::NamespaceDecl:
+        return visitor(static_cast<VisitCast<NODE, NamespaceDecl>&>(node));
+    case NodeKind::ClassDecl:
+        return visitor(static_cast<VisitCast<NODE, ClassDecl>&>(node));
+
+    // Stmt
+    case NodeKind::BreakStmt:
+        return visitor(static_cast<VisitCast<NODE, BreakStmt>&>(node));
+    case NodeKind::CompoundStmt:
+        return visitor(static_cast<VisitCast<NODE, CompoundStmt>&>(node));
+    case NodeKind::ContinueStmt:
+        return visitor(static_cast<VisitCast<NODE, ContinueStmt>&>(node));
+    case NodeKind::DeclStmt:
+        return visitor(static_cast<VisitCast<NODE, DeclStmt>&>(node));
+    case NodeKind::ExprStmt:
+        return visitor(static_cast<VisitCast<NODE, ExprStmt>&>(node));
+    case NodeKind::IfStmt:
+        return visitor(static_cast<VisitCast<NODE, IfStmt>&>(node));
+    case NodeKind::ReturnStmt:
+        return visitor(static_cast<VisitCast<NODE, ReturnStmt>&>(node));
+    case NodeKind::WhileStmt:
+        return visitor(static_cast<VisitCast<NODE, WhileStmt>&>(node));
+
+    // Expr
+    case NodeKind::BoolLiteralExpr:
+        return visitor(static_cast<VisitCast<NODE, BoolLiteralExpr>&>(node));
+    case NodeKind::IntLiteralExpr:
+        return visitor(static_cast<VisitCast<NODE, IntLiteralExpr>&>(node));
+    case NodeKind::FloatLiteralExpr:
+        return visitor(static_cast<VisitCast<NODE, FloatLiteralExpr>&>(node));
+    case NodeKind::CharLiteralExpr:
+        return visitor(static_cast<VisitCast<NODE, CharLiteralExpr>&>(node));
+    case NodeKind::StringLiteralExpr:
+        return visitor(static_cast<VisitCast<NODE, StringLiteralExpr>&>(node));
+    case NodeKind::NullLiteralExpr:
+        return visitor(static_cast<VisitCast<NODE, NullLiteralExpr>&>(node));
+    case NodeKind::BinaryExpr:
+        return visitor(static_cast<VisitCast<NODE, BinaryExpr>&>(node));
+    case NodeKind::PrefixUnaryExpr:
+        return visitor(static_cast<VisitCast<NODE, PrefixUnaryExpr>&>(node));
+    case NodeKind::PostfixUnaryExpr:
+        return visitor(static_cast<VisitCast<NODE, PostfixUnaryExpr>&>(node));
+    case NodeKind::IdentifierExpr:
+        return visitor(static_cast<VisitCast<NODE, IdentifierExpr>&>(node));
+    case NodeKind::MemberAccessExpr:
+        return visitor(static_cast<VisitCast<NODE, MemberAccessExpr>&>(node));
+    case NodeKind::FunctionCallExpr:
+        return visitor(static_cast<VisitCast<NODE, FunctionCallExpr>&>(node));
+    case NodeKind::SubscriptExpr:
+        return visitor(static_cast<VisitCast<NODE, SubscriptExpr>&>(node));
+    case NodeKind::ParenExpr:
+    default:
+        SHARD_ASSERT(node.kind() == NodeKind::ParenExpr);
+        return visitor(static_cast<VisitCast<NODE, ParenExpr>&>(node));
+    }
+}
+
+/* ************************************************************************* */
+
+} // namespace detail
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Calls visitor with node cast to its final type.
+ *
+ * @details    The final type is selected by a switch over the node kind
+ *             instead of a chain of `is<>` tests. The visitor must be
+ *             callable with every final node type, e.g. a generic lambda or
+ *             an overload set.
+ *
+ * @param      node     The node.
+ * @param      visitor  The visitor.
+ *
+ * @tparam     Visitor  Visitor type.
+ *
+ * @return     Result of the visitor call.
+ */
+template<typename Visitor>
+decltype(auto) visit(Node& node, Visitor&& visitor)
+{
+    return detail::visit(node, std::forward<Visitor>(visitor));
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Calls visitor with node cast to its final type.
+ *
+ * @param      node     The node.
+ * @param      visitor  The visitor.
+ *
+ * @tparam     Visitor  Visitor type.
+ *
+ * @return     Result of the visitor call.
+ */
+template<typename Visitor>
+decltype(auto) visit(const Node& node, Visitor&& visitor)
+{
+    return detail::visit(node, std::forward<Visitor>(visitor));
+}
+
+/* ************************************************************************* */
+
+} // namespace shard::ast
+
+/* ************************************************************************* */
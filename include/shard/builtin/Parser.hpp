@@ -92,14 +92,26 @@ public:
     /**
      * @brief      Create a parser.
      *
-     * @param      begin  The begin iterator.
-     * @param      end    The end iterator.
+     * @param      source  The source used for resolving locations.
+     * @param      begin   The begin iterator.
+     * @param      end     The end iterator.
      *
-     * @tparam     IT     Iterator type.
+     * @tparam     IT      Iterator type.
      */
     template<typename IT>
-    explicit Parser(IT begin, IT end)
-        : parser::Parser(begin, end)
+    explicit Parser(const tokenizer::Source& source, IT begin, IT end)
+        : parser::Parser(source, begin, end)
+    {
+        extendParser(*this);
+    }
+
+    /**
+     * @brief      Create a parser.
+     *
+     * @param      tokens  The tokens to parse.
+     */
+    explicit Parser(tokenizer::TokenBuffer tokens)
+        : parser::Parser(std::move(tokens))
     {
         extendParser(*this);
     }
@@ -110,7 +122,7 @@ public:
      * @param      tokenizer  The tokenizer.
      */
     explicit Parser(tokenizer::Tokenizer& tokenizer)
-        : Parser(tokenizer.begin(), tokenizer.end())
+        : Parser(tokenizer.tokenizeAll())
     {
         // Nothing to do
     }
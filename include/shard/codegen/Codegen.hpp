@@ -0,0 +1,69 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+#pragma once
+
+/* ************************************************************************* */
+
+// Shard
+#include "shard/ir/Module.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::ast {
+
+/* ************************************************************************* */
+
+class Source;
+
+/* ************************************************************************* */
+
+} // namespace shard::ast
+
+/* ************************************************************************* */
+
+namespace shard::codegen {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Lower parsed source into IR module.
+ *
+ * @details    The source may contain only function declarations, each of
+ *             them is lowered into an IR function. Local variables are
+ *             stack slots created in the function entry block, control flow
+ *             statements are lowered into blocks connected by branches.
+ *             Declarations with `Any` type get the type of their initializer
+ *             or `int` if there is none. Functions with `Any` return type
+ *             return `int` when they return a value. Identifiers are
+ *             resolved during lowering and their declarations are stored
+ *             into the AST. Calls to functions not declared in the source
+ *             are lowered as calls without result, the interpreter resolves
+ *             them by name.
+ *
+ * @param      source  The source.
+ *
+ * @return     The module.
+ *
+ * @throws     ast::SemanticError  For unsupported or ill-typed constructs.
+ */
+ir::Module generate(ast::Source& source);
+
+/* ************************************************************************* */
+
+} // namespace shard::codegen
+
+/* ************************************************************************* */
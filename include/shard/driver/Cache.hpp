@@ -0,0 +1,156 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+#pragma once
+
+/* ************************************************************************* */
+
+// C++
+#include <cstdint>
+
+// Shard
+#include "shard/FilePath.hpp"
+#include "shard/Optional.hpp"
+#include "shard/String.hpp"
+#include "shard/StringView.hpp"
+#include "shard/ir/Module.hpp"
+#include "shard/tokenizer/Source.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::driver {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      On-disk cache of compiled sources.
+ *
+ * @details    Modules are stored serialized in the cache directory under the
+ *             hash and the length of the source content, so unchanged
+ *             sources are loaded without tokenizing, parsing and lowering.
+ *             Entries are kept in a subdirectory named by the compiler
+ *             version and each entry starts with a header with the content
+ *             hash and length followed by the content itself, which are
+ *             compared before the module is trusted, so colliding sources
+ *             never share a module. Files are written under a temporary name and renamed,
+ *             so concurrent processes never see partially written entries.
+ *             Unreadable entries are treated as missing.
+ */
+class Cache
+{
+public:
+    // Constants
+
+    /// Version of cache entries, increase when lowering output changes.
+    static constexpr std::uint32_t Version = 2;
+
+public:
+    // Ctors & Dtors
+
+    /**
+     * @brief      Constructor.
+     *
+     * @param      directory  The cache directory, created on first store.
+     */
+    explicit Cache(FilePath directory)
+        : m_directory(std::move(directory))
+    {
+        // Nothing to do
+    }
+
+public:
+    // Accessors & Mutators
+
+    /**
+     * @brief      Returns cache directory.
+     *
+     * @return     The directory.
+     */
+    const FilePath& directory() const noexcept
+    {
+        return m_directory;
+    }
+
+    /**
+     * @brief      Returns name of subdirectory with entries of this compiler.
+     *
+     * @return     The tag.
+     */
+    static String tag();
+
+    /**
+     * @brief      Returns path of cache entry for source.
+     *
+     * @param      source  The source.
+     *
+     * @return     The entry path.
+     */
+    FilePath path(const tokenizer::Source& source) const;
+
+public:
+    // Operations
+
+    /**
+     * @brief      Load cached module of source.
+     *
+     * @param      source  The source.
+     *
+     * @return     The module or nothing when not cached.
+     */
+    Optional<ir::Module> load(const tokenizer::Source& source) const;
+
+    /**
+     * @brief      Store module of source.
+     *
+     * @param      source  The source.
+     * @param      module  The compiled module.
+     *
+     * @return     If module was stored, failures don't affect compilation.
+     */
+    bool store(const tokenizer::Source& source, const ir::Module& module) const;
+
+    /**
+     * @brief      Returns cached module or compiles source and caches it.
+     *
+     * @param      source  The source.
+     *
+     * @return     The module.
+     *
+     * @throws     LocationError  For invalid source.
+     */
+    ir::Module compile(tokenizer::Source& source) const;
+
+    /**
+     * @brief      Calculate 64-bit FNV-1a hash of content.
+     *
+     * @param      content  The content.
+     *
+     * @return     The hash.
+     */
+    static std::uint64_t hash(StringView content) noexcept;
+
+private:
+    // Data Members
+
+    /// Cache directory.
+    FilePath m_directory;
+};
+
+/* ************************************************************************* */
+
+} // namespace shard::driver
+
+/* ************************************************************************* */
@@ -0,0 +1,167 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+#pragma once
+
+/* ************************************************************************* */
+
+// Shard
+#include "shard/PtrVector.hpp"
+#include "shard/ThreadPool.hpp"
+#include "shard/UniquePtr.hpp"
+#include "shard/Vector.hpp"
+#include "shard/ViewPtr.hpp"
+#include "shard/ast/Source.hpp"
+#include "shard/tokenizer/Source.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::driver {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Compilation session of multiple sources.
+ *
+ * @details    Sources are independent until analysis, so each of them is
+ *             tokenized and parsed by a separate worker into its own AST
+ *             with own node arena. Analysis then sees top-level declarations
+ *             of all sources. Parsing and analysis share one worker pool.
+ */
+class Session
+{
+public:
+    // Accessors & Mutators
+
+    /**
+     * @brief      Returns maximum number of worker threads.
+     *
+     * @return     The number of threads, 0 for hardware concurrency.
+     */
+    unsigned threadCount() const noexcept
+    {
+        return m_threadCount;
+    }
+
+    /**
+     * @brief      Change maximum number of worker threads.
+     *
+     * @param      count  The number of threads, 0 for hardware concurrency.
+     */
+    void setThreadCount(unsigned count) noexcept
+    {
+        m_threadCount = count;
+        m_pool.reset();
+    }
+
+    /**
+     * @brief      Returns session sources.
+     *
+     * @return     The sources.
+     */
+    const PtrVector<tokenizer::Source>& sources() const noexcept
+    {
+        return m_sources;
+    }
+
+    /**
+     * @brief      Add source to the session.
+     *
+     * @param      source  The source.
+     *
+     * @return     Pointer to stored source.
+     */
+    ViewPtr<tokenizer::Source> addSource(UniquePtr<tokenizer::Source> source)
+    {
+        m_sources.push_back(std::move(source));
+        return m_sources.back().get();
+    }
+
+    /**
+     * @brief      Returns parsed sources.
+     *
+     * @return     ASTs in order of sources, empty before `parse`.
+     */
+    Vector<ast::Source>& asts() noexcept
+    {
+        return m_asts;
+    }
+
+    /**
+     * @brief      Returns parsed sources.
+     *
+     * @return     ASTs in order of sources, empty before `parse`.
+     */
+    const Vector<ast::Source>& asts() const noexcept
+    {
+        return m_asts;
+    }
+
+public:
+    // Operations
+
+    /**
+     * @brief      Parse all sources concurrently.
+     *
+     * @throws     SourceError  The error of the first failing source.
+     */
+    void parse();
+
+    /**
+     * @brief      Analyse parsed sources.
+     *
+     * @details    Top-level functions of all sources are declared first,
+     *             so sources can refer to each other regardless of order.
+     *             Other top-level statements are analysed in source order,
+     *             then the functions of all sources are analysed
+     *             concurrently.
+     *
+     * @throws     SourceError  For redefinitions and the first analysis
+     *                          error.
+     */
+    void analyse();
+
+private:
+    // Operations
+
+    /**
+     * @brief      Returns worker pool, started on first use.
+     *
+     * @return     The pool shared by parsing and analysis.
+     */
+    ThreadPool& pool();
+
+private:
+    // Data Members
+
+    /// Maximum number of worker threads.
+    unsigned m_threadCount = 0;
+
+    /// Worker pool.
+    UniquePtr<ThreadPool> m_pool;
+
+    /// Session sources.
+    PtrVector<tokenizer::Source> m_sources;
+
+    /// Parsed sources.
+    Vector<ast::Source> m_asts;
+};
+
+/* ************************************************************************* */
+
+} // namespace shard::driver
+
+/* ************************************************************************* */
@@ -0,0 +1,48 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+#pragma once
+
+/* ************************************************************************* */
+
+// Shard
+#include "shard/ir/Module.hpp"
+#include "shard/tokenizer/Source.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::driver {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Compile source into IR module.
+ *
+ * @details    The source is tokenized, parsed, analysed and lowered into IR.
+ *
+ * @param      source  The source.
+ *
+ * @return     The module.
+ *
+ * @throws     LocationError  For invalid source.
+ */
+ir::Module compile(tokenizer::Source& source);
+
+/* ************************************************************************* */
+
+} // namespace shard::driver
+
+/* ************************************************************************* */
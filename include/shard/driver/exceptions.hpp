@@ -0,0 +1,91 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+#pragma once
+
+/* ************************************************************************* */
+
+// Shard
+#include "shard/FilePath.hpp"
+#include "shard/exceptions.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::driver {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Error in one of session sources.
+ */
+class SourceError : public LocationError
+{
+public:
+    // Ctors & Dtors
+
+    /**
+     * @brief      Constructor.
+     *
+     * @param      filename  The source filename.
+     * @param      message   The message.
+     * @param      location  The source code location.
+     */
+    SourceError(FilePath filename, String message, SourceLocation location)
+        : LocationError(std::move(message), location)
+        , m_filename(std::move(filename))
+        , m_what(m_filename.string() + ":" + LocationError::what())
+    {
+        // Nothing to do
+    }
+
+public:
+    // Accessors & Mutators
+
+    /**
+     * @brief      Returns filename of source with error.
+     *
+     * @return     The filename.
+     */
+    const FilePath& filename() const noexcept
+    {
+        return m_filename;
+    }
+
+    /**
+     * @brief      Returns error message with filename.
+     *
+     * @return     The message.
+     */
+    const char* what() const noexcept
+    {
+        return m_what.c_str();
+    }
+
+private:
+    // Data Members
+
+    /// Source filename.
+    FilePath m_filename;
+
+    /// The result message.
+    String m_what;
+};
+
+/* ************************************************************************* */
+
+} // namespace shard::driver
+
+/* ************************************************************************* */
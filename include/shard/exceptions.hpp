@@ -54,6 +54,16 @@ public:
 public:
     // Accessors & Mutators
 
+    /**
+     * @brief      Returns error message without location.
+     *
+     * @return     The message.
+     */
+    const String& message() const noexcept
+    {
+        return m_message;
+    }
+
     /**
      * @brief      Returns error source location.
      *
@@ -20,11 +20,24 @@
 
 // Shard
 #include "shard/Map.hpp"
+#include "shard/ViewPtr.hpp"
 #include "shard/ir/Value.hpp"
 #include "shard/interpreter/Value.hpp"
 
 /* ************************************************************************* */
 
+namespace shard::ir {
+
+/* ************************************************************************* */
+
+class Block;
+
+/* ************************************************************************* */
+
+} // namespace shard::ir
+
+/* ************************************************************************* */
+
 namespace shard::interpreter {
 
 /* ************************************************************************* */
@@ -60,6 +73,16 @@ public:
         return m_result;
     }
 
+    /**
+     * @brief      Returns block to be evaluated after the current one.
+     *
+     * @return     Reference to block, nullptr when function returns.
+     */
+    ViewPtr<const ir::Block>& nextBlock() noexcept
+    {
+        return m_nextBlock;
+    }
+
 private:
     // Data Members
 
@@ -68,6 +91,9 @@ private:
 
     /// Result value.
     Value m_result;
+
+    /// Next evaluated block.
+    ViewPtr<const ir::Block> m_nextBlock;
 };
 
 /* ************************************************************************* */
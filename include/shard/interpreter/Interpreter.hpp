@@ -19,13 +19,20 @@
 /* ************************************************************************* */
 
 // C++
+#include <cstddef>
 #include <stack>
+#include <utility>
 
 // Shard
+#include "shard/HashMap.hpp"
+#include "shard/Set.hpp"
 #include "shard/ViewPtr.hpp"
 #include "shard/StringView.hpp"
+#include "shard/UniquePtr.hpp"
 #include "shard/interpreter/Frame.hpp"
+#include "shard/interpreter/Jit.hpp"
 #include "shard/interpreter/Value.hpp"
+#include "shard/ir/Function.hpp"
 
 /* ************************************************************************* */
 
@@ -71,9 +78,99 @@ namespace shard::interpreter {
 class Interpreter
 {
 
+public:
+    // Constants
+
+    /// Default number of calls before function is optimized.
+    static constexpr std::size_t DefaultTierUpThreshold = 1000;
+
+    /// Default number of loop iterations before running function switches
+    /// to native code.
+    static constexpr std::size_t DefaultOsrThreshold = 10000;
+
 public:
     // Accessors & Mutators
 
+    /**
+     * @brief      Returns number of calls after which a function is promoted
+     *             to the optimized tier.
+     *
+     * @details    Optimized tier runs a copy of the function transformed by
+     *             IR optimization passes, compiled into native code when
+     *             possible.
+     *
+     * @return     The threshold, zero means functions are never promoted.
+     */
+    std::size_t tierUpThreshold() const noexcept
+    {
+        return m_tierUpThreshold;
+    }
+
+    /**
+     * @brief      Change number of calls after which a function is promoted
+     *             to the optimized tier.
+     *
+     * @param      threshold  The threshold, zero disables promotion.
+     */
+    void setTierUpThreshold(std::size_t threshold) noexcept
+    {
+        m_tierUpThreshold = threshold;
+    }
+
+    /**
+     * @brief      Returns number of loop back edges taken by a function
+     *             after which execution continues in native code at the next
+     *             loop header (on-stack replacement).
+     *
+     * @details    Crossing the threshold also promotes the function to the
+     *             optimized tier for following calls.
+     *
+     * @return     The threshold, zero means OSR is disabled.
+     */
+    std::size_t osrThreshold() const noexcept
+    {
+        return m_osrThreshold;
+    }
+
+    /**
+     * @brief      Change number of loop back edges after which execution
+     *             continues in native code.
+     *
+     * @param      threshold  The threshold, zero disables OSR.
+     */
+    void setOsrThreshold(std::size_t threshold) noexcept
+    {
+        m_osrThreshold = threshold;
+    }
+
+    /**
+     * @brief      Returns optimized copy of given function.
+     *
+     * @param      function  The function.
+     *
+     * @return     Optimized function or nullptr if function is not promoted.
+     */
+    ViewPtr<const ir::Function> optimized(const ir::Function& function) const;
+
+    /**
+     * @brief      Returns compiled code of given function.
+     *
+     * @param      function  The function.
+     *
+     * @return     Compiled code of the optimized function or nullptr if
+     *             function is not compiled.
+     */
+    ViewPtr<const JitFunction> compiled(const ir::Function& function) const;
+
+    /**
+     * @brief      Returns code used for on-stack replacement.
+     *
+     * @param      function  The function.
+     *
+     * @return     Compiled code or nullptr if not compiled.
+     */
+    ViewPtr<const JitFunction> osrCode(const ir::Function& function) const;
+
     /**
      * @brief      Returns current frame.
      *
@@ -119,9 +216,87 @@ public:
      */
     Value call(StringView name, const Vector<Value>& args);
 
+private:
+    // Structures
+
+    /// Runtime information about function.
+    struct FunctionState
+    {
+        /// Number of calls.
+        std::size_t calls = 0;
+
+        /// Number of taken loop back edges.
+        std::size_t backedges = 0;
+
+        /// If loops were analyzed.
+        bool analyzed = false;
+
+        /// Loop back edges.
+        Set<std::pair<ViewPtr<const ir::Block>, ViewPtr<const ir::Block>>>
+            loopEdges;
+
+        /// Loop headers.
+        Vector<ViewPtr<const ir::Block>> headers;
+
+        /// If the function was promoted to the optimized tier.
+        bool promoted = false;
+
+        /// Optimized copy of the function.
+        UniquePtr<ir::Function> optimized;
+
+        /// Compiled optimized function.
+        UniquePtr<JitFunction> code;
+
+        /// If OSR compilation was already attempted.
+        bool osrCompiled = false;
+
+        /// Compiled function with loop header entries.
+        UniquePtr<JitFunction> osr;
+    };
+
 private:
     // Operations
 
+    /**
+     * @brief      Call function using the best available tier.
+     *
+     * @param      function  The function.
+     * @param      args      The arguments.
+     *
+     * @return     The returned value.
+     */
+    Value call(const ir::Function& function, const Vector<Value>& args);
+
+    /**
+     * @brief      Interpret function.
+     *
+     * @param      function  The function.
+     * @param      args      The arguments.
+     * @param      state     Function profile, nullptr disables profiling.
+     *
+     * @return     The returned value.
+     */
+    Value interpret(
+        const ir::Function& function,
+        const Vector<Value>& args,
+        ViewPtr<FunctionState> state);
+
+    /**
+     * @brief      Promote function to the optimized tier.
+     *
+     * @param      function  The function.
+     * @param      state     The function state.
+     */
+    void promote(const ir::Function& function, FunctionState& state);
+
+    /**
+     * @brief      Find loops in function.
+     *
+     * @param      function  The function.
+     * @param      state     The function state.
+     */
+    void analyze(const ir::Function& function, FunctionState& state);
+
     /**
      * @brief      Convert IR value to runtime value.
      *
@@ -275,6 +450,15 @@ private:
 
     /// Loaded modules.
     Vector<ViewPtr<const ir::Module>> m_modules;
+
+    /// Number of calls before function is optimized.
+    std::size_t m_tierUpThreshold = DefaultTierUpThreshold;
+
+    /// Number of loop back edges before OSR.
+    std::size_t m_osrThreshold = DefaultOsrThreshold;
+
+    /// Function runtime information.
+    HashMap<ViewPtr<const ir::Function>, FunctionState> m_functions;
 };
 
 /* ************************************************************************* */
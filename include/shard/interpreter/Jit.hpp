@@ -0,0 +1,273 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+#pragma once
+
+/* ************************************************************************* */
+
+// C++
+#include <cstddef>
+#include <cstdint>
+
+// Shard
+#include "shard/HashMap.hpp"
+#include "shard/PtrVector.hpp"
+#include "shard/String.hpp"
+#include "shard/UniquePtr.hpp"
+#include "shard/Vector.hpp"
+#include "shard/ViewPtr.hpp"
+#include "shard/interpreter/Value.hpp"
+#include "shard/ir/Type.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::ir {
+
+/* ************************************************************************* */
+
+class Block;
+class Function;
+class Value;
+
+/* ************************************************************************* */
+
+} // namespace shard::ir
+
+/* ************************************************************************* */
+
+namespace shard::interpreter {
+
+/* ************************************************************************* */
+
+class Frame;
+class Interpreter;
+
+/* ************************************************************************* */
+
+/**
+ * @brief      IR function compiled into native machine code.
+ *
+ * @details    Baseline template JIT for x86-64: every IR value gets a stack
+ *             slot and each instruction is translated into a fixed machine
+ *             code sequence. Only functions working with fundamental types
+ *             are supported. Calls go back through the interpreter so the
+ *             callee can be anything the interpreter is able to call.
+ *
+ *             Additional entry points can be generated for selected blocks.
+ *             They initialize the slots from an interpreter frame so the
+ *             execution of a running function can continue in native code
+ *             (on-stack replacement).
+ */
+class JitFunction
+{
+
+public:
+    // Types
+
+    /// Native entry point, arguments (or slot values for block entries) and
+    /// result are passed as raw bits.
+    using Entry = std::uint64_t (*)(
+        const std::uint64_t* data,
+        Interpreter* interpreter);
+
+    /// Description of called function used by compiled code.
+    struct CallSite
+    {
+        /// Callee name.
+        String name;
+
+        /// Argument types.
+        Vector<ir::TypeKind> argumentTypes;
+
+        /// Return type, nullptr for void functions.
+        ViewPtr<const ir::Type> returnType;
+    };
+
+    /// Value stored in a stack slot.
+    struct Slot
+    {
+        /// The value, for allocations the slot holds the allocated variable.
+        ViewPtr<const ir::Value> value;
+
+        /// Type of data in slot.
+        ir::TypeKind kind;
+    };
+
+public:
+    // Ctors & Dtors
+
+    /**
+     * @brief      Constructor.
+     *
+     * @param      function   The compiled function.
+     * @param      code       The machine code.
+     * @param      callSites  The call sites referenced from code.
+     * @param      slots      The value slots.
+     * @param      entries    Code offsets of block entry points.
+     */
+    JitFunction(
+        const ir::Function& function,
+        const Vector<std::uint8_t>& code,
+        PtrVector<CallSite> callSites,
+        Vector<Slot> slots,
+        HashMap<ViewPtr<const ir::Block>, std::size_t> entries);
+
+    /**
+     * @brief      Destructor.
+     */
+    ~JitFunction();
+
+    JitFunction(const JitFunction&) = delete;
+    JitFunction& operator=(const JitFunction&) = delete;
+
+public:
+    // Accessors & Mutators
+
+    /**
+     * @brief      Returns if JIT compilation is available on this platform.
+     *
+     * @return     True if available, False otherwise.
+     */
+    static bool isAvailable() noexcept;
+
+    /**
+     * @brief      Returns if function can be compiled.
+     *
+     * @param      function  The function.
+     *
+     * @return     True if compilable, False otherwise.
+     */
+    static bool isCompilable(const ir::Function& function);
+
+    /**
+     * @brief      Returns the compiled function.
+     *
+     * @return     The function.
+     */
+    const ir::Function& function() const noexcept
+    {
+        return *m_function;
+    }
+
+    /**
+     * @brief      Returns size of generated code.
+     *
+     * @return     The size in bytes.
+     */
+    std::size_t codeSize() const noexcept
+    {
+        return m_codeSize;
+    }
+
+    /**
+     * @brief      Returns if execution can enter the code at given block.
+     *
+     * @param      block  The block.
+     *
+     * @return     True if block has an entry point, False otherwise.
+     */
+    bool hasEntry(const ir::Block& block) const
+    {
+        return m_entries.count(&block) != 0;
+    }
+
+public:
+    // Operations
+
+    /**
+     * @brief      Compile function into native code.
+     *
+     * @param      function  The function.
+     * @param      entries   Blocks where execution can enter from a frame.
+     *
+     * @return     Compiled function or nullptr if the function cannot be
+     *             compiled.
+     */
+    static UniquePtr<JitFunction> compile(
+        const ir::Function& function,
+        const Vector<ViewPtr<const ir::Block>>& entries = {});
+
+    /**
+     * @brief      Execute compiled code.
+     *
+     * @param      interpreter  The interpreter used for calls.
+     * @param      args         The arguments.
+     *
+     * @return     The returned value.
+     */
+    Value call(Interpreter& interpreter, const Vector<Value>& args) const;
+
+    /**
+     * @brief      Continue execution of interpreted function in compiled code.
+     *
+     * @param      interpreter  The interpreter used for calls.
+     * @param      block        The block where execution continues.
+     * @param      frame        The frame with current values.
+     *
+     * @return     The returned value.
+     *
+     * @pre        `hasEntry(block)`
+     */
+    Value enter(Interpreter& interpreter, const ir::Block& block, Frame& frame)
+        const;
+
+private:
+    // Operations
+
+    /**
+     * @brief      Execute code at given offset.
+     *
+     * @param      interpreter  The interpreter used for calls.
+     * @param      offset       The entry point offset.
+     * @param      data         Data passed to entry point.
+     *
+     * @return     The returned value.
+     */
+    Value run(
+        Interpreter& interpreter,
+        std::size_t offset,
+        const Vector<std::uint64_t>& data) const;
+
+private:
+    // Data Members
+
+    /// Compiled function.
+    ViewPtr<const ir::Function> m_function;
+
+    /// Executable memory.
+    void* m_memory = nullptr;
+
+    /// Size of executable memory.
+    std::size_t m_memorySize = 0;
+
+    /// Size of the code.
+    std::size_t m_codeSize = 0;
+
+    /// Call sites referenced by code.
+    PtrVector<CallSite> m_callSites;
+
+    /// Value slots.
+    Vector<Slot> m_slots;
+
+    /// Block entry points.
+    HashMap<ViewPtr<const ir::Block>, std::size_t> m_entries;
+};
+
+/* ************************************************************************* */
+
+} // namespace shard::interpreter
+
+/* ************************************************************************* */
@@ -48,6 +48,16 @@ public:
         return m_instructions;
     }
 
+    /**
+     * @brief      Returns block instructions.
+     *
+     * @return     The list of instructions.
+     */
+    PtrVector<Instruction>& instructions() noexcept
+    {
+        return m_instructions;
+    }
+
     /**
      * @brief      Returns block number of instructions.
      *
@@ -58,6 +68,27 @@ public:
         return m_instructions.size();
     }
 
+    /**
+     * @brief      Returns block terminator instruction.
+     *
+     * @return     The last instruction if it's a terminator, nullptr
+     *             otherwise.
+     */
+    ViewPtr<Instruction> terminator() const noexcept
+    {
+        if (m_instructions.empty() || !m_instructions.back()->isTerminator())
+            return nullptr;
+
+        return m_instructions.back().get();
+    }
+
+    /**
+     * @brief      Returns blocks the control flow can continue to.
+     *
+     * @return     A list of successor blocks.
+     */
+    Vector<ViewPtr<Block>> successors() const;
+
     /**
      * @brief      Sets the instructions.
      *
@@ -0,0 +1,51 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+#pragma once
+
+/* ************************************************************************* */
+
+// Shard
+#include "shard/UniquePtr.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::ir {
+
+/* ************************************************************************* */
+
+class Function;
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Create a deep copy of function.
+ *
+ * @details    Blocks, instructions and their results are duplicated so the
+ *             copy can be transformed without affecting the original.
+ *             Constants and types are shared with the original function.
+ *
+ * @param      function  The function.
+ *
+ * @return     The copy.
+ */
+UniquePtr<Function> clone(const Function& function);
+
+/* ************************************************************************* */
+
+} // namespace shard::ir
+
+/* ************************************************************************* */
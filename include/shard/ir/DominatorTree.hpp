@@ -0,0 +1,161 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+#pragma once
+
+/* ************************************************************************* */
+
+// C++
+#include <cstddef>
+
+// Shard
+#include "shard/Map.hpp"
+#include "shard/Vector.hpp"
+#include "shard/ViewPtr.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::ir {
+
+/* ************************************************************************* */
+
+class Block;
+class Function;
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Dominator tree of function blocks.
+ *
+ * @details    Block A dominates block B if every path from the entry block
+ *             to B goes through A. The tree is computed by the iterative
+ *             algorithm of Cooper, Harvey and Kennedy. Blocks unreachable
+ *             from the entry block are not part of the tree.
+ */
+class DominatorTree
+{
+
+public:
+    // Ctors & Dtors
+
+    /**
+     * @brief      Constructor.
+     *
+     * @param      function  The analysed function.
+     */
+    explicit DominatorTree(const Function& function);
+
+public:
+    // Accessors & Mutators
+
+    /**
+     * @brief      Returns reachable blocks in reverse post-order.
+     *
+     * @details    Each block is preceded by all its dominators.
+     *
+     * @return     The blocks.
+     */
+    const Vector<ViewPtr<Block>>& blocks() const noexcept
+    {
+        return m_blocks;
+    }
+
+    /**
+     * @brief      Returns if block is reachable from the entry block.
+     *
+     * @param      block  The block.
+     *
+     * @return     True if reachable, False otherwise.
+     */
+    bool isReachable(ViewPtr<const Block> block) const
+    {
+        return m_indices.count(block) != 0;
+    }
+
+    /**
+     * @brief      Returns immediate dominator of a block.
+     *
+     * @param      block  The block.
+     *
+     * @return     The immediate dominator or nullptr for entry and
+     *             unreachable blocks.
+     */
+    ViewPtr<Block> idom(ViewPtr<const Block> block) const;
+
+    /**
+     * @brief      Returns blocks immediately dominated by a block.
+     *
+     * @param      block  The block.
+     *
+     * @return     The children in the tree.
+     *
+     * @pre        `isReachable(block)`
+     */
+    const Vector<ViewPtr<Block>>& children(ViewPtr<const Block> block) const
+    {
+        return m_nodes[m_indices.at(block)].children;
+    }
+
+    /**
+     * @brief      Returns if the first block dominates the second one.
+     *
+     * @details    Every block dominates itself.
+     *
+     * @param      dominator  The dominator.
+     * @param      block      The dominated block.
+     *
+     * @return     True if dominates, False otherwise.
+     */
+    bool dominates(ViewPtr<const Block> dominator, ViewPtr<const Block> block)
+        const;
+
+private:
+    // Structures
+
+    /// Tree node.
+    struct Node
+    {
+        /// Index of immediate dominator.
+        size_t idom;
+
+        /// Dominated blocks.
+        Vector<ViewPtr<Block>> children;
+
+        /// Tree pre-order number.
+        size_t in;
+
+        /// Tree post-order number.
+        size_t out;
+    };
+
+private:
+    // Data Members
+
+    /// Blocks in reverse post-order.
+    Vector<ViewPtr<Block>> m_blocks;
+
+    /// Block indices into `m_blocks`.
+    Map<ViewPtr<const Block>, size_t> m_indices;
+
+    /// Tree nodes with the same index as `m_blocks`.
+    Vector<Node> m_nodes;
+};
+
+/* ************************************************************************* */
+
+} // namespace shard::ir
+
+/* ************************************************************************* */
@@ -19,6 +19,7 @@
 /* ************************************************************************* */
 
 // Shard
+#include "shard/Map.hpp"
 #include "shard/PtrVector.hpp"
 #include "shard/String.hpp"
 #include "shard/ir/Block.hpp"
@@ -118,6 +119,33 @@ public:
         return m_blocks;
     }
 
+    /**
+     * @brief      Return the function blocks.
+     *
+     * @return     The block.
+     */
+    PtrVector<Block>& blocks() noexcept
+    {
+        return m_blocks;
+    }
+
+    /**
+     * @brief      Returns the function entry block.
+     *
+     * @return     The first block or nullptr if function has no body.
+     */
+    ViewPtr<Block> entryBlock() const noexcept
+    {
+        return m_blocks.empty() ? nullptr : m_blocks.front().get();
+    }
+
+    /**
+     * @brief      Returns predecessors of all function blocks.
+     *
+     * @return     Map of blocks to blocks which can jump into them.
+     */
+    Map<ViewPtr<Block>, Vector<ViewPtr<Block>>> predecessors() const;
+
     /**
      * @brief      Set the function blocks.
      *
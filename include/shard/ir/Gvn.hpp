@@ -0,0 +1,62 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+#pragma once
+
+/* ************************************************************************* */
+
+namespace shard::ir {
+
+/* ************************************************************************* */
+
+class Function;
+class Module;
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Eliminate redundant arithmetic using global value numbering.
+ *
+ * @details    Arithmetic and comparison instructions are identified by their
+ *             kind, structural type, comparison operation and operands.
+ *             Walking the dominator tree, an instruction computing the same
+ *             expression as an instruction in a dominating block is removed
+ *             and its uses are replaced by the dominating result. Operands
+ *             of commutative operations are matched in both orders and
+ *             constants are compared by value.
+ *
+ * @param      function  The function.
+ *
+ * @return     If the function was changed.
+ */
+bool gvn(Function& function);
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Eliminate redundant arithmetic in all module functions.
+ *
+ * @param      module  The module.
+ *
+ * @return     If any function was changed.
+ */
+bool gvn(Module& module);
+
+/* ************************************************************************* */
+
+} // namespace shard::ir
+
+/* ************************************************************************* */
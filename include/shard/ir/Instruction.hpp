@@ -99,6 +99,73 @@ public:
         return m_kind;
     }
 
+    /**
+     * @brief      Returns if instruction terminates a block.
+     *
+     * @return     True if instruction is a branch or return instruction.
+     */
+    bool isTerminator() const noexcept
+    {
+        switch (m_kind)
+        {
+        case InstructionKind::Branch:
+        case InstructionKind::BranchCondition:
+        case InstructionKind::Return:
+        case InstructionKind::ReturnVoid: return true;
+        default: return false;
+        }
+    }
+
+    /**
+     * @brief      Returns if instruction produces a result value.
+     *
+     * @return     True if instruction is a result instruction.
+     */
+    bool hasResult() const noexcept
+    {
+        switch (m_kind)
+        {
+        case InstructionKind::Alloc:
+        case InstructionKind::Load:
+        case InstructionKind::Add:
+        case InstructionKind::Sub:
+        case InstructionKind::Mul:
+        case InstructionKind::Div:
+        case InstructionKind::Rem:
+        case InstructionKind::Cmp:
+        case InstructionKind::And:
+        case InstructionKind::Or:
+        case InstructionKind::Xor:
+        case InstructionKind::Call: return true;
+        default: return false;
+        }
+    }
+
+    /**
+     * @brief      Returns instruction result value.
+     *
+     * @return     The result value or nullptr if instruction doesn't produce
+     *             a value.
+     */
+    ViewPtr<Value> result() const noexcept;
+
+    /**
+     * @brief      Returns values used by the instruction.
+     *
+     * @return     A list of operand values.
+     */
+    Vector<ViewPtr<Value>> operands() const;
+
+    /**
+     * @brief      Replace all uses of a value by other value.
+     *
+     * @param      from  The replaced value.
+     * @param      to    The new value.
+     *
+     * @return     If any operand was replaced.
+     */
+    bool replaceUsesOf(ViewPtr<Value> from, ViewPtr<Value> to) noexcept;
+
     /**
      * @brief      Check if this instruction is required instruction.
      *
@@ -313,6 +380,16 @@ public:
         return m_pointer;
     }
 
+    /**
+     * @brief      Change pointer value.
+     *
+     * @param      pointer  The pointer.
+     */
+    void setPointer(ViewPtr<Value> pointer) noexcept
+    {
+        m_pointer = pointer;
+    }
+
     /**
      * @brief      Returns value.
      *
@@ -323,6 +400,16 @@ public:
         return m_value;
     }
 
+    /**
+     * @brief      Change stored value.
+     *
+     * @param      value  The value.
+     */
+    void setValue(ViewPtr<Value> value) noexcept
+    {
+        m_value = value;
+    }
+
     /**
      * @brief      Returns the load element index.
      *
@@ -391,6 +478,16 @@ public:
         return m_pointer;
     }
 
+    /**
+     * @brief      Change pointer value.
+     *
+     * @param      pointer  The pointer.
+     */
+    void setPointer(ViewPtr<Value> pointer) noexcept
+    {
+        m_pointer = pointer;
+    }
+
     /**
      * @brief      Returns the load element index.
      *
@@ -471,6 +568,16 @@ public:
         return m_value1;
     }
 
+    /**
+     * @brief      Change the first value.
+     *
+     * @param      value  The value.
+     */
+    void setValue1(ViewPtr<Value> value) noexcept
+    {
+        m_value1 = value;
+    }
+
     /**
      * @brief      Returns the second value.
      *
@@ -481,6 +588,16 @@ public:
         return m_value2;
     }
 
+    /**
+     * @brief      Change the second value.
+     *
+     * @param      value  The value.
+     */
+    void setValue2(ViewPtr<Value> value) noexcept
+    {
+        m_value2 = value;
+    }
+
 private:
     // Data Members
 
@@ -707,6 +824,16 @@ public:
         return m_block;
     }
 
+    /**
+     * @brief      Change the block jump to.
+     *
+     * @param      block  The block.
+     */
+    void setBlock(ViewPtr<Block> block) noexcept
+    {
+        m_block = block;
+    }
+
 private:
     // Data Members
 
@@ -763,6 +890,16 @@ public:
         return m_condition;
     }
 
+    /**
+     * @brief      Change the condition value.
+     *
+     * @param      condition  The condition value.
+     */
+    void setCondition(ViewPtr<Value> condition) noexcept
+    {
+        m_condition = condition;
+    }
+
     /**
      * @brief      Returns the block jump to.
      *
@@ -773,6 +910,16 @@ public:
         return m_blockTrue;
     }
 
+    /**
+     * @brief      Change the block jump to if condition is true.
+     *
+     * @param      block  The block.
+     */
+    void setBlockTrue(ViewPtr<Block> block) noexcept
+    {
+        m_blockTrue = block;
+    }
+
     /**
      * @brief      Returns the block jump to.
      *
@@ -783,6 +930,16 @@ public:
         return m_blockFalse;
     }
 
+    /**
+     * @brief      Change the block jump to if condition is false.
+     *
+     * @param      block  The block.
+     */
+    void setBlockFalse(ViewPtr<Block> block) noexcept
+    {
+        m_blockFalse = block;
+    }
+
 private:
     // Data Members
 
@@ -867,6 +1024,16 @@ public:
         return m_arguments;
     }
 
+    /**
+     * @brief      Returns calling arguments.
+     *
+     * @return     The arguments.
+     */
+    Vector<ViewPtr<Value>>& arguments() noexcept
+    {
+        return m_arguments;
+    }
+
 private:
     // Data Members
 
@@ -947,6 +1114,16 @@ public:
         return m_value;
     }
 
+    /**
+     * @brief      Change the return value.
+     *
+     * @param      value  The value.
+     */
+    void setValue(ViewPtr<Value> value) noexcept
+    {
+        m_value = value;
+    }
+
 private:
     // Data Members
 
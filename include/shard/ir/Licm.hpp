@@ -0,0 +1,63 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+#pragma once
+
+/* ************************************************************************* */
+
+namespace shard::ir {
+
+/* ************************************************************************* */
+
+class Function;
+class Module;
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Move loop invariant computations out of loops.
+ *
+ * @details    Arithmetic and comparison instructions whose operands don't
+ *             change inside the loop, and loads from memory the loop never
+ *             writes, are hoisted into the loop preheader. Division and
+ *             remainder are hoisted only if they are executed on every loop
+ *             iteration. Loops are processed from the innermost one so
+ *             computations can travel through the whole loop nest. A
+ *             preheader block is created if the loop doesn't have one.
+ *
+ * @param      function  The function.
+ *
+ * @return     If the function was changed.
+ */
+bool licm(Function& function);
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Move loop invariant computations out of loops in all module
+ *             functions.
+ *
+ * @param      module  The module.
+ *
+ * @return     If any function was changed.
+ */
+bool licm(Module& module);
+
+/* ************************************************************************* */
+
+} // namespace shard::ir
+
+/* ************************************************************************* */
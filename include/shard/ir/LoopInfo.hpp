@@ -0,0 +1,254 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+#pragma once
+
+/* ************************************************************************* */
+
+// Shard
+#include "shard/Map.hpp"
+#include "shard/PtrVector.hpp"
+#include "shard/Set.hpp"
+#include "shard/Vector.hpp"
+#include "shard/ViewPtr.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::ir {
+
+/* ************************************************************************* */
+
+class Block;
+class Function;
+class DominatorTree;
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Natural loop.
+ *
+ * @details    Loop is identified by a header block which dominates all loop
+ *             blocks and is the target of at least one back edge.
+ */
+class Loop
+{
+    friend class LoopInfo;
+
+public:
+    // Ctors & Dtors
+
+    /**
+     * @brief      Constructor.
+     *
+     * @param      header  The loop header.
+     */
+    explicit Loop(ViewPtr<Block> header)
+        : m_header(header)
+    {
+        // Nothing to do
+    }
+
+public:
+    // Accessors & Mutators
+
+    /**
+     * @brief      Returns loop header.
+     *
+     * @return     The header block.
+     */
+    ViewPtr<Block> header() const noexcept
+    {
+        return m_header;
+    }
+
+    /**
+     * @brief      Returns loop blocks.
+     *
+     * @return     The blocks in reverse post-order, header is the first one.
+     */
+    const Vector<ViewPtr<Block>>& blocks() const noexcept
+    {
+        return m_blocks;
+    }
+
+    /**
+     * @brief      Returns blocks jumping back to header.
+     *
+     * @return     The latch blocks.
+     */
+    const Vector<ViewPtr<Block>>& latches() const noexcept
+    {
+        return m_latches;
+    }
+
+    /**
+     * @brief      Returns if block is part of the loop or any nested loop.
+     *
+     * @param      block  The block.
+     *
+     * @return     True if contains, False otherwise.
+     */
+    bool contains(ViewPtr<const Block> block) const
+    {
+        return m_blockSet.count(block) != 0;
+    }
+
+    /**
+     * @brief      Returns the enclosing loop.
+     *
+     * @return     The parent loop or nullptr for top level loop.
+     */
+    ViewPtr<Loop> parent() const noexcept
+    {
+        return m_parent;
+    }
+
+    /**
+     * @brief      Returns directly nested loops.
+     *
+     * @return     The nested loops.
+     */
+    const Vector<ViewPtr<Loop>>& subLoops() const noexcept
+    {
+        return m_subLoops;
+    }
+
+    /**
+     * @brief      Returns loop nesting depth.
+     *
+     * @return     The depth, top level loops have depth 1.
+     */
+    unsigned depth() const noexcept
+    {
+        return m_parent ? m_parent->depth() + 1 : 1;
+    }
+
+    /**
+     * @brief      Returns loop blocks which can jump out of the loop.
+     *
+     * @return     The exiting blocks.
+     */
+    Vector<ViewPtr<Block>> exitingBlocks() const;
+
+private:
+    // Data Members
+
+    /// Loop header.
+    ViewPtr<Block> m_header;
+
+    /// Loop blocks.
+    Vector<ViewPtr<Block>> m_blocks;
+
+    /// Loop blocks for fast lookup.
+    Set<ViewPtr<const Block>> m_blockSet;
+
+    /// Back edge sources.
+    Vector<ViewPtr<Block>> m_latches;
+
+    /// Parent loop.
+    ViewPtr<Loop> m_parent;
+
+    /// Nested loops.
+    Vector<ViewPtr<Loop>> m_subLoops;
+};
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Loop nest analysis.
+ *
+ * @details    Finds natural loops from back edges in the dominator tree and
+ *             organizes them into loop nests.
+ */
+class LoopInfo
+{
+
+public:
+    // Ctors & Dtors
+
+    /**
+     * @brief      Constructor.
+     *
+     * @param      function  The analysed function.
+     * @param      tree      The function dominator tree.
+     */
+    LoopInfo(const Function& function, const DominatorTree& tree);
+
+public:
+    // Accessors & Mutators
+
+    /**
+     * @brief      Returns top level loops.
+     *
+     * @return     The loops.
+     */
+    const Vector<ViewPtr<Loop>>& loops() const noexcept
+    {
+        return m_topLevel;
+    }
+
+    /**
+     * @brief      Returns all loops ordered from innermost to outermost.
+     *
+     * @details    Nested loop always precedes its parent.
+     *
+     * @return     The loops.
+     */
+    const PtrVector<Loop>& allLoops() const noexcept
+    {
+        return m_loops;
+    }
+
+    /**
+     * @brief      Returns the innermost loop containing block.
+     *
+     * @param      block  The block.
+     *
+     * @return     The loop or nullptr if block is not in any loop.
+     */
+    ViewPtr<Loop> loopFor(ViewPtr<const Block> block) const;
+
+    /**
+     * @brief      Returns if block is a loop header.
+     *
+     * @param      block  The block.
+     *
+     * @return     True if header, False otherwise.
+     */
+    bool isHeader(ViewPtr<const Block> block) const
+    {
+        const auto loop = loopFor(block);
+        return loop && loop->header() == block;
+    }
+
+private:
+    // Data Members
+
+    /// All loops.
+    PtrVector<Loop> m_loops;
+
+    /// Top level loops.
+    Vector<ViewPtr<Loop>> m_topLevel;
+
+    /// The innermost loop of blocks.
+    Map<ViewPtr<const Block>, ViewPtr<Loop>> m_blockLoops;
+};
+
+/* ************************************************************************* */
+
+} // namespace shard::ir
+
+/* ************************************************************************* */
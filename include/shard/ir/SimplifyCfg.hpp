@@ -0,0 +1,61 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+#pragma once
+
+/* ************************************************************************* */
+
+namespace shard::ir {
+
+/* ************************************************************************* */
+
+class Function;
+class Module;
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Simplify function control flow graph.
+ *
+ * @details    Reduces the number of blocks the interpreter has to dispatch:
+ *             conditional branches with constant condition or identical
+ *             targets are turned into unconditional ones, jumps through
+ *             blocks containing only a branch are threaded to the final
+ *             target, a block with single predecessor is merged into that
+ *             predecessor and unreachable blocks are removed.
+ *
+ * @param      function  The function.
+ *
+ * @return     If the function was changed.
+ */
+bool simplifyCfg(Function& function);
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Simplify control flow graph of all module functions.
+ *
+ * @param      module  The module.
+ *
+ * @return     If any function was changed.
+ */
+bool simplifyCfg(Module& module);
+
+/* ************************************************************************* */
+
+} // namespace shard::ir
+
+/* ************************************************************************* */
@@ -18,6 +18,9 @@
 
 /* ************************************************************************* */
 
+// C++
+#include <cstddef>
+
 // Shard
 #include "shard/Assert.hpp"
 #include "shard/Exception.hpp"
@@ -104,6 +107,29 @@ public:
         return m_kind;
     }
 
+    /**
+     * @brief      Returns if types are structurally identical.
+     *
+     * @details    Fundamental types are compared by kind, pointer types by
+     *             the pointee type and struct types field by field.
+     *
+     * @param      other  The other type.
+     *
+     * @return     True if identical, False otherwise.
+     *
+     * @pre        Types are not recursive.
+     */
+    bool equals(const Type& other) const noexcept;
+
+    /**
+     * @brief      Returns structural hash of the type.
+     *
+     * @details    Structurally identical types have the same hash.
+     *
+     * @return     The hash value.
+     */
+    std::size_t hash() const noexcept;
+
     /**
      * @brief      Check if this type is required type.
      *
@@ -0,0 +1,126 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+#pragma once
+
+/* ************************************************************************* */
+
+// C++
+#include <cstdint>
+
+// Shard
+#include "shard/tokenizer/Operator.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::parser {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Binary operator associativity.
+ */
+enum class Associativity : std::uint8_t
+{
+    /// `a + b + c` is `(a + b) + c`.
+    Left,
+
+    /// `a = b = c` is `a = (b = c)`.
+    Right,
+};
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Binary operator parsing properties.
+ */
+struct BinaryOperator
+{
+    /// Binding power, higher binds tighter. Zero for non-operators.
+    std::uint8_t precedence = 0;
+
+    /// Grouping of operators with same precedence.
+    Associativity associativity = Associativity::Left;
+};
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Returns default properties of binary operator.
+ *
+ * @details    Precedences follow C, unknown operators bind weakest.
+ *
+ * @param      op    The operator.
+ *
+ * @return     The operator properties.
+ */
+constexpr BinaryOperator defaultBinaryOperator(tokenizer::Operator op) noexcept
+{
+    using tokenizer::Operator;
+
+    switch (op)
+    {
+    case Operator::Period:
+    case Operator::Arrow:
+    case Operator::ColonColon: return {15, Associativity::Left};
+
+    case Operator::Star:
+    case Operator::Slash:
+    case Operator::Percent: return {13, Associativity::Left};
+
+    case Operator::Plus:
+    case Operator::Minus: return {12, Associativity::Left};
+
+    case Operator::LessLess:
+    case Operator::GreaterGreater: return {11, Associativity::Left};
+
+    case Operator::Less:
+    case Operator::LessEqual:
+    case Operator::Greater:
+    case Operator::GreaterEqual: return {10, Associativity::Left};
+
+    case Operator::EqualEqual:
+    case Operator::ExclaimEqual: return {9, Associativity::Left};
+
+    case Operator::Amp: return {8, Associativity::Left};
+    case Operator::Caret: return {7, Associativity::Left};
+    case Operator::Pipe: return {6, Associativity::Left};
+    case Operator::AmpAmp: return {5, Associativity::Left};
+    case Operator::PipePipe: return {4, Associativity::Left};
+
+    case Operator::Equal:
+    case Operator::PlusEqual:
+    case Operator::MinusEqual:
+    case Operator::StarEqual:
+    case Operator::SlashEqual:
+    case Operator::PercentEqual:
+    case Operator::LessLessEqual:
+    case Operator::GreaterGreaterEqual:
+    case Operator::AmpEqual:
+    case Operator::CaretEqual:
+    case Operator::PipeEqual: return {2, Associativity::Right};
+
+    case Operator::None: return {0, Associativity::Left};
+
+    default: return {1, Associativity::Left};
+    }
+}
+
+/* ************************************************************************* */
+
+} // namespace shard::parser
+
+/* ************************************************************************* */
@@ -19,18 +19,24 @@
 /* ************************************************************************* */
 
 // C++
+#include <cstdint>
 #include <functional>
+#include <stdexcept>
 
 // Shard
+#include "shard/Array.hpp"
 #include "shard/Map.hpp"
-#include "shard/Set.hpp"
+#include "shard/Symbol.hpp"
 #include "shard/UniquePtr.hpp"
+#include "shard/ViewPtr.hpp"
+#include "shard/ast/Context.hpp"
 #include "shard/ast/Decls.hpp"
 #include "shard/ast/Exprs.hpp"
 #include "shard/ast/Source.hpp"
 #include "shard/ast/Stmts.hpp"
+#include "shard/parser/BinaryOperator.hpp"
 #include "shard/parser/exceptions.hpp"
-#include "shard/tokenizer/TokenFilterIterator.hpp"
+#include "shard/tokenizer/TokenBuffer.hpp"
 #include "shard/tokenizer/Tokenizer.hpp"
 
 /* ************************************************************************* */
@@ -50,21 +56,39 @@ public:
     /// Parser extension for statements.
     using StmtHandler = std::function<ast::StmtPtr(Parser&)>;
 
+    /// Flags of supported operators indexed by operator id.
+    using OperatorSet = Array<bool, tokenizer::OperatorCount>;
+
+    /// Binary operator properties indexed by operator id.
+    using BinaryOperatorTable = Array<BinaryOperator, tokenizer::OperatorCount>;
+
 public:
     // Ctors & Dtors
 
     /**
      * @brief      Create a parser.
      *
-     * @param      begin  The begin iterator.
-     * @param      end    The end iterator.
+     * @param      source  The source used for resolving locations.
+     * @param      begin   The begin iterator.
+     * @param      end     The end iterator.
      *
-     * @tparam     IT     Iterator type.
+     * @tparam     IT      Iterator type.
      */
     template<typename IT>
-    explicit Parser(IT begin, IT end)
-        : m_current(begin)
-        , m_end(end)
+    explicit Parser(const tokenizer::Source& source, IT begin, IT end)
+        : m_tokens(source)
+    {
+        for (; begin != end; ++begin)
+            m_tokens.push(*begin);
+    }
+
+    /**
+     * @brief      Create a parser.
+     *
+     * @param      tokens  The tokens to parse.
+     */
+    explicit Parser(tokenizer::TokenBuffer tokens)
+        : m_tokens(std::move(tokens))
     {
         // Nothing to do
     }
@@ -72,10 +96,12 @@ public:
     /**
      * @brief      Create a parser.
      *
+     * @details    The whole input is tokenized at once.
+     *
      * @param      tokenizer  The tokenizer.
      */
     explicit Parser(tokenizer::Tokenizer& tokenizer)
-        : Parser(tokenizer.begin(), tokenizer.end())
+        : Parser(tokenizer.tokenizeAll())
     {
         // Nothing to do
     }
@@ -86,9 +112,9 @@ public:
     /**
      * @brief      Returns supported prefix operators.
      *
-     * @return     The operators.
+     * @return     The operators indexed by operator id.
      */
-    const Set<String>& prefixOperators() const noexcept
+    const OperatorSet& prefixOperators() const noexcept
     {
         return m_prefixOperators;
     }
@@ -98,17 +124,30 @@ public:
      *
      * @param      op    The operator.
      */
-    void addPrefixOperator(String op)
+    void addPrefixOperator(tokenizer::Operator op) noexcept
     {
-        m_prefixOperators.insert(std::move(op));
+        m_prefixOperators[static_cast<std::size_t>(op)] =
+            op != tokenizer::Operator::None;
+    }
+
+    /**
+     * @brief      Add a prefix operator.
+     *
+     * @param      op    The operator spelling.
+     *
+     * @throws     std::invalid_argument  If tokenizer doesn't know operator.
+     */
+    void addPrefixOperator(StringView op)
+    {
+        addPrefixOperator(findOperator(op));
     }
 
     /**
      * @brief      Returns supported suffix operators.
      *
-     * @return     The operators.
+     * @return     The operators indexed by operator id.
      */
-    const Set<String>& postfixOperators() const noexcept
+    const OperatorSet& postfixOperators() const noexcept
     {
         return m_postfixOperators;
     }
@@ -118,17 +157,30 @@ public:
      *
      * @param      op    The operator.
      */
-    void addPostfixOperator(String op)
+    void addPostfixOperator(tokenizer::Operator op) noexcept
+    {
+        m_postfixOperators[static_cast<std::size_t>(op)] =
+            op != tokenizer::Operator::None;
+    }
+
+    /**
+     * @brief      Add a postfix operator.
+     *
+     * @param      op    The operator spelling.
+     *
+     * @throws     std::invalid_argument  If tokenizer doesn't know operator.
+     */
+    void addPostfixOperator(StringView op)
     {
-        m_postfixOperators.insert(std::move(op));
+        addPostfixOperator(findOperator(op));
     }
 
     /**
      * @brief      Returns supported binary operators.
      *
-     * @return     The operators.
+     * @return     The operators indexed by operator id.
      */
-    const Set<String>& binaryOperators() const noexcept
+    const BinaryOperatorTable& binaryOperators() const noexcept
     {
         return m_binaryOperators;
     }
@@ -137,31 +189,116 @@ public:
      * @brief      Add a binary operator.
      *
      * @param      op    The operator.
+     * @param      info  The precedence and associativity.
      */
-    void addBinaryOperator(String op)
+    void addBinaryOperator(tokenizer::Operator op, BinaryOperator info) noexcept
     {
-        m_binaryOperators.insert(std::move(op));
+        if (op != tokenizer::Operator::None)
+            m_binaryOperators[static_cast<std::size_t>(op)] = info;
+    }
+
+    /**
+     * @brief      Add a binary operator with default precedence.
+     *
+     * @param      op    The operator.
+     */
+    void addBinaryOperator(tokenizer::Operator op) noexcept
+    {
+        addBinaryOperator(op, defaultBinaryOperator(op));
+    }
+
+    /**
+     * @brief      Add a binary operator.
+     *
+     * @param      op    The operator spelling.
+     * @param      info  The precedence and associativity.
+     *
+     * @throws     std::invalid_argument  If tokenizer doesn't know operator.
+     */
+    void addBinaryOperator(StringView op, BinaryOperator info)
+    {
+        addBinaryOperator(findOperator(op), info);
+    }
+
+    /**
+     * @brief      Add a binary operator with default precedence.
+     *
+     * @param      op    The operator spelling.
+     *
+     * @throws     std::invalid_argument  If tokenizer doesn't know operator.
+     */
+    void addBinaryOperator(StringView op)
+    {
+        addBinaryOperator(findOperator(op));
     }
 
     /**
      * @brief      Register statement parser.
      *
+     * @details    Keyword starts are dispatched by keyword id.
+     *
      * @param      start    The start token.
      * @param      handler  The handler.
      */
     void addStmtParser(String start, StmtHandler handler)
     {
-        m_stmtParsers.emplace(std::move(start), std::move(handler));
+        if (auto keyword = tokenizer::findKeyword(start);
+            keyword != tokenizer::Keyword::None)
+        {
+            addStmtParser(keyword, std::move(handler));
+        }
+        else
+        {
+            m_stmtParsers.emplace(std::move(start), std::move(handler));
+        }
+    }
+
+    /**
+     * @brief      Register statement parser for keyword.
+     *
+     * @param      keyword  The start keyword.
+     * @param      handler  The handler.
+     */
+    void addStmtParser(tokenizer::Keyword keyword, StmtHandler handler)
+    {
+        auto& slot = m_keywordParsers[static_cast<std::size_t>(keyword)];
+
+        if (!slot)
+            slot = std::move(handler);
     }
 
     /**
      * @brief      Returns current token.
      *
-     * @return     Current token.
+     * @return     Current token or empty token if there are no more tokens.
      */
-    const tokenizer::Token& token() const noexcept
+    tokenizer::Token token() const noexcept
     {
-        return *m_current;
+        return isEmpty() ? tokenizer::Token{} : m_tokens.token(m_index);
+    }
+
+    /**
+     * @brief      Returns symbol of current identifier token.
+     *
+     * @return     The symbol or the empty symbol for other tokens.
+     */
+    Symbol symbol() const noexcept
+    {
+        return isEmpty() ? Symbol{} : m_tokens.symbol(m_index);
+    }
+
+    /**
+     * @brief      Returns token following the current one.
+     *
+     * @param      distance  The distance from current token.
+     *
+     * @return     The token.
+     *
+     * @pre        `position() + distance < tokens().size()`.
+     */
+    tokenizer::Token peek(std::size_t distance = 1) const noexcept
+    {
+        return m_tokens.token(m_index + distance);
     }
 
     /**
@@ -171,20 +308,83 @@ public:
      *
      * @pre        `!isEmpty()`.
      */
-    const tokenizer::Token& next()
+    tokenizer::Token next()
     {
-        ++m_current;
+        ++m_index;
         return token();
     }
 
+    /**
+     * @brief      Returns parsed tokens.
+     *
+     * @return     The tokens.
+     */
+    const tokenizer::TokenBuffer& tokens() const noexcept
+    {
+        return m_tokens;
+    }
+
+    /**
+     * @brief      Returns index of the current token.
+     *
+     * @return     The position.
+     */
+    std::size_t position() const noexcept
+    {
+        return m_index;
+    }
+
+    /**
+     * @brief      Return to previously obtained position.
+     *
+     * @param      position  The position.
+     */
+    void rewind(std::size_t position) noexcept
+    {
+        m_index = position;
+    }
+
+    /**
+     * @brief      Returns the parsed source.
+     *
+     * @return     The source.
+     */
+    const tokenizer::Source& source() const noexcept
+    {
+        return m_tokens.source();
+    }
+
+    /**
+     * @brief      Returns parser's current source offset.
+     *
+     * @return     The offset or source size if there are no more tokens.
+     */
+    std::uint32_t offset() const noexcept
+    {
+        return isEmpty() ? source().size() : m_tokens.offset(m_index);
+    }
+
+    /**
+     * @brief      Returns end offset of the last consumed token.
+     *
+     * @return     The offset or zero if no token was consumed.
+     */
+    std::uint32_t previousEnd() const noexcept
+    {
+        return m_index == 0 ? 0 : m_tokens.end(m_index - 1);
+    }
+
     /**
      * @brief      Returns parser's current source location.
      *
+     * @details    The location is resolved from the line table so it should
+     *             be used only for error reporting.
+     *
      * @return     The location.
      */
     SourceLocation location() const noexcept
     {
-        return m_current->location();
+        return source().location(offset());
     }
 
     /**
@@ -194,7 +394,7 @@ public:
      */
     bool isEmpty() const noexcept
     {
-        return m_current == m_end;
+        return m_index >= m_tokens.size();
     }
 
     /**
@@ -208,7 +408,7 @@ public:
      */
     bool is(tokenizer::TokenType type) const noexcept
     {
-        return token().type() == type;
+        return !isEmpty() && m_tokens.type(m_index) == type;
     }
 
     /**
@@ -223,7 +423,7 @@ public:
      */
     bool is(tokenizer::TokenType type, const String& value) const noexcept
     {
-        return token().type() == type && token().value() == value;
+        return is(type) && m_tokens.value(m_index) == value;
     }
 
     /**
@@ -288,6 +488,20 @@ public:
         return is(tokenizer::TokenType::Identifier, value);
     }
 
+    /**
+     * @brief      Test if current token is given keyword.
+     *
+     * @param      keyword  The keyword.
+     *
+     * @return     If token keyword matches.
+     *
+     * @pre        `!isEmpty()`.
+     */
+    bool isKeyword(tokenizer::Keyword keyword) const noexcept
+    {
+        return !isEmpty() && m_tokens.keyword(m_index) == keyword;
+    }
+
     /**
      * @brief      Test if current token is other type of token and value.
      *
@@ -308,6 +522,9 @@ public:
     /**
      * @brief      Make node for AST
      *
+     * @details    Node is created in parser's context and lives until the
+     *             parser or the parsed source is destroyed.
+     *
      * @param      args  The construction arguments.
      *
      * @tparam     T     Created type.
@@ -316,9 +533,9 @@ public:
      * @return     Created node.
      */
     template<typename T, typename... Args>
-    UniquePtr<T> make(Args&&... args)
+    ast::NodePtr<T> make(Args&&... args)
     {
-        return makeUnique<T>(std::forward<Args>(args)...);
+        return m_context->make<T>(std::forward<Args>(args)...);
     }
 
     /**
@@ -384,6 +601,21 @@ public:
      */
     ast::ExprPtr parseBinaryExpr();
 
+    /**
+     * @brief      Parse a binary expression with operators binding at least
+     *             with given precedence.
+     *
+     * @details    Operators with the same precedence are folded in a loop so
+     *             left associative chains don't nest calls.
+     *
+     * @param      precedence  The minimum precedence.
+     *
+     * @return     The parsed expr.
+     *
+     * @throws     ParserError  In case of parsing error.
+     */
+    ast::ExprPtr parseBinaryExpr(unsigned precedence);
+
     /**
      * @brief      Parse an expression from current state.
      *
@@ -396,6 +628,8 @@ public:
     /**
      * @brief      Parse a source from current state.
      *
+     * @details    The source takes ownership of all nodes made so far.
+     *
      * @return     The result source.
      *
      * @throws     ParserError  In case of parsing error.
@@ -554,6 +788,21 @@ public:
         return match(isIdentifier(value));
     }
 
+    /**
+     * @brief      Test if current token is given keyword and advance if is
+     *             true.
+     *
+     * @param      keyword  The keyword.
+     *
+     * @return     If current token matches.
+     *
+     * @pre        `!isEmpty()`.
+     */
+    bool matchKeyword(tokenizer::Keyword keyword)
+    {
+        return match(isKeyword(keyword));
+    }
+
     /**
      * @brief      Test if current token is other type of token and value and
      *             advance if is true.
@@ -657,6 +906,18 @@ public:
         check(isIdentifier(value));
     }
 
+    /**
+     * @brief      Check specified keyword and throw if token is not found.
+     *
+     * @param      keyword  The keyword.
+     *
+     * @throws     ParseError  If current token doesn't match requirements.
+     */
+    void checkKeyword(tokenizer::Keyword keyword)
+    {
+        check(isKeyword(keyword));
+    }
+
     /**
      * @brief      Check specified token and throw if token is not found.
      *
@@ -753,6 +1014,19 @@ public:
         check(matchIdentifier(value));
     }
 
+    /**
+     * @brief      Require specified keyword and throw if token is not found and
+     *             advance if is true.
+     *
+     * @param      keyword  The keyword.
+     *
+     * @throws     ParseError  If current token doesn't match requirements.
+     */
+    void requireKeyword(tokenizer::Keyword keyword)
+    {
+        check(matchKeyword(keyword));
+    }
+
     /**
      * @brief      Require specified token and throw if token is not found and
      *             advance if is true.
@@ -766,6 +1040,21 @@ public:
         check(matchOther(value));
     }
 
+    /**
+     * @brief      Check if current token is one of operators.
+     *
+     * @param      operators  The operators.
+     *
+     * @return     True if operator is in set, False otherwise.
+     */
+    bool isOperator(const OperatorSet& operators) const noexcept
+    {
+        if (isEmpty())
+            return false;
+
+        return operators[static_cast<std::size_t>(m_tokens.op(m_index))];
+    }
+
     /**
      * @brief      Check if current token is prefix operator.
      *
@@ -773,7 +1062,7 @@ public:
      */
     bool isPrefixOperator() const noexcept
     {
-        return m_prefixOperators.count(m_current->value()) > 0;
+        return isOperator(m_prefixOperators);
     }
 
     /**
@@ -783,7 +1072,7 @@ public:
      */
     bool isPostfixOperator() const noexcept
     {
-        return m_postfixOperators.count(m_current->value()) > 0;
+        return isOperator(m_postfixOperators);
     }
 
     /**
@@ -793,12 +1082,49 @@ public:
      */
     bool isBinaryOperator() const noexcept
     {
-        return m_binaryOperators.count(m_current->value()) > 0;
+        return binaryOperator().precedence > 0;
+    }
+
+    /**
+     * @brief      Returns properties of current binary operator.
+     *
+     * @return     The properties, zero precedence if token isn't operator.
+     */
+    BinaryOperator binaryOperator() const noexcept
+    {
+        if (isEmpty())
+            return {};
+
+        const auto op = static_cast<std::size_t>(m_tokens.op(m_index));
+
+        return m_binaryOperators[op];
     }
 
 private:
     // Operations
 
+    /**
+     * @brief      Finds operator by spelling.
+     *
+     * @param      op    The operator spelling.
+     *
+     * @return     The operator.
+     *
+     * @throws     std::invalid_argument  If tokenizer doesn't know operator.
+     */
+    static tokenizer::Operator findOperator(StringView op)
+    {
+        const auto result = tokenizer::findOperator(op);
+
+        if (result == tokenizer::Operator::None)
+        {
+            throw std::invalid_argument(
+                "unknown operator '" + String(op) + "'");
+        }
+
+        return result;
+    }
+
     /**
      * @brief      Advance or not depending on given value.
      *
@@ -828,40 +1154,37 @@ private:
         if (!check)
         {
             throw ParseError(
-                "unexpected token '" + m_current->value() + "'",
-                m_current->location());
+                "unexpected token '" + String(token().value()) + "'",
+                location());
         }
     }
 
-private:
-    // Types
-
-    /// Internal iterator
-    using Iterator = tokenizer::TokenFilterIterator<
-        tokenizer::TokenType::Comment,
-        tokenizer::TokenType::WhiteSpace,
-        tokenizer::TokenType::EndOfLine>;
-
 private:
     // Data Members
 
-    /// Current position
-    Iterator m_current;
+    /// Parsed tokens.
+    tokenizer::TokenBuffer m_tokens;
+
+    /// Current token index.
+    std::size_t m_index = 0;
 
-    /// End position
-    Iterator m_end;
+    /// Owner of created nodes.
+    UniquePtr<ast::Context> m_context = makeUnique<ast::Context>();
 
     /// A set of prefix operators.
-    Set<String> m_prefixOperators;
+    OperatorSet m_prefixOperators{};
 
     /// A set of postfix operators.
-    Set<String> m_postfixOperators;
+    OperatorSet m_postfixOperators{};
 
     /// A set of binary operators.
-    Set<String> m_binaryOperators;
+    BinaryOperatorTable m_binaryOperators{};
 
     /// Statement handlers.
-    Map<String, StmtHandler> m_stmtParsers;
+    Map<String, StmtHandler, std::less<>> m_stmtParsers;
+
+    /// Statement handlers indexed by keyword.
+    Array<StmtHandler, tokenizer::KeywordCount> m_keywordParsers;
 };
 
 /* ************************************************************************* */
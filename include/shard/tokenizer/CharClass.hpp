@@ -0,0 +1,174 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+#pragma once
+
+/* ************************************************************************* */
+
+// C++
+#include <cstdint>
+
+// Shard
+#include "shard/Array.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::tokenizer::chars {
+
+/* ************************************************************************* */
+
+/// Character class flags.
+enum Class : std::uint8_t
+{
+    /// Letter: [a-zA-Z]
+    Letter = 1 << 0,
+
+    /// Digit: [0-9]
+    Digit = 1 << 1,
+
+    /// Underscore.
+    Underscore = 1 << 2,
+
+    /// Space or tab.
+    Whitespace = 1 << 3,
+
+    /// New line.
+    EndOfLine = 1 << 4,
+};
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Builds classification table.
+ *
+ * @return     The table indexed by unsigned character value.
+ */
+constexpr Array<std::uint8_t, 256> makeTable() noexcept
+{
+    Array<std::uint8_t, 256> table{};
+
+    for (int chr = 'a'; chr <= 'z'; ++chr)
+        table[chr] |= Letter;
+
+    for (int chr = 'A'; chr <= 'Z'; ++chr)
+        table[chr] |= Letter;
+
+    for (int chr = '0'; chr <= '9'; ++chr)
+        table[chr] |= Digit;
+
+    table['_'] |= Underscore;
+    table[' '] |= Whitespace;
+    table['\t'] |= Whitespace;
+    table['\n'] |= EndOfLine;
+
+    return table;
+}
+
+/* ************************************************************************* */
+
+/// Character classification table.
+inline constexpr Array<std::uint8_t, 256> Table = makeTable();
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Test if character belongs to any of given classes.
+ *
+ * @param      chr      The character.
+ * @param      classes  The class flags.
+ *
+ * @return     If character matches.
+ */
+constexpr bool is(char chr, std::uint8_t classes) noexcept
+{
+    return (Table[static_cast<unsigned char>(chr)] & classes) != 0;
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Test if character is a letter.
+ *
+ * @param      chr   The character.
+ *
+ * @return     If character matches.
+ */
+constexpr bool isLetter(char chr) noexcept
+{
+    return is(chr, Letter);
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Test if character is a digit.
+ *
+ * @param      chr   The character.
+ *
+ * @return     If character matches.
+ */
+constexpr bool isDigit(char chr) noexcept
+{
+    return is(chr, Digit);
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Test if character can start an identifier.
+ *
+ * @param      chr   The character.
+ *
+ * @return     If character matches.
+ */
+constexpr bool isIdentifierStart(char chr) noexcept
+{
+    return is(chr, Letter | Underscore);
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Test if character is a letter, digit or '_'.
+ *
+ * @param      chr   The character.
+ *
+ * @return     If character matches.
+ */
+constexpr bool isIdentifier(char chr) noexcept
+{
+    return is(chr, Letter | Digit | Underscore);
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Test if character is space or tab.
+ *
+ * @param      chr   The character.
+ *
+ * @return     If character matches.
+ */
+constexpr bool isWhitespace(char chr) noexcept
+{
+    return is(chr, Whitespace);
+}
+
+/* ************************************************************************* */
+
+} // namespace shard::tokenizer::chars
+
+/* ************************************************************************* */
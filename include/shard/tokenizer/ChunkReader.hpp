@@ -0,0 +1,156 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+#pragma once
+
+/* ************************************************************************* */
+
+// C++
+#include <cstddef>
+#include <iosfwd>
+#include <system_error>
+
+// Shard
+#include "shard/String.hpp"
+#include "shard/Vector.hpp"
+#include "shard/ViewPtr.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::tokenizer {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Reads input in fixed size chunks.
+ *
+ * @details    Line endings are normalized on the fly, CRLF split between two
+ *             chunks is handled by remembering the trailing CR.
+ */
+class ChunkReader
+{
+public:
+    // Constants
+
+    /// Default chunk size.
+    static constexpr std::size_t DefaultChunkSize = 64 * 1024;
+
+public:
+    // Ctors & Dtors
+
+    /**
+     * @brief      Constructor.
+     *
+     * @param      input      The input stream.
+     * @param      chunkSize  The chunk size.
+     */
+    explicit ChunkReader(
+        std::istream& input,
+        std::size_t chunkSize = DefaultChunkSize);
+
+    /**
+     * @brief      Constructor.
+     *
+     * @details    The reader doesn't take ownership of the descriptor.
+     *
+     * @param      fd         The POSIX file descriptor.
+     * @param      chunkSize  The chunk size.
+     */
+    explicit ChunkReader(int fd, std::size_t chunkSize = DefaultChunkSize);
+
+public:
+    // Accessors & Mutators
+
+    /**
+     * @brief      Returns if whole input was read.
+     *
+     * @return     True if empty, False otherwise.
+     */
+    bool isEmpty() const noexcept
+    {
+        return m_empty;
+    }
+
+    /**
+     * @brief      Returns if reading of the input failed.
+     *
+     * @return     True if failed, False otherwise.
+     */
+    bool isFailed() const noexcept
+    {
+        return static_cast<bool>(m_error);
+    }
+
+public:
+    // Operations
+
+    /**
+     * @brief      Appends next chunk to output.
+     *
+     * @param      output  The output string.
+     *
+     * @return     Number of appended characters, zero at end of input.
+     *
+     * @throws     std::system_error  When reading fails, now or previously.
+     */
+    std::size_t read(String& output);
+
+private:
+    // Operations
+
+    /**
+     * @brief      Reads raw data from input.
+     *
+     * @return     Number of read bytes, zero at end of input.
+     *
+     * @throws     std::system_error  When reading fails.
+     */
+    std::size_t readRaw();
+
+    /**
+     * @brief      Remembers the read error and throws it.
+     *
+     * @param      error  The error.
+     */
+    [[noreturn]] void fail(std::error_code error);
+
+private:
+    // Data Members
+
+    /// Input stream.
+    ViewPtr<std::istream> m_input;
+
+    /// Input file descriptor.
+    int m_fd = -1;
+
+    /// Raw data buffer.
+    Vector<char> m_buffer;
+
+    /// If the last read chunk ends with CR.
+    bool m_carriageReturn = false;
+
+    /// If the input is exhausted.
+    bool m_empty = false;
+
+    /// Read error.
+    std::error_code m_error;
+};
+
+/* ************************************************************************* */
+
+} // namespace shard::tokenizer
+
+/* ************************************************************************* */
@@ -0,0 +1,252 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+#pragma once
+
+/* ************************************************************************* */
+
+// C++
+#include <cstddef>
+#include <cstdint>
+
+// Shard
+#include "shard/Array.hpp"
+#include "shard/StringView.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::tokenizer {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Language keywords recognized by tokenizer.
+ */
+enum class Keyword : std::uint8_t
+{
+    /// Not a keyword.
+    None,
+
+    Break,
+    Class,
+    Const,
+    Continue,
+    Else,
+    False,
+    Func,
+    If,
+    Namespace,
+    Null,
+    Return,
+    True,
+    Var,
+    While,
+};
+
+/* ************************************************************************* */
+
+/// Number of keyword values including `Keyword::None`.
+inline constexpr std::size_t KeywordCount =
+    static_cast<std::size_t>(Keyword::While) + 1;
+
+/* ************************************************************************* */
+
+/// Keyword spellings indexed by keyword value.
+inline constexpr Array<StringView, KeywordCount> KeywordNames = {
+    "",
+    "break",
+    "class",
+    "const",
+    "continue",
+    "else",
+    "false",
+    "func",
+    "if",
+    "namespace",
+    "null",
+    "return",
+    "true",
+    "var",
+    "while",
+};
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Returns keyword spelling.
+ *
+ * @param      keyword  The keyword.
+ *
+ * @return     The spelling, empty for `Keyword::None`.
+ */
+constexpr StringView keywordName(Keyword keyword) noexcept
+{
+    return KeywordNames[static_cast<std::size_t>(keyword)];
+}
+
+/* ************************************************************************* */
+
+namespace detail {
+
+/* ************************************************************************* */
+
+/// Number of bits of the keyword hash.
+inline constexpr unsigned KeywordHashBits = 5;
+
+/// Shortest keyword length.
+inline constexpr std::size_t KeywordMinLength = 2;
+
+/// Longest keyword length.
+inline constexpr std::size_t KeywordMaxLength = 9;
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Hashes identifier by its length, first two and last character.
+ *
+ * @param      value  The identifier, at least `KeywordMinLength` long.
+ * @param      seed   The hash seed.
+ *
+ * @return     The hash in range [0, 2^KeywordHashBits).
+ */
+constexpr std::uint32_t keywordHash(
+    StringView value,
+    std::uint32_t seed) noexcept
+{
+    // FNV-1a step
+    constexpr auto mix = [](std::uint32_t hash, std::uint32_t data) {
+        return (hash ^ data) * 0x01000193;
+    };
+
+    std::uint32_t hash = mix(seed, value.size());
+    hash               = mix(hash, static_cast<unsigned char>(value[0]));
+    hash               = mix(hash, static_cast<unsigned char>(value[1]));
+    hash               = mix(hash, static_cast<unsigned char>(value.back()));
+
+    return hash >> (32 - KeywordHashBits);
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Test if seed gives a collision-free hash for all keywords.
+ *
+ * @param      seed  The seed.
+ *
+ * @return     If hash is perfect.
+ */
+constexpr bool isPerfectSeed(std::uint32_t seed) noexcept
+{
+    Array<bool, 1 << KeywordHashBits> used{};
+
+    for (std::size_t i = 1; i < KeywordCount; ++i)
+    {
+        const auto hash = keywordHash(KeywordNames[i], seed);
+
+        if (used[hash])
+            return false;
+
+        used[hash] = true;
+    }
+
+    return true;
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Finds first seed giving a perfect hash.
+ *
+ * @return     The seed.
+ */
+constexpr std::uint32_t findPerfectSeed() noexcept
+{
+    std::uint32_t seed = 0;
+
+    while (!isPerfectSeed(seed))
+        ++seed;
+
+    return seed;
+}
+
+/* ************************************************************************* */
+
+/// Seed of the keyword perfect hash.
+inline constexpr std::uint32_t KeywordSeed = findPerfectSeed();
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Builds keyword lookup table indexed by hash.
+ *
+ * @return     The table.
+ */
+constexpr Array<Keyword, 1 << KeywordHashBits> makeKeywordTable() noexcept
+{
+    Array<Keyword, 1 << KeywordHashBits> table{};
+
+    for (std::size_t i = 1; i < KeywordCount; ++i)
+        table[keywordHash(KeywordNames[i], KeywordSeed)] = Keyword(i);
+
+    return table;
+}
+
+/* ************************************************************************* */
+
+/// Keyword lookup table.
+inline constexpr Array<Keyword, 1 << KeywordHashBits> KeywordTable =
+    makeKeywordTable();
+
+/* ************************************************************************* */
+
+} // namespace detail
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Finds keyword by identifier spelling.
+ *
+ * @details    Uses compile-time perfect hash so a lookup costs one hash, one
+ *             table load and one string compare.
+ *
+ * @param      value  The identifier.
+ *
+ * @return     The keyword or `Keyword::None`.
+ */
+constexpr Keyword findKeyword(StringView value) noexcept
+{
+    if (value.size() < detail::KeywordMinLength ||
+        value.size() > detail::KeywordMaxLength)
+    {
+        return Keyword::None;
+    }
+
+    const auto keyword =
+        detail::KeywordTable[detail::keywordHash(value, detail::KeywordSeed)];
+
+    return keywordName(keyword) == value ? keyword : Keyword::None;
+}
+
+/* ************************************************************************* */
+
+static_assert(findKeyword("while") == Keyword::While);
+static_assert(findKeyword("whilst") == Keyword::None);
+
+/* ************************************************************************* */
+
+} // namespace shard::tokenizer
+
+/* ************************************************************************* */
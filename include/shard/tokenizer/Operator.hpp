@@ -0,0 +1,319 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+#pragma once
+
+/* ************************************************************************* */
+
+// C++
+#include <cstddef>
+#include <cstdint>
+
+// Shard
+#include "shard/Array.hpp"
+#include "shard/StringView.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::tokenizer {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Operators and punctuators recognized by tokenizer.
+ */
+enum class Operator : std::uint8_t
+{
+    /// Not an operator.
+    None,
+
+    Exclaim,
+    ExclaimEqual,
+    Percent,
+    PercentEqual,
+    Amp,
+    AmpAmp,
+    AmpEqual,
+    LeftParen,
+    RightParen,
+    Star,
+    StarEqual,
+    Plus,
+    PlusPlus,
+    PlusEqual,
+    Comma,
+    Minus,
+    MinusMinus,
+    MinusEqual,
+    Arrow,
+    Period,
+    Slash,
+    SlashEqual,
+    Colon,
+    ColonColon,
+    Semicolon,
+    Less,
+    LessLess,
+    LessLessEqual,
+    LessEqual,
+    Equal,
+    EqualEqual,
+    Greater,
+    GreaterEqual,
+    GreaterGreater,
+    GreaterGreaterEqual,
+    Question,
+    LeftBracket,
+    RightBracket,
+    Caret,
+    CaretEqual,
+    LeftBrace,
+    Pipe,
+    PipeEqual,
+    PipePipe,
+    RightBrace,
+    Tilde,
+};
+
+/* ************************************************************************* */
+
+/// Number of operator values including `Operator::None`.
+inline constexpr std::size_t OperatorCount =
+    static_cast<std::size_t>(Operator::Tilde) + 1;
+
+/* ************************************************************************* */
+
+/// Operator spellings indexed by operator value.
+inline constexpr Array<StringView, OperatorCount> OperatorNames = {
+    "",
+    "!",
+    "!=",
+    "%",
+    "%=",
+    "&",
+    "&&",
+    "&=",
+    "(",
+    ")",
+    "*",
+    "*=",
+    "+",
+    "++",
+    "+=",
+    ",",
+    "-",
+    "--",
+    "-=",
+    "->",
+    ".",
+    "/",
+    "/=",
+    ":",
+    "::",
+    ";",
+    "<",
+    "<<",
+    "<<=",
+    "<=",
+    "=",
+    "==",
+    ">",
+    ">=",
+    ">>",
+    ">>=",
+    "?",
+    "[",
+    "]",
+    "^",
+    "^=",
+    "{",
+    "|",
+    "|=",
+    "||",
+    "}",
+    "~",
+};
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Returns operator spelling.
+ *
+ * @param      op    The operator.
+ *
+ * @return     The spelling, empty for `Operator::None`.
+ */
+constexpr StringView operatorName(Operator op) noexcept
+{
+    return OperatorNames[static_cast<std::size_t>(op)];
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Result of operator matching.
+ */
+struct OperatorMatch
+{
+    /// Matched operator.
+    Operator op = Operator::None;
+
+    /// Number of matched characters.
+    std::size_t length = 0;
+};
+
+/* ************************************************************************* */
+
+namespace detail {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Operator trie.
+ *
+ * @details    Node 0 is the root. Transitions are indexed by operator
+ *             character index, zero means there is no transition.
+ */
+struct OperatorTrie
+{
+    /// Maximum number of nodes, every operator adds at most one node.
+    static constexpr std::size_t NodeCount = OperatorCount;
+
+    /// Number of distinct operator characters.
+    static constexpr std::size_t CharCount = 24;
+
+    /// Operator character index + 1, zero for other characters.
+    Array<std::uint8_t, 128> chars{};
+
+    /// Node transitions.
+    Array<Array<std::uint8_t, CharCount>, NodeCount> next{};
+
+    /// Operator recognized in node.
+    Array<Operator, NodeCount> accept{};
+};
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Builds operator trie from operator spellings.
+ *
+ * @details    Every operator prefix must be an operator too, which keeps the
+ *             number of nodes equal to the number of operators.
+ *
+ * @return     The trie.
+ */
+constexpr OperatorTrie makeOperatorTrie() noexcept
+{
+    OperatorTrie trie{};
+    std::size_t chars = 0;
+    std::size_t nodes = 1;
+
+    for (std::size_t i = 1; i < OperatorCount; ++i)
+    {
+        std::size_t node = 0;
+
+        for (char chr : OperatorNames[i])
+        {
+            auto& index = trie.chars[static_cast<unsigned char>(chr)];
+
+            if (!index)
+                index = ++chars;
+
+            auto& next = trie.next[node][index - 1];
+
+            if (!next)
+                next = nodes++;
+
+            node = next;
+        }
+
+        trie.accept[node] = Operator(i);
+    }
+
+    return trie;
+}
+
+/* ************************************************************************* */
+
+/// Operator lookup trie.
+inline constexpr OperatorTrie OperatorTable = makeOperatorTrie();
+
+/* ************************************************************************* */
+
+} // namespace detail
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Finds the longest operator at the beginning of text.
+ *
+ * @param      text  The text.
+ *
+ * @return     The operator and its length or `Operator::None`.
+ */
+constexpr OperatorMatch matchOperator(StringView text) noexcept
+{
+    const auto& trie = detail::OperatorTable;
+
+    OperatorMatch result;
+    std::size_t node = 0;
+
+    for (std::size_t i = 0; i < text.size(); ++i)
+    {
+        const auto chr = static_cast<unsigned char>(text[i]);
+
+        if (chr >= trie.chars.size() || !trie.chars[chr])
+            break;
+
+        node = trie.next[node][trie.chars[chr] - 1];
+
+        if (!node)
+            break;
+
+        if (trie.accept[node] != Operator::None)
+            result = OperatorMatch{trie.accept[node], i + 1};
+    }
+
+    return result;
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Finds operator by spelling.
+ *
+ * @param      value  The spelling.
+ *
+ * @return     The operator or `Operator::None`.
+ */
+constexpr Operator findOperator(StringView value) noexcept
+{
+    const auto match = matchOperator(value);
+
+    return match.length == value.size() ? match.op : Operator::None;
+}
+
+/* ************************************************************************* */
+
+static_assert(findOperator("<<=") == Operator::LessLessEqual);
+static_assert(findOperator("=>") == Operator::None);
+static_assert(matchOperator("->x").op == Operator::Arrow);
+
+/* ************************************************************************* */
+
+} // namespace shard::tokenizer
+
+/* ************************************************************************* */
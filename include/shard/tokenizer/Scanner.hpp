@@ -0,0 +1,101 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+#pragma once
+
+/* ************************************************************************* */
+
+// C++
+#include <cstddef>
+
+/* ************************************************************************* */
+
+namespace shard::tokenizer {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Skips run of spaces and tabs.
+ *
+ * @details    The scanning functions process 16 or 32 bytes at once when the
+ *             host supports SSE2 or AVX2, the implementation is selected at
+ *             runtime. Otherwise a scalar loop is used.
+ *
+ * @param      data      The source data.
+ * @param      position  The start position.
+ * @param      end       The end position.
+ *
+ * @return     Position of the first character which is not whitespace or
+ *             `end`.
+ */
+std::size_t scanWhitespace(
+    const char* data,
+    std::size_t position,
+    std::size_t end) noexcept;
+
+/**
+ * @brief      Skips run of identifier characters (`[a-zA-Z0-9_]`).
+ *
+ * @param      data      The source data.
+ * @param      position  The start position.
+ * @param      end       The end position.
+ *
+ * @return     Position of the first non-identifier character or `end`.
+ */
+std::size_t scanIdentifier(
+    const char* data,
+    std::size_t position,
+    std::size_t end) noexcept;
+
+/**
+ * @brief      Finds a character.
+ *
+ * @param      data      The source data.
+ * @param      position  The start position.
+ * @param      end       The end position.
+ * @param      chr       The searched character.
+ *
+ * @return     Position of the character or `end`.
+ */
+std::size_t scanUntil(
+    const char* data,
+    std::size_t position,
+    std::size_t end,
+    char chr) noexcept;
+
+/**
+ * @brief      Finds one of two characters.
+ *
+ * @param      data      The source data.
+ * @param      position  The start position.
+ * @param      end       The end position.
+ * @param      chr1      The first searched character.
+ * @param      chr2      The second searched character.
+ *
+ * @return     Position of the first found character or `end`.
+ */
+std::size_t scanUntilAny(
+    const char* data,
+    std::size_t position,
+    std::size_t end,
+    char chr1,
+    char chr2) noexcept;
+
+/* ************************************************************************* */
+
+} // namespace shard::tokenizer
+
+/* ************************************************************************* */
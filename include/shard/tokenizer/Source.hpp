@@ -18,10 +18,20 @@
 
 /* ************************************************************************* */
 
+// C++
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
 // Shard
 #include "shard/FilePath.hpp"
+#include "shard/LineTable.hpp"
 #include "shard/SourceLocation.hpp"
 #include "shard/String.hpp"
+#include "shard/StringView.hpp"
+#include "shard/UniquePtr.hpp"
 #include "shard/Vector.hpp"
 #include "shard/tokenizer/SourceIterator.hpp"
 
@@ -33,9 +43,25 @@ namespace shard::tokenizer {
 
 /**
  * @brief Streams data from various types of input.
+ *
+ * @details Source either owns the code, in which case CRLF is replaced by LF
+ *          in place, or refers to memory mapped file. Mapped files are never
+ *          modified and the tokenizer treats CRLF as a single new line.
+ *
+ *          Owned code keeps a gap at the last edit so replacement moves only
+ *          the text between the previous and the current edit. Views must
+ *          not span the gap, functions returning them move the gap out of the
+ *          requested range which invalidates views into the moved text.
  */
 class Source
 {
+public:
+    // Constants
+
+    /// Maximum source size, offsets are stored as 32-bit integers.
+    static constexpr std::size_t MaxSize =
+        std::numeric_limits<std::uint32_t>::max();
+
 public:
     // Ctors & Dtors
 
@@ -44,25 +70,48 @@ public:
      *
      * @param      source    The source code.
      * @param      filename  The source filename.
+     *
+     * @throws     std::length_error  If source is larger than `MaxSize`.
      */
-    explicit Source(const String& source, FilePath filename = "<input>")
-        : m_filename(std::move(filename))
+    explicit Source(String source, FilePath filename = "<input>")
+        : m_buffer(std::move(source))
+        , m_filename(std::move(filename))
     {
+        checkSize(m_buffer.size(), m_filename);
+
         // Process source code
-        process(source);
+        process();
     }
 
+    /**
+     * @brief      Source cannot be copied, it may refer to own buffer.
+     */
+    Source(const Source&) = delete;
+
+    /**
+     * @brief      Destructor.
+     */
+    ~Source();
+
 public:
     // Operators
 
+    /**
+     * @brief      Source cannot be copied, it may refer to own buffer.
+     */
+    Source& operator=(const Source&) = delete;
+
     /**
      * @brief      Returns character at given position.
      *
+     * @details    Position equal to size returns `\0` as the mapped file
+     *             doesn't have terminating character.
+     *
      * @return     The character.
      */
     char operator[](std::size_t position) const noexcept
     {
-        return m_source[position];
+        return position < m_size ? m_data[physical(position)] : '\0';
     }
 
 public:
@@ -71,11 +120,34 @@ public:
     /**
      * @brief      Returns the source.
      *
+     * @details    The gap is moved to the end.
+     *
      * @return     The source.
      */
-    const String& source() const noexcept
+    StringView source() const noexcept
+    {
+        moveGap(m_size);
+        return StringView(m_data, m_size);
+    }
+
+    /**
+     * @brief      Returns pointer to the source data.
+     *
+     * @return     The data, valid up to `gap()`.
+     */
+    const char* data() const noexcept
+    {
+        return m_data;
+    }
+
+    /**
+     * @brief      Returns position of the gap.
+     *
+     * @return     The position, `size()` if there is no gap.
+     */
+    std::size_t gap() const noexcept
     {
-        return m_source;
+        return m_gapSize ? m_gap : m_size;
     }
 
     /**
@@ -95,17 +167,53 @@ public:
      */
     std::size_t size() const noexcept
     {
-        return m_source.size();
+        return m_size;
     }
 
     /**
      * @brief      Returns character at given position.
      *
      * @return     The character.
+     *
+     * @throws     std::out_of_range  If position is not in the source.
      */
     char at(std::size_t position) const
     {
-        return m_source.at(position);
+        if (position >= m_size)
+            throw std::out_of_range("source position out of range");
+
+        return m_data[physical(position)];
+    }
+
+    /**
+     * @brief      Returns if source refers to memory mapped file.
+     *
+     * @return     True if mapped, False otherwise.
+     */
+    bool isMapped() const noexcept
+    {
+        return m_mapping != nullptr;
+    }
+
+    /**
+     * @brief      Returns part of the source.
+     *
+     * @param      position  The start position.
+     * @param      length    The length.
+     *
+     * @return     View into the source.
+     *
+     * @pre        `position <= size()`.
+     */
+    StringView view(std::size_t position, std::size_t length) const noexcept
+    {
+        length = std::min(length, m_size - position);
+
+        // Gap is moved after the range
+        if (position < gap() && position + length > gap())
+            moveGap(position + length);
+
+        return StringView(m_data + physical(position), length);
     }
 
     /**
@@ -125,7 +233,17 @@ public:
      */
     SourceIterator end() const noexcept
     {
-        return SourceIterator(*this, m_source.size());
+        return SourceIterator(*this, m_size);
+    }
+
+    /**
+     * @brief      Returns the line table.
+     *
+     * @return     The line table.
+     */
+    const LineTable& lines() const noexcept
+    {
+        return m_lines;
     }
 
     /**
@@ -135,29 +253,129 @@ public:
      *
      * @return     The source location.
      */
-    SourceLocation location(std::size_t position) const noexcept;
+    SourceLocation location(std::size_t position) const noexcept
+    {
+        return m_lines.location(position);
+    }
+
+public:
+    // Operations
+
+    /**
+     * @brief      Replaces part of the source.
+     *
+     * @details    Mapped source is copied into owned buffer first. The gap is
+     *             moved to the replaced text and the new text is written into
+     *             it, the gap stays after the new text. Line table is patched,
+     *             not rebuilt.
+     *
+     * @param      offset  Offset of the replaced text.
+     * @param      length  Length of the replaced text.
+     * @param      text    The new text.
+     *
+     * @throws     std::length_error  If the result is larger than `MaxSize`.
+     */
+    void replace(std::size_t offset, std::size_t length, StringView text);
+
+    /**
+     * @brief      Moves the gap to position.
+     *
+     * @details    Logically constant, only the text between the old and new
+     *             position is moved. Views into the moved text are invalidated.
+     *
+     * @param      position  The position.
+     */
+    void moveGap(std::size_t position) const noexcept;
+
+    /**
+     * @brief      Creates source from file.
+     *
+     * @details    On POSIX hosts the file is memory mapped so LF-only files are
+     *             tokenized without copying. Otherwise the file is read.
+     *
+     * @param      path  The file path.
+     *
+     * @return     The source or nullptr if file cannot be read.
+     *
+     * @throws     std::length_error  If file is larger than `MaxSize`.
+     */
+    static UniquePtr<Source> fromFile(const FilePath& path);
+
+private:
+    // Ctors & Dtors
+
+    /**
+     * @brief      Constructor for mapped file.
+     *
+     * @param      mapping   The mapped memory.
+     * @param      size      The mapping size.
+     * @param      filename  The source filename.
+     */
+    Source(const char* mapping, std::size_t size, FilePath filename);
 
 private:
     // Operations
 
     /**
-     * @brief      Process input source.
+     * @brief      Returns storage position of the character.
+     *
+     * @param      position  The position.
+     *
+     * @return     The storage position.
+     */
+    std::size_t physical(std::size_t position) const noexcept
+    {
+        return position < m_gap ? position : position + m_gapSize;
+    }
+
+    /**
+     * @brief      Normalizes line endings in place and builds line table.
+     */
+    void process();
+
+    /**
+     * @brief      Reallocates buffer with a larger gap.
      *
-     * @param      source  The source.
+     * @param      count  The minimum size of the gap.
      */
-    void process(const String& source);
+    void grow(std::size_t count);
+
+    /**
+     * @brief      Rejects source which offsets don't fit into 32 bits.
+     *
+     * @param      size      The source size.
+     * @param      filename  The source filename.
+     *
+     * @throws     std::length_error  If size is larger than `MaxSize`.
+     */
+    static void checkSize(std::size_t size, const FilePath& filename);
 
 private:
     // Data Members
 
-    /// Source code.
-    String m_source;
+    /// Owned source code with the gap.
+    mutable String m_buffer;
+
+    /// Source code, refers either to buffer or mapping.
+    const char* m_data = nullptr;
+
+    /// Source size without the gap.
+    std::size_t m_size = 0;
+
+    /// Position of the gap.
+    mutable std::size_t m_gap = 0;
+
+    /// Size of the gap.
+    std::size_t m_gapSize = 0;
+
+    /// Mapped file memory.
+    const char* m_mapping = nullptr;
 
     /// Source file name.
     FilePath m_filename;
 
     /// Map for position to line number.
-    Vector<std::size_t> m_lines;
+    LineTable m_lines;
 };
 
 /* ************************************************************************* */
@@ -170,6 +170,16 @@ public:
         return *m_source;
     }
 
+    /**
+     * @brief      Returns position in the source.
+     *
+     * @return     The position.
+     */
+    std::size_t position() const noexcept
+    {
+        return m_position;
+    }
+
     /**
      * @brief      Return current source location.
      *
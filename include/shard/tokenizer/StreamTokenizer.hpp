@@ -0,0 +1,140 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+#pragma once
+
+/* ************************************************************************* */
+
+// C++
+#include <cstdint>
+
+// Shard
+#include "shard/LineTable.hpp"
+#include "shard/Optional.hpp"
+#include "shard/SourceLocation.hpp"
+#include "shard/UniquePtr.hpp"
+#include "shard/ViewPtr.hpp"
+#include "shard/tokenizer/ChunkReader.hpp"
+#include "shard/tokenizer/Source.hpp"
+#include "shard/tokenizer/Token.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::tokenizer {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Tokenizer over chunked input.
+ *
+ * @details    Only a window consisting of the unfinished token and the next
+ *             chunk is kept in memory, so input of any size can be tokenized.
+ *             Token offsets are relative to the whole input but token values
+ *             are views into the window and are valid only until the next
+ *             call of `tokenize`.
+ */
+class StreamTokenizer
+{
+public:
+    // Ctors & Dtors
+
+    /**
+     * @brief      Constructor.
+     *
+     * @param      reader  The input reader.
+     */
+    explicit StreamTokenizer(ChunkReader& reader)
+        : m_reader(&reader)
+    {
+        // Nothing to do
+    }
+
+public:
+    // Accessors & Mutators
+
+    /**
+     * @brief      Returns line table of already read input.
+     *
+     * @return     The line table.
+     */
+    const LineTable& lines() const noexcept
+    {
+        return m_lines;
+    }
+
+public:
+    // Operations
+
+    /**
+     * @brief      Tokenize new token.
+     *
+     * @return     The token or nullopt if end of input is reached.
+     *
+     * @throws     TokenizerError     In case of invalid input.
+     * @throws     std::system_error  When reading of the input fails.
+     * @throws     std::length_error  If input is larger than 4 GiB.
+     */
+    Optional<Token> tokenize();
+
+    /**
+     * @brief      Returns source location for given offset.
+     *
+     * @param      offset  The offset in the whole input.
+     *
+     * @return     The source location.
+     */
+    SourceLocation location(std::uint32_t offset) const noexcept
+    {
+        return m_lines.location(offset);
+    }
+
+private:
+    // Operations
+
+    /**
+     * @brief      Drops processed part of the window and appends next chunk.
+     *
+     * @return     False if there is no more input.
+     *
+     * @throws     std::system_error  When reading of the input fails.
+     * @throws     std::length_error  If input is larger than 4 GiB.
+     */
+    bool fill();
+
+private:
+    // Data Members
+
+    /// Input reader.
+    ViewPtr<ChunkReader> m_reader;
+
+    /// Current window.
+    UniquePtr<Source> m_window;
+
+    /// Current position in the window.
+    std::size_t m_position = 0;
+
+    /// Offset of the window in the input.
+    std::uint32_t m_base = 0;
+
+    /// Line table of the input.
+    LineTable m_lines;
+};
+
+/* ************************************************************************* */
+
+} // namespace shard::tokenizer
+
+/* ************************************************************************* */
@@ -18,9 +18,15 @@
 
 /* ************************************************************************* */
 
+// C++
+#include <cstdint>
+
 // Shard
-#include "shard/SourceLocation.hpp"
+#include "shard/Optional.hpp"
 #include "shard/String.hpp"
+#include "shard/StringView.hpp"
+#include "shard/tokenizer/Keyword.hpp"
+#include "shard/tokenizer/Operator.hpp"
 #include "shard/tokenizer/TokenType.hpp"
 
 /* ************************************************************************* */
@@ -33,7 +39,8 @@ namespace shard::tokenizer {
  * @brief      Lexical element.
  *
  * @details    It's used for storing lexical element from the source code which
- *             is a sequence of characters.
+ *             is a sequence of characters. The token doesn't own the value,
+ *             it refers to the source buffer which must outlive the token.
  */
 class Token
 {
@@ -48,14 +55,41 @@ public:
     /**
      * @brief      Constructs token.
      *
-     * @param      type      The token type.
-     * @param      value     The token value.
-     * @param      location  The source location.
+     * @param      type     The token type.
+     * @param      value    The token value.
+     * @param      offset   The source offset.
+     * @param      keyword  The keyword for keyword identifiers.
+     * @param      op       The operator for operator tokens.
      */
-    explicit Token(TokenType type, String value, SourceLocation location)
+    explicit Token(
+        TokenType type,
+        StringView value,
+        std::uint32_t offset,
+        Keyword keyword = Keyword::None,
+        Operator op     = Operator::None)
         : m_type(type)
-        , m_value(std::move(value))
-        , m_location(location)
+        , m_keyword(keyword)
+        , m_operator(op)
+        , m_value(value)
+        , m_offset(offset)
+    {
+        // Nothing to do
+    }
+
+    /**
+     * @brief      Constructs operator token.
+     *
+     * @param      type    The token type.
+     * @param      value   The token value.
+     * @param      offset  The source offset.
+     * @param      op      The operator.
+     */
+    explicit Token(
+        TokenType type,
+        StringView value,
+        std::uint32_t offset,
+        Operator op)
+        : Token(type, value, offset, Keyword::None, op)
     {
         // Nothing to do
     }
@@ -73,24 +107,73 @@ public:
         return m_type;
     }
 
+    /**
+     * @brief      Returns keyword identified by token.
+     *
+     * @return     The keyword or `Keyword::None`.
+     */
+    Keyword keyword() const noexcept
+    {
+        return m_keyword;
+    }
+
+    /**
+     * @brief      Returns operator identified by token.
+     *
+     * @return     The operator or `Operator::None`.
+     */
+    Operator op() const noexcept
+    {
+        return m_operator;
+    }
+
     /**
      * @brief      Returns token value.
      *
+     * @details    For string and character literals it's the source text
+     *             between quotes, including escape sequences.
+     *
      * @return     The value.
      */
-    const String& value() const noexcept
+    StringView value() const noexcept
     {
         return m_value;
     }
 
     /**
-     * @brief      Returns token starting location.
+     * @brief      Returns token value with escape sequences replaced.
+     *
+     * @details    Escape sequences are validated by tokenizer so decoding
+     *             cannot fail.
+     *
+     * @pre        All escape sequences in the value are supported.
+     *
+     * @return     The decoded value.
+     */
+    String decodedValue() const;
+
+public:
+    // Operations
+
+    /**
+     * @brief      Returns character represented by escape sequence.
+     *
+     * @param      chr   The character following backslash.
      *
-     * @return     The source location.
+     * @return     The character or nullopt if sequence is not supported.
      */
-    SourceLocation location() const noexcept
+    static Optional<char> escape(char chr) noexcept;
+
+    /**
+     * @brief      Returns token starting offset.
+     *
+     * @details    Line and column can be obtained from `Source::location`.
+     *
+     * @return     The source offset.
+     */
+    std::uint32_t offset() const noexcept
     {
-        return m_location;
+        return m_offset;
     }
 
 private:
@@ -99,11 +182,17 @@ private:
     /// Token type.
     TokenType m_type = TokenType::Unknown;
 
+    /// Keyword for identifier tokens.
+    Keyword m_keyword = Keyword::None;
+
+    /// Operator for other tokens.
+    Operator m_operator = Operator::None;
+
     /// Token value.
-    String m_value;
+    StringView m_value;
 
-    // Token start location in the source.
-    SourceLocation m_location;
+    /// Token start offset in the source.
+    std::uint32_t m_offset = 0;
 };
 
 /* ************************************************************************* */
@@ -0,0 +1,316 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+#pragma once
+
+/* ************************************************************************* */
+
+// C++
+#include <cstdint>
+
+// Shard
+#include "shard/GapBuffer.hpp"
+#include "shard/StringView.hpp"
+#include "shard/Symbol.hpp"
+#include "shard/ViewPtr.hpp"
+#include "shard/tokenizer/Keyword.hpp"
+#include "shard/tokenizer/Operator.hpp"
+#include "shard/tokenizer/Source.hpp"
+#include "shard/tokenizer/Token.hpp"
+#include "shard/tokenizer/TokenType.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::tokenizer {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Contiguous buffer of significant tokens.
+ *
+ * @details    Tokens are stored as structure of arrays indexed by token
+ *             position. Comments, whitespaces and line ends are not stored.
+ *             Values refer to the source which must outlive the buffer.
+ *
+ *             The arrays are gap buffers, replaced tokens are kept at the
+ *             gap. Offsets of tokens after the gap are stored as distances
+ *             from a common end offset, so shifting all of them is a single
+ *             addition. Replacing tokens costs the number of changed tokens
+ *             plus the distance from the previous replacement.
+ */
+class TokenBuffer
+{
+public:
+    // Ctors & Dtors
+
+    /**
+     * @brief      Default constructor.
+     */
+    TokenBuffer() = default;
+
+    /**
+     * @brief      Constructs an empty buffer for source.
+     *
+     * @param      source  The source tokens refer to.
+     */
+    explicit TokenBuffer(const Source& source)
+        : m_source(&source)
+    {
+        // Nothing to do
+    }
+
+public:
+    // Accessors & Mutators
+
+    /**
+     * @brief      Returns the source tokens refer to.
+     *
+     * @return     The source.
+     */
+    const Source& source() const noexcept
+    {
+        return *m_source;
+    }
+
+    /**
+     * @brief      Returns number of tokens.
+     *
+     * @return     The number of tokens.
+     */
+    std::size_t size() const noexcept
+    {
+        return m_types.size();
+    }
+
+    /**
+     * @brief      If there are no tokens.
+     *
+     * @return     True if buffer is empty, False otherwise.
+     */
+    bool isEmpty() const noexcept
+    {
+        return m_types.empty();
+    }
+
+    /**
+     * @brief      Returns token type.
+     *
+     * @param      index  The token index.
+     *
+     * @return     The type.
+     */
+    TokenType type(std::size_t index) const noexcept
+    {
+        return m_types[index];
+    }
+
+    /**
+     * @brief      Returns keyword identified by token.
+     *
+     * @param      index  The token index.
+     *
+     * @return     The keyword or `Keyword::None`.
+     */
+    Keyword keyword(std::size_t index) const noexcept
+    {
+        return m_keywords[index];
+    }
+
+    /**
+     * @brief      Returns symbol of identifier token.
+     *
+     * @details    Identifiers are interned when pushed to the buffer.
+     *
+     * @param      index  The token index.
+     *
+     * @return     The symbol or the empty symbol for other tokens.
+     */
+    Symbol symbol(std::size_t index) const noexcept
+    {
+        return m_symbols[index];
+    }
+
+    /**
+     * @brief      Returns operator identified by token.
+     *
+     * @param      index  The token index.
+     *
+     * @return     The operator or `Operator::None`.
+     */
+    Operator op(std::size_t index) const noexcept
+    {
+        return m_operators[index];
+    }
+
+    /**
+     * @brief      Returns token starting offset.
+     *
+     * @param      index  The token index.
+     *
+     * @return     The source offset.
+     */
+    std::uint32_t offset(std::size_t index) const noexcept
+    {
+        const auto offset = m_offsets[index];
+        return index < m_offsets.gap() ? offset : m_end - offset;
+    }
+
+    /**
+     * @brief      Returns token ending offset.
+     *
+     * @param      index  The token index.
+     *
+     * @return     The source offset after the token.
+     */
+    std::uint32_t end(std::size_t index) const noexcept
+    {
+        return offset(index) + m_lengths[index] + 2 * isQuoted(index);
+    }
+
+    /**
+     * @brief      Returns token value.
+     *
+     * @details    Literal values start after the opening quote.
+     *
+     * @param      index  The token index.
+     *
+     * @return     The value.
+     */
+    StringView value(std::size_t index) const noexcept
+    {
+        return m_source->view(
+            offset(index) + isQuoted(index), m_lengths[index]);
+    }
+
+    /**
+     * @brief      Returns token at index.
+     *
+     * @param      index  The token index.
+     *
+     * @return     The token.
+     */
+    Token token(std::size_t index) const noexcept
+    {
+        return Token(
+            type(index),
+            value(index),
+            offset(index),
+            keyword(index),
+            op(index));
+    }
+
+public:
+    // Operations
+
+    /**
+     * @brief      Reserve space for tokens.
+     *
+     * @param      size  The number of tokens.
+     */
+    void reserve(std::size_t size);
+
+    /**
+     * @brief      Append token to the buffer.
+     *
+     * @details    Comments, whitespaces and line ends are skipped.
+     *
+     * @param      token  The token from buffer's source.
+     */
+    void push(const Token& token);
+
+    /**
+     * @brief      Finds first token starting at or after offset.
+     *
+     * @param      offset  The source offset.
+     *
+     * @return     The token index or `size()`.
+     */
+    std::size_t lowerBound(std::uint32_t offset) const noexcept;
+
+    /**
+     * @brief      Replaces range of tokens.
+     *
+     * @details    Offsets of tokens following the range are shifted. The
+     *             gap is moved to the range, the following tokens are not
+     *             touched.
+     *
+     * @param      first   Index of the first replaced token.
+     * @param      last    Index after the last replaced token.
+     * @param      tokens  The new tokens.
+     * @param      delta   Shift of the following tokens.
+     */
+    void replace(
+        std::size_t first,
+        std::size_t last,
+        const TokenBuffer& tokens,
+        std::int64_t delta);
+
+private:
+    // Operations
+
+    /**
+     * @brief      Moves the gap of all arrays before token.
+     *
+     * @param      position  The token index.
+     */
+    void moveGap(std::size_t position);
+
+    /**
+     * @brief      If token value is enclosed in quotes.
+     *
+     * @param      index  The token index.
+     *
+     * @return     True for string and character literals.
+     */
+    bool isQuoted(std::size_t index) const noexcept
+    {
+        return m_types[index] == TokenType::StringLiteral ||
+               m_types[index] == TokenType::CharLiteral;
+    }
+
+private:
+    // Data Members
+
+    /// Source tokens refer to.
+    ViewPtr<const Source> m_source;
+
+    /// Token types.
+    GapBuffer<TokenType> m_types;
+
+    /// Token keywords.
+    GapBuffer<Keyword> m_keywords;
+
+    /// Token operators.
+    GapBuffer<Operator> m_operators;
+
+    /// Identifier symbols.
+    GapBuffer<Symbol> m_symbols;
+
+    /// Token start offsets, distances from `m_end` after the gap.
+    GapBuffer<std::uint32_t> m_offsets;
+
+    /// Token value lengths.
+    GapBuffer<std::uint32_t> m_lengths;
+
+    /// Offset the distances after the gap are measured from.
+    std::uint32_t m_end = 0;
+};
+
+/* ************************************************************************* */
+
+} // namespace shard::tokenizer
+
+/* ************************************************************************* */
@@ -22,10 +22,14 @@
 #include <algorithm>
 
 // Shard
+#include "shard/Assert.hpp"
 #include "shard/SourceLocation.hpp"
 #include "shard/Optional.hpp"
+#include "shard/tokenizer/CharClass.hpp"
+#include "shard/tokenizer/Scanner.hpp"
 #include "shard/tokenizer/Source.hpp"
 #include "shard/tokenizer/Token.hpp"
+#include "shard/tokenizer/TokenBuffer.hpp"
 #include "shard/tokenizer/TokenizerIterator.hpp"
 
 /* ************************************************************************* */
@@ -56,7 +60,12 @@ public:
         : m_current(begin)
         , m_end(end)
     {
-        // Nothing to do
+        // Positions are narrowed to token offsets
+        SHARD_ASSERT(m_end.position() <= Source::MaxSize);
+
+        // Scanning reads the source data directly up to the end
+        if (m_end.position() > m_end.source().gap())
+            m_end.source().moveGap(m_end.position());
     }
 
     /**
@@ -83,6 +92,26 @@ public:
         return m_current == m_end;
     }
 
+    /**
+     * @brief      Returns current position in the source.
+     *
+     * @return     The position.
+     */
+    std::size_t position() const noexcept
+    {
+        return m_current.position();
+    }
+
+    /**
+     * @brief      Returns the tokenized source.
+     *
+     * @return     The source.
+     */
+    const Source& source() const noexcept
+    {
+        return m_current.source();
+    }
+
     /**
      * @brief      Returns the begin iterator.
      *
@@ -113,6 +142,17 @@ public:
      */
     Optional<Token> tokenize();
 
+    /**
+     * @brief      Tokenize the rest of the source into a buffer.
+     *
+     * @details    Comments, whitespaces and line ends are skipped.
+     *
+     * @return     The significant tokens.
+     *
+     * @throws     TokenizerError  In case of invalid token.
+     */
+    TokenBuffer tokenizeAll();
+
 private:
     // Operations
 
@@ -163,17 +203,31 @@ private:
      */
     bool isWhitespace() const noexcept
     {
-        return isAny(' ', '\t');
+        return !isEmpty() && chars::isWhitespace(*m_current);
     }
 
     /**
      * @brief      Returns if current character is end of line.
      *
+     * @details    CRLF is accepted too, mapped sources are not normalized.
+     *
      * @return     True if end of line, False otherwise.
      */
     bool isEndOfLine() const noexcept
     {
-        return is('\n');
+        return is('\n') || (is('\r') && next() == '\n');
+    }
+
+    /**
+     * @brief      Returns character following the current one.
+     *
+     * @return     The character or `\0` at the end of source.
+     *
+     * @pre        `!isEmpty()`.
+     */
+    char next() const noexcept
+    {
+        return m_current.source()[m_current.position() + 1];
     }
 
     /**
@@ -183,7 +237,7 @@ private:
      */
     bool isLetter() const noexcept
     {
-        return isBetween('a', 'z') || isBetween('A', 'Z');
+        return !isEmpty() && chars::isLetter(*m_current);
     }
 
     /**
@@ -193,7 +247,17 @@ private:
      */
     bool isDigit() const noexcept
     {
-        return isBetween('0', '9');
+        return !isEmpty() && chars::isDigit(*m_current);
+    }
+
+    /**
+     * @brief      Returns if current character is a letter or '_'.
+     *
+     * @return     True if identifier start, False otherwise.
+     */
+    bool isIdentifierStart() const noexcept
+    {
+        return !isEmpty() && chars::isIdentifierStart(*m_current);
     }
 
     /**
@@ -201,9 +265,9 @@ private:
      *
      * @return     True if identifier, False otherwise.
      */
-    bool isIdentifier() noexcept
+    bool isIdentifier() const noexcept
     {
-        return isLetter() || isDigit() || is('_');
+        return !isEmpty() && chars::isIdentifier(*m_current);
     }
 
     /**
@@ -247,6 +311,54 @@ private:
         return false;
     }
 
+    /**
+     * @brief      Scans source from current position and moves to position
+     *             returned by the scanning function.
+     *
+     * @param      fn    The scanning function from `Scanner.hpp`.
+     * @param      args  Additional scanning function arguments.
+     *
+     * @tparam     Fn    The scanning function type.
+     * @tparam     Args  Additional argument types.
+     */
+    template<typename Fn, typename... Args>
+    void scan(Fn fn, Args... args) noexcept
+    {
+        const auto position = fn(
+            m_current.source().data(),
+            m_current.position(),
+            m_end.position(),
+            args...);
+
+        m_current = SourceIterator(m_current.source(), position);
+    }
+
+    /**
+     * @brief      Returns source text from given position to the current
+     *             position.
+     *
+     * @param      start  The start position.
+     *
+     * @return     View into the source.
+     */
+    StringView text(const SourceIterator& start) const noexcept
+    {
+        return start.source().view(
+            start.position(), m_current.position() - start.position());
+    }
+
+    /**
+     * @brief      Resolves source location of given offset.
+     *
+     * @param      offset  The source offset.
+     *
+     * @return     The source location.
+     */
+    SourceLocation location(std::size_t offset) const noexcept
+    {
+        return m_current.source().location(offset);
+    }
+
 private:
     // Operations
 
@@ -311,6 +423,34 @@ private:
 
 /* ************************************************************************* */
 
+/**
+ * @brief      Replaces part of the source and updates its tokens.
+ *
+ * @details    Tokenizing restarts at the end of the last token not touched by
+ *             the edit and stops at the first new token which starts where a
+ *             shifted old token starts. The rest of the source is the same so
+ *             the rest of the tokens is the same too. Tokens are scanned in a
+ *             window after the edit which grows only when a token may reach
+ *             past it, the source and tokens after it are not touched.
+ *
+ * @param      tokens  The tokens of the source.
+ * @param      source  The edited source.
+ * @param      offset  Offset of the replaced text.
+ * @param      length  Length of the replaced text.
+ * @param      text    The new text.
+ *
+ * @throws     TokenizerError  In case of invalid token. Neither the source
+ *                             nor the tokens are changed.
+ */
+void retokenize(
+    TokenBuffer& tokens,
+    Source& source,
+    std::uint32_t offset,
+    std::uint32_t length,
+    StringView text);
+
+/* ************************************************************************* */
+
 /**
  * @brief      Tokenize input range.
  *
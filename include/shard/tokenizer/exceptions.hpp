@@ -66,6 +66,16 @@ public:
         return m_location;
     }
 
+    /**
+     * @brief      Returns error message without location.
+     *
+     * @return     The message.
+     */
+    const String& message() const noexcept
+    {
+        return m_message;
+    }
+
     /**
      * @brief      Returns error message.
      *
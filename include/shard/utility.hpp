@@ -19,6 +19,7 @@
 /* ************************************************************************* */
 
 // C++
+#include <cstddef>
 #include <type_traits>
 
 /* ************************************************************************* */
@@ -85,6 +86,19 @@ constexpr unsigned int ARG_COUNT = sizeof...(Args);
 
 /* ************************************************************************* */
 
+/**
+ * @brief      Mix hash of a value into existing hash.
+ * @param      seed   The current hash.
+ * @param      value  The hash of added value.
+ * @return     Combined hash.
+ */
+constexpr std::size_t hashCombine(std::size_t seed, std::size_t value) noexcept
+{
+    return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+/* ************************************************************************* */
+
 } // namespace shard
 
 /* ************************************************************************* */
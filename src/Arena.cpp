@@ -0,0 +1,76 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// Declaration
+#include "shard/Arena.hpp"
+
+// C++
+#include <algorithm>
+#include <cstdint>
+
+// Shard
+#include "shard/Assert.hpp"
+
+/* ************************************************************************* */
+
+namespace shard {
+
+/* ************************************************************************* */
+
+void* Arena::allocate(std::size_t size, std::size_t alignment)
+{
+    SHARD_ASSERT(alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+    const auto align = [alignment](char* ptr) {
+        const auto value = reinterpret_cast<std::uintptr_t>(ptr);
+        return reinterpret_cast<char*>(
+            (value + alignment - 1) & ~std::uintptr_t(alignment - 1));
+    };
+
+    char* start = m_current ? align(m_current) : nullptr;
+
+    if (!start || start + size > m_end)
+    {
+        // Blocks are aligned to max_align_t, larger alignment needs padding
+        const auto padding =
+            alignment > alignof(std::max_align_t) ? alignment : 0;
+        const auto bytes = std::max(m_blockSize, size + padding);
+        const auto count =
+            (bytes + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t);
+
+        // Not value initialized, memory is written by created objects
+        m_blocks.emplace_back(new std::max_align_t[count]);
+
+        char* block = reinterpret_cast<char*>(m_blocks.back().get());
+        start       = align(block);
+
+        // Oversized allocation keeps the current block for small ones
+        if (bytes > m_blockSize && m_current)
+            return start;
+
+        m_end = block + count * sizeof(std::max_align_t);
+    }
+
+    m_current = start + size;
+
+    return start;
+}
+
+/* ************************************************************************* */
+
+} // namespace shard
+
+/* ************************************************************************* */
@@ -0,0 +1,124 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// Declaration
+#include "shard/File.hpp"
+
+// C++
+#include <cerrno>
+#include <fstream>
+#include <istream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#    define SHARD_FILE_POSIX 1
+#    include <fcntl.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+/* ************************************************************************* */
+
+namespace shard {
+
+/* ************************************************************************* */
+
+namespace {
+
+/* ************************************************************************* */
+
+/// Block size used when the size is not known in advance.
+constexpr std::size_t BlockSize = 64 * 1024;
+
+/* ************************************************************************* */
+
+} // namespace
+
+/* ************************************************************************* */
+
+Optional<String> readFile(const FilePath& path)
+{
+#ifdef SHARD_FILE_POSIX
+    const int fd = ::open(path.c_str(), O_RDONLY);
+
+    if (fd < 0)
+        return std::nullopt;
+
+    // Regular files are read by their size, one extra byte is used for
+    // detecting end of file without growing the buffer
+    struct stat info;
+    const bool regular = ::fstat(fd, &info) == 0 && S_ISREG(info.st_mode);
+
+    String result(regular ? info.st_size + 1 : BlockSize, '\0');
+    std::size_t size = 0;
+
+    while (true)
+    {
+        if (size == result.size())
+            result.resize(result.size() * 2);
+
+        const auto count =
+            ::read(fd, result.data() + size, result.size() - size);
+
+        if (count < 0 && errno == EINTR)
+            continue;
+
+        if (count <= 0)
+        {
+            ::close(fd);
+
+            if (count < 0)
+                return std::nullopt;
+
+            result.resize(size);
+            return result;
+        }
+
+        size += count;
+    }
+#else
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+
+    if (!file.is_open())
+        return std::nullopt;
+
+    return readStream(file);
+#endif
+}
+
+/* ************************************************************************* */
+
+String readStream(std::istream& input)
+{
+    String result;
+    std::size_t size = 0;
+
+    while (input)
+    {
+        result.resize(size + BlockSize);
+        input.read(result.data() + size, BlockSize);
+        size += input.gcount();
+    }
+
+    result.resize(size);
+
+    return result;
+}
+
+/* ************************************************************************* */
+
+} // namespace shard
+
+/* ************************************************************************* */
@@ -0,0 +1,234 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// Declaration
+#include "shard/LineTable.hpp"
+
+// C++
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <thread>
+
+/* ************************************************************************* */
+
+namespace shard {
+
+/* ************************************************************************* */
+
+namespace {
+
+/* ************************************************************************* */
+
+/// Minimum size of text processed by single thread.
+constexpr std::size_t MinChunkSize = 4 * 1024 * 1024;
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Collects line starts from text.
+ *
+ * @param      text    The text.
+ * @param      offset  Offset of the text in the source.
+ * @param      lines   The output line starts.
+ */
+void collect(
+    StringView text, std::uint32_t offset, Vector<std::uint32_t>& lines)
+{
+    const char* begin = text.data();
+    const char* end   = begin + text.size();
+
+    // memchr is vectorized by the C library
+    for (const char* it = begin; it != end; ++it)
+    {
+        it = static_cast<const char*>(std::memchr(it, '\n', end - it));
+
+        if (!it)
+            break;
+
+        lines.push_back(offset + (it - begin) + 1);
+    }
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Collects line starts from text, large text is split between
+ *             threads.
+ *
+ * @param      text    The text.
+ * @param      offset  Offset of the text in the source.
+ * @param      lines   The output line starts.
+ */
+void collectAll(
+    StringView text, std::uint32_t offset, Vector<std::uint32_t>& lines)
+{
+    const std::size_t count = std::min<std::size_t>(
+        text.size() / MinChunkSize, std::thread::hardware_concurrency());
+
+    if (count <= 1)
+    {
+        collect(text, offset, lines);
+        return;
+    }
+
+    // Each thread scans own part, results are already sorted by part
+    Vector<Vector<std::uint32_t>> parts(count);
+    Vector<std::thread> threads;
+    threads.reserve(count);
+
+    const auto step = text.size() / count;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto start  = i * step;
+        const auto length = i + 1 == count ? text.size() - start : step;
+
+        threads.emplace_back(
+            collect,
+            text.substr(start, length),
+            offset + start,
+            std::ref(parts[i]));
+    }
+
+    std::size_t size = lines.size();
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        threads[i].join();
+        size += parts[i].size();
+    }
+
+    lines.reserve(size);
+
+    for (const auto& part : parts)
+        lines.insert(lines.end(), part.begin(), part.end());
+}
+
+/* ************************************************************************* */
+
+} // namespace
+
+/* ************************************************************************* */
+
+LineTable::LineTable(StringView text)
+{
+    Vector<std::uint32_t> lines{0};
+    collectAll(text, 0, lines);
+
+    m_lines = GapBuffer<std::uint32_t>(std::move(lines));
+}
+
+/* ************************************************************************* */
+
+void LineTable::append(StringView text, std::uint32_t offset)
+{
+    Vector<std::uint32_t> lines;
+    collectAll(text, offset, lines);
+
+    moveGap(size());
+
+    for (const auto start : lines)
+        m_lines.insert(start);
+}
+
+/* ************************************************************************* */
+
+void LineTable::replace(
+    std::uint32_t offset,
+    std::uint32_t length,
+    StringView text)
+{
+    // Line starts following removed new lines
+    const auto first = upperBound(offset);
+    const auto last  = upperBound(offset + length);
+
+    moveGap(first);
+    m_lines.erase(last - first);
+
+    Vector<std::uint32_t> lines;
+    collect(text, offset, lines);
+
+    for (const auto start : lines)
+        m_lines.insert(start);
+
+    // Shift all following lines at once
+    if (m_lines.gap() < size())
+        m_end = static_cast<std::uint32_t>(m_end + text.size() - length);
+}
+
+/* ************************************************************************* */
+
+SourceLocation LineTable::location(std::uint32_t offset) const noexcept
+{
+    // The array contains sorted offsets. At first it will find first element
+    // which is greater than offset so we need to get the previous one.
+    const auto index = upperBound(offset) - 1;
+
+    // Line is index in the array + 1
+    const int line   = index + 1;
+    const int column = offset - lineStart(index) + 1;
+
+    return SourceLocation{line, column};
+}
+
+/* ************************************************************************* */
+
+std::size_t LineTable::upperBound(std::uint32_t offset) const noexcept
+{
+    std::size_t first = 0;
+    std::size_t count = size();
+
+    while (count > 0)
+    {
+        const auto step = count / 2;
+
+        if (lineStart(first + step) <= offset)
+        {
+            first += step + 1;
+            count -= step + 1;
+        }
+        else
+        {
+            count = step;
+        }
+    }
+
+    return first;
+}
+
+/* ************************************************************************* */
+
+void LineTable::moveGap(std::size_t line)
+{
+    if (m_lines.gap() == line)
+        return;
+
+    // Nothing after the gap depends on the end, the last line start covers all
+    if (m_lines.gap() == size())
+        m_end = lineStart(size() - 1);
+
+    const auto reference = m_end;
+
+    m_lines.moveGap(
+        line, [reference](std::uint32_t start) { return reference - start; });
+}
+
+/* ************************************************************************* */
+
+} // namespace shard
+
+/* ************************************************************************* */
@@ -0,0 +1,158 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// Declaration
+#include "shard/Symbol.hpp"
+
+// C++
+#include <mutex>
+#include <ostream>
+#include <shared_mutex>
+
+// Shard
+#include "shard/HashMap.hpp"
+#include "shard/UniquePtr.hpp"
+
+/* ************************************************************************* */
+
+namespace shard {
+
+/* ************************************************************************* */
+
+namespace {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Global string interner.
+ *
+ * @details    Lookups of already interned names take a shared lock so
+ *             concurrent tokenizers only serialize on new names.
+ */
+class Interner
+{
+public:
+    // Operations
+
+    /**
+     * @brief      Returns interned entry for name.
+     *
+     * @param      name  The name.
+     *
+     * @return     The entry.
+     */
+    const detail::SymbolEntry* intern(StringView name)
+    {
+        {
+            std::shared_lock lock(m_mutex);
+
+            auto it = m_entries.find(name);
+
+            if (it != m_entries.end())
+                return it->second.get();
+        }
+
+        std::unique_lock lock(m_mutex);
+
+        // Inserted by other thread in the meantime
+        auto it = m_entries.find(name);
+
+        if (it != m_entries.end())
+            return it->second.get();
+
+        const auto id = static_cast<std::uint32_t>(m_entries.size() + 1);
+        auto entry    = makeUnique<detail::SymbolEntry>(
+            detail::SymbolEntry{id, String(name)});
+
+        // Key refers to the name owned by the entry
+        const auto key = StringView(entry->name);
+        return m_entries.emplace(key, std::move(entry)).first->second.get();
+    }
+
+    /**
+     * @brief      Returns number of interned names.
+     *
+     * @return     The number of names.
+     */
+    std::size_t size() const
+    {
+        std::shared_lock lock(m_mutex);
+        return m_entries.size();
+    }
+
+private:
+    // Data Members
+
+    /// Entries guard.
+    mutable std::shared_mutex m_mutex;
+
+    /// Interned entries.
+    HashMap<StringView, UniquePtr<detail::SymbolEntry>> m_entries;
+};
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Returns the global interner.
+ *
+ * @return     The interner.
+ */
+Interner& interner()
+{
+    static Interner s_interner;
+    return s_interner;
+}
+
+/* ************************************************************************* */
+
+} // namespace
+
+/* ************************************************************************* */
+
+Symbol::Symbol(StringView name)
+    : m_entry(name.empty() ? nullptr : interner().intern(name))
+{
+    // Nothing to do
+}
+
+/* ************************************************************************* */
+
+const String& Symbol::str() const noexcept
+{
+    static const String s_empty;
+
+    return m_entry ? m_entry->name : s_empty;
+}
+
+/* ************************************************************************* */
+
+std::size_t Symbol::count()
+{
+    return interner().size();
+}
+
+/* ************************************************************************* */
+
+std::ostream& operator<<(std::ostream& os, Symbol symbol)
+{
+    return os << symbol.str();
+}
+
+/* ************************************************************************* */
+
+} // namespace shard
+
+/* ************************************************************************* */
@@ -0,0 +1,119 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// Declaration
+#include "shard/ThreadPool.hpp"
+
+/* ************************************************************************* */
+
+namespace shard {
+
+/* ************************************************************************* */
+
+ThreadPool::ThreadPool(unsigned threads) noexcept
+    : m_size(threads != 0 ? threads : std::thread::hardware_concurrency())
+{
+    // Unknown concurrency
+    if (m_size == 0)
+        m_size = 1;
+}
+
+/* ************************************************************************* */
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard lock(m_mutex);
+        m_stop = true;
+    }
+
+    m_wake.notify_all();
+
+    for (auto& thread : m_threads)
+        thread.join();
+}
+
+/* ************************************************************************* */
+
+void ThreadPool::run(std::size_t count, Task task, void* fn)
+{
+    // Workers are started once and reused by next batches
+    if (m_threads.empty())
+    {
+        m_threads.reserve(m_size - 1);
+
+        for (unsigned i = 1; i < m_size; ++i)
+            m_threads.emplace_back(&ThreadPool::loop, this, i);
+    }
+
+    {
+        std::lock_guard lock(m_mutex);
+        m_task    = task;
+        m_fn      = fn;
+        m_count   = count;
+        m_next    = 0;
+        m_running = static_cast<unsigned>(m_threads.size());
+        ++m_batch;
+    }
+
+    m_wake.notify_all();
+
+    work(0);
+
+    std::unique_lock lock(m_mutex);
+    m_done.wait(lock, [this] { return m_running == 0; });
+}
+
+/* ************************************************************************* */
+
+void ThreadPool::work(unsigned worker) noexcept
+{
+    for (auto i = m_next++; i < m_count; i = m_next++)
+        m_task(m_fn, worker, i);
+}
+
+/* ************************************************************************* */
+
+void ThreadPool::loop(unsigned worker) noexcept
+{
+    std::uint64_t batch = 0;
+
+    while (true)
+    {
+        {
+            std::unique_lock lock(m_mutex);
+            m_wake.wait(lock, [&] { return m_stop || m_batch != batch; });
+
+            if (m_stop)
+                return;
+
+            batch = m_batch;
+        }
+
+        work(worker);
+
+        std::lock_guard lock(m_mutex);
+
+        if (--m_running == 0)
+            m_done.notify_one();
+    }
+}
+
+/* ************************************************************************* */
+
+} // namespace shard
+
+/* ************************************************************************* */
@@ -18,7 +18,10 @@
 #include "shard/ast/AnalysisContext.hpp"
 
 // Shard
+#include "shard/Assert.hpp"
 #include "shard/ast/Decl.hpp"
+#include "shard/ast/decl/FunctionDecl.hpp"
+#include "shard/ast/stmt/CompoundStmt.hpp"
 
 /* ************************************************************************* */
 
@@ -26,24 +29,59 @@ namespace shard::ast {
 
 /* ************************************************************************* */
 
-void AnalysisContext::addDecl(ViewPtr<Decl> decl)
+const AnalysisContext& AnalysisContext::builtins()
+{
+    // Interpreter accepts any arguments, parameters are not declared
+    static const auto print =
+        FunctionDecl::make("Any", "print", CompoundStmt::make({}), {});
+
+    static const auto context = [] {
+        AnalysisContext result;
+        result.addDecl(print.get());
+        return result;
+    }();
+
+    return context;
+}
+
+/* ************************************************************************* */
+
+void AnalysisContext::leaveScope() noexcept
 {
-    m_declarations.emplace(decl->name(), decl);
+    SHARD_ASSERT(!m_scopes.empty());
+
+    const auto size = m_scopes.back();
+    m_scopes.pop_back();
+
+    // Restore shadowed bindings
+    while (m_bindings.size() > size)
+    {
+        const auto& binding = m_bindings.back();
+        *m_heads.find(binding.name) = binding.previous;
+        m_bindings.pop_back();
+    }
 }
 
 /* ************************************************************************* */
 
-ViewPtr<Decl> AnalysisContext::findDecl(const String& name) const
+void AnalysisContext::addDecl(ViewPtr<Decl> decl)
 {
-    auto it = m_declarations.find(name);
+    auto head = m_heads.insert(decl->name(), 0).first;
+
+    m_bindings.push_back(Binding{decl->name(), decl, *head});
+    *head = static_cast<std::uint32_t>(m_bindings.size());
+}
+
+/* ************************************************************************* */
 
-    if (it != m_declarations.end())
-        return it->second;
+ViewPtr<Decl> AnalysisContext::findDecl(Symbol name) const noexcept
+{
+    const auto head = m_heads.find(name);
 
-    if (m_parent)
-        return m_parent->findDecl(name);
+    if (head && *head != 0)
+        return m_bindings[*head - 1].decl;
 
-    return nullptr;
+    return m_globals ? m_globals->findDecl(name) : nullptr;
 }
 
 /* ************************************************************************* */
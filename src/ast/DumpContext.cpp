@@ -32,9 +32,18 @@ namespace shard::ast {
 const DumpContext& DumpContext::operator<<(const SourceRange& range) const
     noexcept
 {
-    m_output << "<" << range.start().line() << ":" << range.start().column()
-             << " -> " << range.end().line() << ":" << range.end().column()
-             << ">";
+    if (!m_lines)
+    {
+        m_output << "<" << range.start() << " -> " << range.end() << ">";
+        return *this;
+    }
+
+    // Resolve locations only when printing
+    const auto start = m_lines->location(range.start());
+    const auto end   = m_lines->location(range.end());
+
+    m_output << "<" << start.line() << ":" << start.column() << " -> "
+             << end.line() << ":" << end.column() << ">";
 
     return *this;
 }
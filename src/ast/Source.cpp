@@ -18,11 +18,20 @@
 #include "shard/ast/Source.hpp"
 
 // C++
+#include <exception>
 #include <ostream>
 
 // Shard
+#include "shard/ThreadPool.hpp"
+#include "shard/Vector.hpp"
+#include "shard/ViewPtr.hpp"
 #include "shard/ast/DumpContext.hpp"
 #include "shard/ast/AnalysisContext.hpp"
+#include "shard/ast/Decl.hpp"
+#include "shard/ast/decl/FunctionDecl.hpp"
+#include "shard/ast/exceptions.hpp"
+#include "shard/ast/stmt/DeclStmt.hpp"
+#include "shard/ast/visit.hpp"
 
 /* ************************************************************************* */
 
@@ -30,22 +39,153 @@ namespace shard::ast {
 
 /* ************************************************************************* */
 
-void Source::analyse()
+namespace {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Returns function declared by a top-level statement.
+ *
+ * @return     nullptr, the node is not a function declaration.
+ */
+ViewPtr<FunctionDecl> declaredFunction(Node&) noexcept
 {
-    AnalysisContext context;
+    return nullptr;
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Returns function declared by a top-level statement.
+ *
+ * @param      decl  The function declaration.
+ *
+ * @return     The function declaration.
+ */
+ViewPtr<FunctionDecl> declaredFunction(FunctionDecl& decl) noexcept
+{
+    return &decl;
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Returns function declared by a top-level statement.
+ *
+ * @param      stmt  The declaration statement.
+ *
+ * @return     The function declaration or nullptr.
+ */
+ViewPtr<FunctionDecl> declaredFunction(DeclStmt& stmt) noexcept
+{
+    return visit(
+        *stmt.decl(), [](auto& decl) { return declaredFunction(decl); });
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Returns function declared by a top-level statement.
+ *
+ * @param      stmt  The statement.
+ *
+ * @return     The function declaration or nullptr.
+ */
+ViewPtr<FunctionDecl> topLevelFunction(Stmt& stmt) noexcept
+{
+    return visit(stmt, [](auto& node) { return declaredFunction(node); });
+}
+
+/* ************************************************************************* */
+
+} // namespace
+
+/* ************************************************************************* */
+
+void Source::analyse(unsigned threads)
+{
+    AnalysisContext globals(&AnalysisContext::builtins());
+    declare(globals);
+    analyseGlobals(globals);
+
+    const auto decls = functions();
+    Vector<std::exception_ptr> errors(decls.size());
+
+    ThreadPool pool(threads);
+
+    // Scopes leave a context empty, so each worker reuses its own
+    Vector<AnalysisContext> contexts(pool.size(), AnalysisContext(&globals));
+
+    pool.parallelFor(
+        decls.size(),
+        [&decls, &contexts, &errors](unsigned worker, std::size_t i) {
+            try
+            {
+                decls[i]->analyse(contexts[worker]);
+            }
+            catch (...)
+            {
+                errors[i] = std::current_exception();
+            }
+        });
+
+    // Report first error in statement order
+    for (const auto& error : errors)
+    {
+        if (error)
+            std::rethrow_exception(error);
+    }
+}
+
+/* ************************************************************************* */
+
+void Source::declare(AnalysisContext& context) const
+{
+    // Variables are declared in order by `analyseGlobals`
+    for (auto decl : functions())
+    {
+        if (context.findDecl(decl->name()))
+            throw SemanticError(
+                "redefinition of '" + decl->name().str() + "'",
+                decl->sourceRange().start());
+
+        context.addDecl(decl);
+    }
+}
+
+/* ************************************************************************* */
+
+void Source::analyseGlobals(AnalysisContext& context)
+{
+    for (const auto& stmt : m_statements)
+    {
+        if (!topLevelFunction(*stmt))
+            stmt->analyse(context);
+    }
+}
+
+/* ************************************************************************* */
+
+Vector<ViewPtr<FunctionDecl>> Source::functions() const
+{
+    Vector<ViewPtr<FunctionDecl>> result;
 
-    // Foreach all statements
     for (const auto& stmt : m_statements)
-        stmt->analyse(context);
+    {
+        if (auto decl = topLevelFunction(*stmt))
+            result.push_back(decl);
+    }
+
+    return result;
 }
 
 /* ************************************************************************* */
 
-void Source::dump(std::ostream& os) const
+void Source::dump(std::ostream& os, ViewPtr<const LineTable> lines) const
 {
     os << "Source\n";
 
-    DumpContext context(os);
+    DumpContext context(os, lines);
 
     // Foreach all statements
     for (const auto& stmt : m_statements)
@@ -35,19 +35,21 @@ void FunctionDecl::analyse(AnalysisContext& context)
 {
     auto decl = context.findDecl(name());
 
-    if (decl)
+    // Top-level declarations are added in advance
+    if (decl && decl != this)
         throw SemanticError(
-            "redefinition of '" + name() + "'", sourceRange().start());
+            "redefinition of '" + name().str() + "'", sourceRange().start());
 
     // Add declaration
-    context.addDecl(this);
+    if (!decl)
+        context.addDecl(this);
 
-    auto ctx = context.push();
+    auto scope = context.push();
 
     for (auto& param : m_parameters)
-        ctx.addDecl(param.get());
+        context.addDecl(param.get());
 
-    m_bodyStmt->analyse(ctx);
+    m_bodyStmt->analyse(context);
 }
 
 /* ************************************************************************* */
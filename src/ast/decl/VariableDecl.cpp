@@ -35,11 +35,13 @@ void VariableDecl::analyse(AnalysisContext& context)
 {
     auto decl = context.findDecl(name());
 
-    if (decl)
+    // Top-level declarations are added in advance
+    if (decl && decl != this)
         throw SemanticError(
-            "redefinition of '" + name() + "'", sourceRange().start());
+            "redefinition of '" + name().str() + "'", sourceRange().start());
 
-    context.addDecl(this);
+    if (!decl)
+        context.addDecl(this);
 }
 
 /* ************************************************************************* */
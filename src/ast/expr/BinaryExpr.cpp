@@ -21,6 +21,8 @@
 #include <ostream>
 
 // Shard
+#include "shard/Vector.hpp"
+#include "shard/ViewPtr.hpp"
 #include "shard/ast/DumpContext.hpp"
 
 /* ************************************************************************* */
@@ -33,8 +35,17 @@ void BinaryExpr::analyse(AnalysisContext& context)
 {
     // TODO: analyse operator
 
-    m_lhs->analyse(context);
-    m_rhs->analyse(context);
+    // Left-deep chains like `a + b + c` are analysed iteratively, their
+    // depth is bounded only by the source size
+    Vector<ViewPtr<BinaryExpr>> chain{this};
+
+    while (chain.back()->m_lhs->is<BinaryExpr>())
+        chain.push_back(&chain.back()->m_lhs->cast<BinaryExpr>());
+
+    chain.back()->m_lhs->analyse(context);
+
+    for (auto it = chain.rbegin(); it != chain.rend(); ++it)
+        (*it)->m_rhs->analyse(context);
 }
 
 /* ************************************************************************* */
@@ -37,7 +37,7 @@ void IdentifierExpr::analyse(AnalysisContext& context)
 
     if (decl == nullptr)
         throw SemanticError(
-            "Symbol '" + name() + "' not found", sourceRange().start());
+            "Symbol '" + name().str() + "' not found", sourceRange().start());
 
     setDecl(decl);
 }
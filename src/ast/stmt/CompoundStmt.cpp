@@ -32,10 +32,10 @@ namespace shard::ast {
 
 void CompoundStmt::analyse(AnalysisContext& context)
 {
-    auto ctx = context.push();
+    auto scope = context.push();
 
     for (const auto& stmt : m_statements)
-        stmt->analyse(ctx);
+        stmt->analyse(context);
 }
 
 /* ************************************************************************* */
@@ -35,7 +35,7 @@ namespace {
  */
 ast::CompoundStmtPtr parseCompoundStmt(parser::Parser& parser)
 {
-    auto start = parser.location();
+    auto start = parser.offset();
     parser.requireOther("{");
 
     ast::StmtPtrVector stmts;
@@ -43,10 +43,10 @@ ast::CompoundStmtPtr parseCompoundStmt(parser::Parser& parser)
     while (!parser.isEmpty() && !parser.isOther("}"))
         stmts.push_back(parser.parseStmt());
 
-    auto end = parser.location();
+    auto end = parser.offset();
     parser.requireOther("}");
 
-    return makeUnique<ast::CompoundStmt>(
+    return parser.make<ast::CompoundStmt>(
         std::move(stmts), SourceRange{start, end});
 }
 
@@ -59,18 +59,18 @@ ast::CompoundStmtPtr parseCompoundStmt(parser::Parser& parser)
  *
  * @return     Parsed statement.
  */
-UniquePtr<ast::VariableDecl> parseVariableDecl(parser::Parser& parser)
+ast::VariableDeclPtr parseVariableDecl(parser::Parser& parser)
 {
-    auto start = parser.location();
+    auto start = parser.offset();
 
     parser.checkIdentifier();
-    auto name = parser.token().value();
+    auto name = parser.symbol();
     parser.next();
 
-    auto end = parser.location();
+    auto end = parser.offset();
 
-    return makeUnique<ast::VariableDecl>(
-        "Any", std::move(name), nullptr, SourceRange{start, end});
+    return parser.make<ast::VariableDecl>(
+        "Any", name, nullptr, SourceRange{start, end});
 }
 
 /* ************************************************************************* */
@@ -81,20 +81,20 @@ UniquePtr<ast::VariableDecl> parseVariableDecl(parser::Parser& parser)
 
 ast::StmtPtr parseFunc(parser::Parser& parser)
 {
-    auto start = parser.location();
+    auto start = parser.offset();
 
     // Prefix
-    parser.requireIdentifier("func");
+    parser.requireKeyword(tokenizer::Keyword::Func);
 
     // Name
     parser.checkIdentifier();
-    auto name = parser.token().value();
+    auto name = parser.symbol();
     parser.next();
 
     parser.requireOther("(");
 
     // Parse list of arguments
-    PtrVector<ast::VariableDecl> args = parser.parseList([&] {
+    Vector<ast::VariableDeclPtr> args = parser.parseList([&] {
         return parseVariableDecl(parser);
     }, [&] {
         return parser.isOther(")");
@@ -103,26 +103,26 @@ ast::StmtPtr parseFunc(parser::Parser& parser)
     });
 
     auto body = parseCompoundStmt(parser);
-    auto end  = parser.location();
+    auto end  = parser.offset();
 
-    auto decl = makeUnique<ast::FunctionDecl>(
+    auto decl = parser.make<ast::FunctionDecl>(
         "Any", name, std::move(body), std::move(args), SourceRange{start, end});
 
-    return makeUnique<ast::DeclStmt>(std::move(decl), SourceRange{start, end});
+    return parser.make<ast::DeclStmt>(std::move(decl), SourceRange{start, end});
 }
 
 /* ************************************************************************* */
 
 ast::StmtPtr parseVar(parser::Parser& parser)
 {
-    auto start = parser.location();
+    auto start = parser.offset();
 
     // Prefix
-    parser.requireIdentifier("var");
+    parser.requireKeyword(tokenizer::Keyword::Var);
 
     // Name
     parser.checkIdentifier();
-    auto name = parser.token().value();
+    auto name = parser.symbol();
     parser.next();
 
     ast::ExprPtr expr;
@@ -133,26 +133,26 @@ ast::StmtPtr parseVar(parser::Parser& parser)
 
     parser.requireOther(";");
 
-    auto end  = parser.location();
+    auto end  = parser.offset();
 
-    auto decl = makeUnique<ast::VariableDecl>(
+    auto decl = parser.make<ast::VariableDecl>(
         "Any", name, std::move(expr), SourceRange{start, end});
 
-    return makeUnique<ast::DeclStmt>(std::move(decl), SourceRange{start, end});
+    return parser.make<ast::DeclStmt>(std::move(decl), SourceRange{start, end});
 }
 
 /* ************************************************************************* */
 
 ast::StmtPtr parseConst(parser::Parser& parser)
 {
-    auto start = parser.location();
+    auto start = parser.offset();
 
     // Prefix
-    parser.requireIdentifier("const");
+    parser.requireKeyword(tokenizer::Keyword::Const);
 
     // Name
     parser.checkIdentifier();
-    auto name = parser.token().value();
+    auto name = parser.symbol();
     parser.next();
 
     ast::ExprPtr expr;
@@ -163,21 +163,21 @@ ast::StmtPtr parseConst(parser::Parser& parser)
 
     parser.requireOther(";");
 
-    auto end  = parser.location();
+    auto end  = parser.offset();
 
-    auto decl = makeUnique<ast::VariableDecl>(
+    auto decl = parser.make<ast::VariableDecl>(
         "Any", name, std::move(expr), SourceRange{start, end});
 
-    return makeUnique<ast::DeclStmt>(std::move(decl), SourceRange{start, end});
+    return parser.make<ast::DeclStmt>(std::move(decl), SourceRange{start, end});
 }
 
 /* ************************************************************************* */
 
 ast::StmtPtr parseReturn(parser::Parser& parser)
 {
-    auto start = parser.location();
+    auto start = parser.offset();
 
-    parser.requireIdentifier("return");
+    parser.requireKeyword(tokenizer::Keyword::Return);
 
     ast::ExprPtr expr = nullptr;
 
@@ -188,7 +188,7 @@ ast::StmtPtr parseReturn(parser::Parser& parser)
         parser.requireOther(";");
     }
 
-    auto end = parser.location();
+    auto end = parser.offset();
 
     return parser.make<ast::ReturnStmt>(
         std::move(expr), SourceRange{start, end});
@@ -199,11 +199,11 @@ ast::StmtPtr parseReturn(parser::Parser& parser)
 void extendParser(parser::Parser& parser)
 {
     // Statements
-    parser.addStmtParser("func", &parseFunc);
-    parser.addStmtParser("var", &parseVar);
-    parser.addStmtParser("const", &parseConst);
+    parser.addStmtParser(tokenizer::Keyword::Func, &parseFunc);
+    parser.addStmtParser(tokenizer::Keyword::Var, &parseVar);
+    parser.addStmtParser(tokenizer::Keyword::Const, &parseConst);
 
-    parser.addStmtParser("return", &parseReturn);
+    parser.addStmtParser(tokenizer::Keyword::Return, &parseReturn);
 
     // Operators
     parser.addBinaryOperator("=");
@@ -0,0 +1,1431 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// Declaration
+#include "shard/codegen/Codegen.hpp"
+
+// C++
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+// Shard
+#include "shard/Assert.hpp"
+#include "shard/HashMap.hpp"
+#include "shard/Optional.hpp"
+#include "shard/Set.hpp"
+#include "shard/String.hpp"
+#include "shard/StringView.hpp"
+#include "shard/SymbolMap.hpp"
+#include "shard/Vector.hpp"
+#include "shard/ViewPtr.hpp"
+#include "shard/ast/ASTVisitor.hpp"
+#include "shard/ast/AnalysisContext.hpp"
+#include "shard/ast/RecursiveASTVisitor.hpp"
+#include "shard/ast/Source.hpp"
+#include "shard/ast/exceptions.hpp"
+#include "shard/ast/visit.hpp"
+#include "shard/ir/Block.hpp"
+#include "shard/ir/Constant.hpp"
+#include "shard/ir/Function.hpp"
+#include "shard/ir/Instruction.hpp"
+#include "shard/ir/Type.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::codegen {
+
+/* ************************************************************************* */
+
+namespace {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Looks for return statement with a value.
+ */
+class ReturnFinder : public ast::RecursiveASTVisitor<ReturnFinder>
+{
+public:
+    // Operations
+
+    /**
+     * @brief      Stops the traversal at return with a value.
+     *
+     * @param      stmt  The statement.
+     *
+     * @return     If traversal should continue.
+     */
+    bool visitReturnStmt(ast::ReturnStmt& stmt) const noexcept
+    {
+        return stmt.resExpr() == nullptr;
+    }
+
+    /**
+     * @brief      Skips binary expression, expressions cannot contain
+     *             statements and operator chains can be very deep.
+     *
+     * @return     If traversal should continue.
+     */
+    bool traverseBinaryExpr(ast::BinaryExpr&) const noexcept
+    {
+        return true;
+    }
+};
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Convert type name to IR type.
+ *
+ * @param      name    The type name.
+ * @param      offset  The source offset for error reporting.
+ *
+ * @return     The IR type or nullptr for `Any` type.
+ */
+ViewPtr<ir::Type> lowerType(const String& name, std::uint32_t offset)
+{
+    if (name == "Any")
+        return nullptr;
+    else if (name == "bool")
+        return ir::TypeInt1::instance();
+    else if (name == "int" || name == "char")
+        return ir::TypeInt32::instance();
+    else if (name == "float")
+        return ir::TypeFloat32::instance();
+    else if (name == "double")
+        return ir::TypeFloat64::instance();
+
+    throw ast::SemanticError("unknown type '" + name + "'", offset);
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Convert operator to comparison operation.
+ *
+ * @param      op    The operator.
+ *
+ * @return     The operation or nothing if operator is not comparison.
+ */
+Optional<ir::InstructionCmp::Operation> comparison(StringView op) noexcept
+{
+    using Operation = ir::InstructionCmp::Operation;
+
+    if (op == "==")
+        return Operation::Equal;
+    else if (op == "!=")
+        return Operation::NotEqual;
+    else if (op == ">")
+        return Operation::GreaterThan;
+    else if (op == ">=")
+        return Operation::GreaterEqual;
+    else if (op == "<")
+        return Operation::LessThan;
+    else if (op == "<=")
+        return Operation::LessEqual;
+
+    return {};
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Returns if operator is an arithmetic or comparison operation,
+ *             i.e. neither short-circuit nor assignment.
+ *
+ * @param      op    The operator.
+ *
+ * @return     If operator is an operation.
+ */
+bool isOperation(StringView op) noexcept
+{
+    if (op == "&&" || op == "||" || op == "=")
+        return false;
+
+    return !(op.size() > 1 && op.back() == '=' && !comparison(op));
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Returns if type is a floating point type.
+ *
+ * @param      type  The type.
+ *
+ * @return     If type is floating point.
+ */
+bool isFloat(const ir::Type& type) noexcept
+{
+    return type.is<ir::TypeFloat32>() || type.is<ir::TypeFloat64>();
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Returns expression without enclosing parentheses.
+ *
+ * @param      expr  The expression.
+ *
+ * @return     The inner expression.
+ */
+ast::Expr& unwrap(ast::Expr& expr) noexcept
+{
+    auto ptr = &expr;
+
+    while (ptr->is<ast::ParenExpr>())
+        ptr = ptr->cast<ast::ParenExpr>().expr().get();
+
+    return *ptr;
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Returns function declared by a top-level statement.
+ *
+ * @return     nullptr, the node is not a function declaration.
+ */
+ViewPtr<ast::FunctionDecl> declaredFunction(ast::Node&) noexcept
+{
+    return nullptr;
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Returns function declared by a top-level statement.
+ *
+ * @param      decl  The function declaration.
+ *
+ * @return     The function declaration.
+ */
+ViewPtr<ast::FunctionDecl> declaredFunction(ast::FunctionDecl& decl) noexcept
+{
+    return &decl;
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Returns function declared by a top-level statement.
+ *
+ * @param      stmt  The declaration statement.
+ *
+ * @return     The function declaration or nullptr.
+ */
+ViewPtr<ast::FunctionDecl> declaredFunction(ast::DeclStmt& stmt) noexcept
+{
+    return ast::visit(
+        *stmt.decl(), [](auto& decl) { return declaredFunction(decl); });
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Lowers AST into IR module.
+ *
+ * @details    Expression visits return the expression value, statement and
+ *             declaration visits return nullptr. Lowering of a statement
+ *             starts in the current block, a statement which terminates the
+ *             block, e.g. `return`, resets the current block and following
+ *             statements are unreachable.
+ */
+class Generator : public ast::ASTVisitor<Generator, ViewPtr<ir::Value>>
+{
+public:
+    // Ctors & Dtors
+
+    /**
+     * @brief      Constructor.
+     *
+     * @param      module  The output module.
+     */
+    explicit Generator(ir::Module& module) noexcept
+        : m_module(module)
+    {
+        // Nothing to do
+    }
+
+public:
+    // Operations
+
+    /**
+     * @brief      Lower source.
+     *
+     * @param      source  The source.
+     */
+    void generate(ast::Source& source)
+    {
+        Vector<ViewPtr<ast::FunctionDecl>> functions;
+
+        // Declare all functions first, calls may precede the callee
+        for (const auto& stmt : source.stmts())
+        {
+            const auto decl = ast::visit(
+                *stmt, [](auto& node) { return declaredFunction(node); });
+
+            if (!decl)
+            {
+                throw ast::SemanticError(
+                    "only function declarations are supported at top level",
+                    stmt->sourceRange().start());
+            }
+
+            declare(*decl);
+            functions.push_back(decl);
+        }
+
+        for (auto decl : functions)
+            lower(*decl);
+    }
+
+    /**
+     * @brief      Unsupported node.
+     *
+     * @param      node  The node.
+     *
+     * @return     Nothing, always throws.
+     */
+    ViewPtr<ir::Value> visitNode(ast::Node& node)
+    {
+        throw ast::SemanticError(
+            "unsupported construct", node.sourceRange().start());
+    }
+
+    /**
+     * @brief      Lower variable declaration.
+     *
+     * @param      decl  The declaration.
+     *
+     * @return     nullptr.
+     */
+    ViewPtr<ir::Value> visitVariableDecl(ast::VariableDecl& decl)
+    {
+        const auto offset = decl.sourceRange().start();
+        auto type         = lowerType(decl.type(), offset);
+        ViewPtr<ir::Value> value;
+
+        if (decl.initExpr())
+        {
+            value = rvalue(*decl.initExpr());
+
+            if (type)
+                check(value, type, offset);
+            else
+                type = typeOf(value);
+        }
+        else
+        {
+            if (!type)
+                type = ir::TypeInt32::instance();
+
+            value = constant(type, 0);
+        }
+
+        emit<ir::InstructionStore>(allocate(decl, type), value);
+
+        return nullptr;
+    }
+
+    /**
+     * @brief      Nested functions are not supported.
+     *
+     * @param      decl  The declaration.
+     *
+     * @return     Nothing, always throws.
+     */
+    ViewPtr<ir::Value> visitFunctionDecl(ast::FunctionDecl& decl)
+    {
+        throw ast::SemanticError(
+            "nested functions are not supported", decl.sourceRange().start());
+    }
+
+    /**
+     * @brief      Lower break statement.
+     *
+     * @param      stmt  The statement.
+     *
+     * @return     nullptr.
+     */
+    ViewPtr<ir::Value> visitBreakStmt(ast::BreakStmt& stmt)
+    {
+        if (m_loops.empty())
+        {
+            throw ast::SemanticError(
+                "'break' outside of loop", stmt.sourceRange().start());
+        }
+
+        emit<ir::InstructionBranch>(m_loops.back().exitBlock);
+        m_block = nullptr;
+
+        return nullptr;
+    }
+
+    /**
+     * @brief      Lower compound statement.
+     *
+     * @param      stmt  The statement.
+     *
+     * @return     nullptr.
+     */
+    ViewPtr<ir::Value> visitCompoundStmt(ast::CompoundStmt& stmt)
+    {
+        auto scope = m_scope.push();
+
+        for (const auto& child : stmt.stmts())
+        {
+            // Rest of the statements is unreachable
+            if (!m_block)
+                break;
+
+            visit(*child);
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * @brief      Lower continue statement.
+     *
+     * @param      stmt  The statement.
+     *
+     * @return     nullptr.
+     */
+    ViewPtr<ir::Value> visitContinueStmt(ast::ContinueStmt& stmt)
+    {
+        if (m_loops.empty())
+        {
+            throw ast::SemanticError(
+                "'continue' outside of loop", stmt.sourceRange().start());
+        }
+
+        emit<ir::InstructionBranch>(m_loops.back().condBlock);
+        m_block = nullptr;
+
+        return nullptr;
+    }
+
+    /**
+     * @brief      Lower declaration statement.
+     *
+     * @param      stmt  The statement.
+     *
+     * @return     nullptr.
+     */
+    ViewPtr<ir::Value> visitDeclStmt(ast::DeclStmt& stmt)
+    {
+        return visit(*stmt.decl());
+    }
+
+    /**
+     * @brief      Lower expression statement.
+     *
+     * @param      stmt  The statement.
+     *
+     * @return     nullptr.
+     */
+    ViewPtr<ir::Value> visitExprStmt(ast::ExprStmt& stmt)
+    {
+        if (stmt.expr())
+            visit(*stmt.expr());
+
+        return nullptr;
+    }
+
+    /**
+     * @brief      Lower if statement.
+     *
+     * @param      stmt  The statement.
+     *
+     * @return     nullptr.
+     */
+    ViewPtr<ir::Value> visitIfStmt(ast::IfStmt& stmt)
+    {
+        auto thenBlock = createBlock();
+        auto elseBlock = stmt.elseStmt() ? createBlock() : nullptr;
+
+        // Without else branch the condition jumps directly after the if
+        ViewPtr<ir::Block> mergeBlock = elseBlock ? nullptr : createBlock();
+
+        branch(*stmt.condExpr(), thenBlock, elseBlock ? elseBlock : mergeBlock);
+
+        m_block = thenBlock;
+        visit(*stmt.thenStmt());
+        jump(mergeBlock);
+
+        if (elseBlock)
+        {
+            m_block = elseBlock;
+            visit(*stmt.elseStmt());
+            jump(mergeBlock);
+        }
+
+        // Both branches may terminate
+        m_block = mergeBlock;
+
+        return nullptr;
+    }
+
+    /**
+     * @brief      Lower return statement.
+     *
+     * @param      stmt  The statement.
+     *
+     * @return     nullptr.
+     */
+    ViewPtr<ir::Value> visitReturnStmt(ast::ReturnStmt& stmt)
+    {
+        const auto offset = stmt.sourceRange().start();
+        const auto type   = m_function->returnType();
+
+        if (stmt.resExpr())
+        {
+            if (!type)
+                throw ast::SemanticError("function returns no value", offset);
+
+            auto value = rvalue(*stmt.resExpr());
+            check(value, type, offset);
+
+            emit<ir::InstructionReturn>(type, value);
+        }
+        else
+        {
+            if (type)
+                throw ast::SemanticError("missing return value", offset);
+
+            emit<ir::InstructionReturnVoid>();
+        }
+
+        m_block = nullptr;
+
+        return nullptr;
+    }
+
+    /**
+     * @brief      Lower while statement.
+     *
+     * @param      stmt  The statement.
+     *
+     * @return     nullptr.
+     */
+    ViewPtr<ir::Value> visitWhileStmt(ast::WhileStmt& stmt)
+    {
+        auto condBlock = createBlock();
+        auto bodyBlock = createBlock();
+        auto exitBlock = createBlock();
+
+        emit<ir::InstructionBranch>(condBlock);
+
+        m_block = condBlock;
+        branch(*stmt.condExpr(), bodyBlock, exitBlock);
+
+        m_loops.push_back({condBlock, exitBlock});
+
+        m_block = bodyBlock;
+        visit(*stmt.bodyStmt());
+
+        if (m_block)
+            emit<ir::InstructionBranch>(condBlock);
+
+        m_loops.pop_back();
+        m_block = exitBlock;
+
+        return nullptr;
+    }
+
+    /**
+     * @brief      Lower bool literal.
+     *
+     * @param      expr  The expression.
+     *
+     * @return     The constant.
+     */
+    ViewPtr<ir::Value> visitBoolLiteralExpr(ast::BoolLiteralExpr& expr)
+    {
+        return m_module.createConstant<ir::ConstInt1>(expr.value());
+    }
+
+    /**
+     * @brief      Lower int literal.
+     *
+     * @param      expr  The expression.
+     *
+     * @return     The constant.
+     */
+    ViewPtr<ir::Value> visitIntLiteralExpr(ast::IntLiteralExpr& expr)
+    {
+        return m_module.createConstant<ir::ConstInt32>(expr.value());
+    }
+
+    /**
+     * @brief      Lower float literal.
+     *
+     * @param      expr  The expression.
+     *
+     * @return     The constant.
+     */
+    ViewPtr<ir::Value> visitFloatLiteralExpr(ast::FloatLiteralExpr& expr)
+    {
+        return m_module.createConstant<ir::ConstFloat32>(expr.value());
+    }
+
+    /**
+     * @brief      Lower char literal.
+     *
+     * @param      expr  The expression.
+     *
+     * @return     The constant.
+     */
+    ViewPtr<ir::Value> visitCharLiteralExpr(ast::CharLiteralExpr& expr)
+    {
+        return m_module.createConstant<ir::ConstInt32>(
+            static_cast<std::int32_t>(expr.value()));
+    }
+
+    /**
+     * @brief      Lower binary expression.
+     *
+     * @param      expr  The expression.
+     *
+     * @return     The result value.
+     */
+    ViewPtr<ir::Value> visitBinaryExpr(ast::BinaryExpr& expr)
+    {
+        const auto offset = expr.sourceRange().start();
+        const auto& op    = expr.op();
+
+        // Short-circuit operators
+        if (op == "&&" || op == "||")
+            return condition(expr);
+
+        // Assignment
+        if (op == "=")
+        {
+            auto pointer = assignee(*expr.lhs());
+            auto value   = rvalue(*expr.rhs());
+            check(value, pointeeType(pointer), offset);
+
+            emit<ir::InstructionStore>(pointer, value);
+
+            return value;
+        }
+
+        // Compound assignment
+        if (!isOperation(op))
+        {
+            const auto arithmeticOp = StringView(op).substr(0, op.size() - 1);
+
+            auto pointer = assignee(*expr.lhs());
+            auto lhs     = emit<ir::InstructionLoad>(pointer)->result();
+            auto rhs     = rvalue(*expr.rhs());
+            auto value   = arithmetic(arithmeticOp, lhs, rhs, offset);
+
+            emit<ir::InstructionStore>(pointer, value);
+
+            return value;
+        }
+
+        // Left-deep chains like `a + b + c` are lowered iteratively, their
+        // depth is bounded only by the source size
+        Vector<ViewPtr<ast::BinaryExpr>> chain;
+        ViewPtr<ast::Expr> bottom = &expr;
+
+        while (bottom->is<ast::BinaryExpr>() &&
+               isOperation(bottom->cast<ast::BinaryExpr>().op()))
+        {
+            chain.push_back(&bottom->cast<ast::BinaryExpr>());
+            bottom = chain.back()->lhs().get();
+        }
+
+        auto value = rvalue(*bottom);
+
+        for (auto it = chain.rbegin(); it != chain.rend(); ++it)
+            value = operation(**it, value, rvalue(*(*it)->rhs()));
+
+        return value;
+    }
+
+    /**
+     * @brief      Lower prefix unary expression.
+     *
+     * @param      expr  The expression.
+     *
+     * @return     The result value.
+     */
+    ViewPtr<ir::Value> visitPrefixUnaryExpr(ast::PrefixUnaryExpr& expr)
+    {
+        const auto offset = expr.sourceRange().start();
+        const auto& op    = expr.op();
+
+        if (op == "!")
+            return condition(expr);
+
+        if (op == "++" || op == "--")
+            return increment(expr, true);
+
+        auto value = rvalue(*expr.expr());
+        auto type  = typeOf(value);
+
+        if (type->is<ir::TypeInt1>())
+            throw ast::SemanticError("invalid operand to " + op, offset);
+
+        if (op == "+")
+            return value;
+
+        if (op == "-")
+        {
+            return emit<ir::InstructionSub>(type, constant(type, 0), value)
+                ->result();
+        }
+
+        throw ast::SemanticError("unsupported operator " + op, offset);
+    }
+
+    /**
+     * @brief      Lower postfix unary expression.
+     *
+     * @param      expr  The expression.
+     *
+     * @return     The result value.
+     */
+    ViewPtr<ir::Value> visitPostfixUnaryExpr(ast::PostfixUnaryExpr& expr)
+    {
+        if (expr.op() == "++" || expr.op() == "--")
+            return increment(expr, false);
+
+        throw ast::SemanticError(
+            "unsupported operator " + expr.op(), expr.sourceRange().start());
+    }
+
+    /**
+     * @brief      Lower identifier.
+     *
+     * @param      expr  The expression.
+     *
+     * @return     The variable value.
+     */
+    ViewPtr<ir::Value> visitIdentifierExpr(ast::IdentifierExpr& expr)
+    {
+        return emit<ir::InstructionLoad>(slot(expr))->result();
+    }
+
+    /**
+     * @brief      Lower function call.
+     *
+     * @param      expr  The expression.
+     *
+     * @return     The call result or nullptr if function returns nothing.
+     */
+    ViewPtr<ir::Value> visitFunctionCallExpr(ast::FunctionCallExpr& expr)
+    {
+        const auto offset = expr.sourceRange().start();
+        auto& callee      = unwrap(*expr.expr());
+
+        if (!callee.is<ast::IdentifierExpr>())
+            throw ast::SemanticError("unsupported callee", offset);
+
+        const auto name = callee.cast<ast::IdentifierExpr>().name();
+
+        Vector<ViewPtr<ir::Value>> args;
+        args.reserve(expr.argsCount());
+
+        for (const auto& arg : expr.args())
+            args.push_back(rvalue(*arg));
+
+        // Functions outside of the source are resolved by the interpreter
+        auto function = m_functions.find(name);
+
+        if (!function)
+        {
+            emit<ir::InstructionCall>(name.str(), std::move(args));
+            return nullptr;
+        }
+
+        const auto& types = (*function)->parameterTypes();
+
+        if (args.size() != types.size())
+        {
+            throw ast::SemanticError(
+                "wrong number of arguments to '" + name.str() + "'", offset);
+        }
+
+        for (size_t i = 0; i < args.size(); ++i)
+            check(args[i], types[i], expr.arg(i)->sourceRange().start());
+
+        const auto type = (*function)->returnType();
+
+        if (!type)
+        {
+            emit<ir::InstructionCall>(name.str(), std::move(args));
+            return nullptr;
+        }
+
+        return emit<ir::InstructionCall>(name.str(), type, std::move(args))
+            ->result();
+    }
+
+    /**
+     * @brief      Lower parenthesized expression.
+     *
+     * @param      expr  The expression.
+     *
+     * @return     The inner expression value.
+     */
+    ViewPtr<ir::Value> visitParenExpr(ast::ParenExpr& expr)
+    {
+        return visit(*expr.expr());
+    }
+
+private:
+    // Types
+
+    /**
+     * @brief      Blocks of the innermost loop.
+     */
+    struct Loop
+    {
+        /// Block evaluating the loop condition, target of `continue`.
+        ViewPtr<ir::Block> condBlock;
+
+        /// Block after the loop, target of `break`.
+        ViewPtr<ir::Block> exitBlock;
+    };
+
+private:
+    // Operations
+
+    /**
+     * @brief      Create IR function for function declaration.
+     *
+     * @param      decl  The declaration.
+     */
+    void declare(ast::FunctionDecl& decl)
+    {
+        if (m_functions.find(decl.name()))
+        {
+            throw ast::SemanticError(
+                "redefinition of '" + decl.name().str() + "'",
+                decl.sourceRange().start());
+        }
+
+        Vector<ViewPtr<ir::Type>> types;
+        types.reserve(decl.parameters().size());
+
+        for (const auto& param : decl.parameters())
+        {
+            auto type = lowerType(param->type(), param->sourceRange().start());
+            types.push_back(type ? type : ir::TypeInt32::instance());
+        }
+
+        auto function = m_module.createFunction(
+            decl.name().str(), returnType(decl), std::move(types));
+
+        m_functions.insert(decl.name(), function);
+    }
+
+    /**
+     * @brief      Returns return type of function declaration.
+     *
+     * @param      decl  The declaration.
+     *
+     * @return     The type or nullptr if function returns nothing.
+     */
+    ViewPtr<ir::Type> returnType(ast::FunctionDecl& decl)
+    {
+        if (decl.retType() == "void")
+            return nullptr;
+
+        if (auto type = lowerType(decl.retType(), decl.sourceRange().start()))
+            return type;
+
+        // The traversal is stopped by a return with a value
+        if (ReturnFinder().traverse(decl.bodyStmt()))
+            return nullptr;
+
+        return ir::TypeInt32::instance();
+    }
+
+    /**
+     * @brief      Lower function body.
+     *
+     * @param      decl  The declaration.
+     */
+    void lower(ast::FunctionDecl& decl)
+    {
+        m_function = *m_functions.find(decl.name());
+        m_entry    = m_function->createBlock();
+        m_block    = m_function->createBlock();
+
+        auto bodyBlock = m_block;
+        auto scope     = m_scope.push();
+
+        // Parameters are stored in slots so they can be assigned
+        for (size_t i = 0; i < decl.parameters().size(); ++i)
+        {
+            auto pointer = allocate(
+                *decl.parameters()[i], m_function->parameterTypes()[i]);
+
+            m_entry->createInstruction<ir::InstructionStore>(
+                pointer, m_function->arg(i));
+        }
+
+        visit(*decl.bodyStmt());
+
+        if (m_block)
+        {
+            if (m_function->returnType())
+            {
+                throw ast::SemanticError(
+                    "missing return in function '" + decl.name().str() + "'",
+                    decl.sourceRange().end());
+            }
+
+            emit<ir::InstructionReturnVoid>();
+        }
+
+        // Entry block holds only slots
+        m_entry->createInstruction<ir::InstructionBranch>(bodyBlock);
+    }
+
+    /**
+     * @brief      Lower negated condition into a branch.
+     *
+     * @param      unary       The unary expression.
+     * @param      blockTrue   The block jump to if condition is true.
+     * @param      blockFalse  The block jump to if condition is false.
+     *
+     * @return     If the condition was lowered.
+     */
+    bool shortCircuit(
+        ast::PrefixUnaryExpr& unary,
+        ViewPtr<ir::Block> blockTrue,
+        ViewPtr<ir::Block> blockFalse)
+    {
+        if (unary.op() != "!")
+            return false;
+
+        branch(*unary.expr(), blockFalse, blockTrue);
+        return true;
+    }
+
+    /**
+     * @brief      Lower logical operator into branches.
+     *
+     * @param      binary      The binary expression.
+     * @param      blockTrue   The block jump to if condition is true.
+     * @param      blockFalse  The block jump to if condition is false.
+     *
+     * @return     If the condition was lowered.
+     */
+    bool shortCircuit(
+        ast::BinaryExpr& binary,
+        ViewPtr<ir::Block> blockTrue,
+        ViewPtr<ir::Block> blockFalse)
+    {
+        if (binary.op() == "&&")
+        {
+            auto next = createBlock();
+            branch(*binary.lhs(), next, blockFalse);
+
+            m_block = next;
+            branch(*binary.rhs(), blockTrue, blockFalse);
+            return true;
+        }
+
+        if (binary.op() == "||")
+        {
+            auto next = createBlock();
+            branch(*binary.lhs(), blockTrue, next);
+
+            m_block = next;
+            branch(*binary.rhs(), blockTrue, blockFalse);
+            return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief      Other conditions are not short-circuited.
+     *
+     * @return     `false`, the condition is lowered as a value.
+     */
+    bool shortCircuit(ast::Node&, ViewPtr<ir::Block>, ViewPtr<ir::Block>)
+    {
+        return false;
+    }
+
+    /**
+     * @brief      Lower condition into a branch.
+     *
+     * @param      expr        The condition.
+     * @param      blockTrue   The block jump to if condition is true.
+     * @param      blockFalse  The block jump to if condition is false.
+     */
+    void branch(
+        ast::Expr& expr,
+        ViewPtr<ir::Block> blockTrue,
+        ViewPtr<ir::Block> blockFalse)
+    {
+        auto& cond = unwrap(expr);
+
+        const bool lowered = ast::visit(cond, [&](auto& node) {
+            return shortCircuit(node, blockTrue, blockFalse);
+        });
+
+        if (lowered)
+            return;
+
+        auto value = rvalue(cond);
+
+        // Numbers are compared to zero
+        if (!typeOf(value)->is<ir::TypeInt1>())
+        {
+            const auto type = typeOf(value);
+
+            value = emit<ir::InstructionCmp>(
+                        ir::InstructionCmp::Operation::NotEqual,
+                        type,
+                        value,
+                        constant(type, 0))
+                        ->result();
+
+            m_booleans.insert(value);
+        }
+
+        emit<ir::InstructionBranchCondition>(value, blockTrue, blockFalse);
+        m_block = nullptr;
+    }
+
+    /**
+     * @brief      Lower logical expression into boolean value.
+     *
+     * @param      expr  The expression.
+     *
+     * @return     The boolean value.
+     */
+    ViewPtr<ir::Value> condition(ast::Expr& expr)
+    {
+        auto pointer = m_entry
+                           ->createInstruction<ir::InstructionAlloc>(
+                               ir::TypeInt1::instance())
+                           ->result();
+
+        auto blockTrue  = createBlock();
+        auto blockFalse = createBlock();
+        auto blockNext  = createBlock();
+
+        branch(expr, blockTrue, blockFalse);
+
+        m_block = blockTrue;
+        emit<ir::InstructionStore>(
+            pointer, m_module.createConstant<ir::ConstInt1>(true));
+        emit<ir::InstructionBranch>(blockNext);
+
+        m_block = blockFalse;
+        emit<ir::InstructionStore>(
+            pointer, m_module.createConstant<ir::ConstInt1>(false));
+        emit<ir::InstructionBranch>(blockNext);
+
+        m_block = blockNext;
+
+        return emit<ir::InstructionLoad>(pointer)->result();
+    }
+
+    /**
+     * @brief      Lower arithmetic or comparison operation of binary
+     *             expression with already lowered operands.
+     *
+     * @param      expr  The expression.
+     * @param      lhs   The left operand.
+     * @param      rhs   The right operand.
+     *
+     * @return     The result value.
+     */
+    ViewPtr<ir::Value> operation(
+        const ast::BinaryExpr& expr,
+        ViewPtr<ir::Value> lhs,
+        ViewPtr<ir::Value> rhs)
+    {
+        const auto offset = expr.sourceRange().start();
+        const auto& op    = expr.op();
+
+        if (const auto cmpOp = comparison(op))
+        {
+            const auto type = operandType(lhs, rhs, offset);
+
+            if (type->is<ir::TypeInt1>())
+                throw ast::SemanticError("invalid operands to " + op, offset);
+
+            auto result =
+                emit<ir::InstructionCmp>(*cmpOp, type, lhs, rhs)->result();
+
+            // Comparison results are booleans
+            m_booleans.insert(result);
+
+            return result;
+        }
+
+        return arithmetic(op, lhs, rhs, offset);
+    }
+
+    /**
+     * @brief      Lower arithmetic operation.
+     *
+     * @param      op      The operator.
+     * @param      lhs     The left operand.
+     * @param      rhs     The right operand.
+     * @param      offset  The source offset for error reporting.
+     *
+     * @return     The result value.
+     */
+    ViewPtr<ir::Value> arithmetic(
+        StringView op,
+        ViewPtr<ir::Value> lhs,
+        ViewPtr<ir::Value> rhs,
+        std::uint32_t offset)
+    {
+        const auto type = operandType(lhs, rhs, offset);
+
+        if (type->is<ir::TypeInt1>())
+        {
+            throw ast::SemanticError(
+                "invalid operands to " + String(op), offset);
+        }
+
+        if (op == "+")
+            return emit<ir::InstructionAdd>(type, lhs, rhs)->result();
+        else if (op == "-")
+            return emit<ir::InstructionSub>(type, lhs, rhs)->result();
+        else if (op == "*")
+            return emit<ir::InstructionMul>(type, lhs, rhs)->result();
+        else if (op == "/")
+            return emit<ir::InstructionDiv>(type, lhs, rhs)->result();
+
+        // Bitwise operators accept only integers
+        if (isFloat(*type))
+        {
+            throw ast::SemanticError(
+                "invalid operands to " + String(op), offset);
+        }
+
+        if (op == "%")
+            return emit<ir::InstructionRem>(type, lhs, rhs)->result();
+        else if (op == "&")
+            return emit<ir::InstructionAnd>(type, lhs, rhs)->result();
+        else if (op == "|")
+            return emit<ir::InstructionOr>(type, lhs, rhs)->result();
+        else if (op == "^")
+            return emit<ir::InstructionXor>(type, lhs, rhs)->result();
+
+        throw ast::SemanticError("unsupported operator " + String(op), offset);
+    }
+
+    /**
+     * @brief      Lower increment or decrement.
+     *
+     * @param      expr    The expression.
+     * @param      prefix  If the new value is the result.
+     *
+     * @return     The result value.
+     */
+    ViewPtr<ir::Value> increment(ast::UnaryExpr& expr, bool prefix)
+    {
+        auto pointer = assignee(*expr.expr());
+        auto value   = emit<ir::InstructionLoad>(pointer)->result();
+        auto one     = constant(typeOf(value), 1);
+
+        auto result = arithmetic(
+            expr.op() == "++" ? "+" : "-",
+            value,
+            one,
+            expr.sourceRange().start());
+
+        emit<ir::InstructionStore>(pointer, result);
+
+        return prefix ? result : value;
+    }
+
+    /**
+     * @brief      Lower expression which must have a value.
+     *
+     * @param      expr  The expression.
+     *
+     * @return     The value.
+     */
+    ViewPtr<ir::Value> rvalue(ast::Expr& expr)
+    {
+        auto value = visit(expr);
+
+        if (!value)
+        {
+            throw ast::SemanticError(
+                "expression has no value", expr.sourceRange().start());
+        }
+
+        return value;
+    }
+
+    /**
+     * @brief      Returns slot of assigned variable.
+     *
+     * @param      expr  The assigned expression.
+     *
+     * @return     The variable slot.
+     */
+    ViewPtr<ir::Value> assignee(ast::Expr& expr)
+    {
+        auto& target = unwrap(expr);
+
+        if (!target.is<ast::IdentifierExpr>())
+        {
+            throw ast::SemanticError(
+                "expression is not assignable", expr.sourceRange().start());
+        }
+
+        return slot(target.cast<ast::IdentifierExpr>());
+    }
+
+    /**
+     * @brief      Resolve identifier to variable slot.
+     *
+     * @param      expr  The identifier.
+     *
+     * @return     The variable slot.
+     */
+    ViewPtr<ir::Value> slot(ast::IdentifierExpr& expr)
+    {
+        auto decl = m_scope.findDecl(expr.name());
+
+        if (decl == nullptr)
+        {
+            throw ast::SemanticError(
+                "Symbol '" + expr.name().str() + "' not found",
+                expr.sourceRange().start());
+        }
+
+        expr.setDecl(decl);
+
+        return m_slots.at(decl);
+    }
+
+    /**
+     * @brief      Create variable slot in function entry block.
+     *
+     * @param      decl  The variable declaration.
+     * @param      type  The variable type.
+     *
+     * @return     The slot.
+     */
+    ViewPtr<ir::Value> allocate(ast::VariableDecl& decl, ViewPtr<ir::Type> type)
+    {
+        auto pointer =
+            m_entry->createInstruction<ir::InstructionAlloc>(type)->result();
+
+        m_scope.addDecl(&decl);
+        m_slots[&decl] = pointer;
+
+        return pointer;
+    }
+
+    /**
+     * @brief      Create constant of given type.
+     *
+     * @param      type   The type.
+     * @param      value  The value.
+     *
+     * @return     The constant.
+     */
+    ViewPtr<ir::Value> constant(ViewPtr<ir::Type> type, int value)
+    {
+        switch (type->kind())
+        {
+        case ir::TypeKind::Int1:
+            return m_module.createConstant<ir::ConstInt1>(value != 0);
+        case ir::TypeKind::Int8:
+            return m_module.createConstant<ir::ConstInt8>(value);
+        case ir::TypeKind::Int16:
+            return m_module.createConstant<ir::ConstInt16>(value);
+        case ir::TypeKind::Int32:
+            return m_module.createConstant<ir::ConstInt32>(value);
+        case ir::TypeKind::Int64:
+            return m_module.createConstant<ir::ConstInt64>(value);
+        case ir::TypeKind::Float32:
+            return m_module.createConstant<ir::ConstFloat32>(value);
+        case ir::TypeKind::Float64:
+            return m_module.createConstant<ir::ConstFloat64>(value);
+        default: throw std::invalid_argument("Unsupported constant type");
+        }
+    }
+
+    /**
+     * @brief      Returns type of value.
+     *
+     * @param      value  The value.
+     *
+     * @return     The type.
+     */
+    ViewPtr<ir::Type> typeOf(ViewPtr<ir::Value> value) const
+    {
+        // Comparison results are typed by their operands
+        if (m_booleans.count(value))
+            return ir::TypeInt1::instance();
+
+        return value->type();
+    }
+
+    /**
+     * @brief      Returns type pointed by variable slot.
+     *
+     * @param      pointer  The slot.
+     *
+     * @return     The type.
+     */
+    static ViewPtr<ir::Type> pointeeType(ViewPtr<ir::Value> pointer)
+    {
+        return pointer->type<ir::TypePointer>().type();
+    }
+
+    /**
+     * @brief      Returns common type of binary operation operands.
+     *
+     * @param      lhs     The left operand.
+     * @param      rhs     The right operand.
+     * @param      offset  The source offset for error reporting.
+     *
+     * @return     The type.
+     */
+    ViewPtr<ir::Type> operandType(
+        ViewPtr<ir::Value> lhs,
+        ViewPtr<ir::Value> rhs,
+        std::uint32_t offset) const
+    {
+        const auto type = typeOf(lhs);
+        check(rhs, type, offset);
+
+        return type;
+    }
+
+    /**
+     * @brief      Check if value has required type.
+     *
+     * @param      value   The value.
+     * @param      type    The required type.
+     * @param      offset  The source offset for error reporting.
+     */
+    void check(
+        ViewPtr<ir::Value> value,
+        ViewPtr<ir::Type> type,
+        std::uint32_t offset) const
+    {
+        if (!typeOf(value)->equals(*type))
+            throw ast::SemanticError("incompatible types", offset);
+    }
+
+    /**
+     * @brief      Jump from current block, if it's not terminated.
+     *
+     * @param      block  The target block, created on demand.
+     */
+    void jump(ViewPtr<ir::Block>& block)
+    {
+        if (!m_block)
+            return;
+
+        if (!block)
+            block = createBlock();
+
+        emit<ir::InstructionBranch>(block);
+    }
+
+    /**
+     * @brief      Create a new block in current function.
+     *
+     * @return     The block.
+     */
+    ViewPtr<ir::Block> createBlock()
+    {
+        return m_function->createBlock();
+    }
+
+    /**
+     * @brief      Create instruction in current block.
+     *
+     * @param      args  The instruction arguments.
+     *
+     * @tparam     T     Instruction type.
+     * @tparam     Args  Argument types.
+     *
+     * @return     The instruction.
+     */
+    template<typename T, typename... Args>
+    ViewPtr<T> emit(Args&&... args)
+    {
+        SHARD_ASSERT(m_block);
+        return m_block->createInstruction<T>(std::forward<Args>(args)...);
+    }
+
+private:
+    // Data Members
+
+    /// The output module.
+    ir::Module& m_module;
+
+    /// Functions declared in source.
+    SymbolMap<ViewPtr<ir::Function>> m_functions;
+
+    /// Current function.
+    ViewPtr<ir::Function> m_function;
+
+    /// Entry block of current function holding variable slots.
+    ViewPtr<ir::Block> m_entry;
+
+    /// Current block, nullptr when the code is unreachable.
+    ViewPtr<ir::Block> m_block;
+
+    /// Enclosing loops.
+    Vector<Loop> m_loops;
+
+    /// Visible declarations.
+    ast::AnalysisContext m_scope;
+
+    /// Variable slots.
+    HashMap<ViewPtr<const ast::Decl>, ViewPtr<ir::Value>> m_slots;
+
+    /// Values holding comparison result.
+    Set<ViewPtr<const ir::Value>> m_booleans;
+};
+
+/* ************************************************************************* */
+
+} // namespace
+
+/* ************************************************************************* */
+
+ir::Module generate(ast::Source& source)
+{
+    ir::Module module;
+    Generator(module).generate(source);
+
+    return module;
+}
+
+/* ************************************************************************* */
+
+} // namespace shard::codegen
+
+/* ************************************************************************* */
@@ -0,0 +1,263 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// Declaration
+#include "shard/driver/Cache.hpp"
+
+// C++
+#include <algorithm>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <sstream>
+
+// Shard
+#include "shard/String.hpp"
+#include "shard/driver/compile.hpp"
+#include "shard/ir/Serializer.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::driver {
+
+/* ************************************************************************* */
+
+namespace {
+
+/* ************************************************************************* */
+
+#if __has_include(<filesystem>)
+namespace fs = std::filesystem;
+#else
+namespace fs = std::experimental::filesystem;
+#endif
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Returns unique suffix for temporary files.
+ *
+ * @return     The suffix.
+ */
+String temporarySuffix()
+{
+    std::random_device device;
+    std::ostringstream os;
+    os << ".tmp" << std::hex << device() << device();
+    return os.str();
+}
+
+/* ************************************************************************* */
+
+/// Magic bytes of cache entry.
+constexpr char Magic[4] = {'S', 'H', 'C', 'E'};
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Write little-endian integer.
+ *
+ * @param      output  The output stream.
+ * @param      value   The value.
+ * @param      size    Number of bytes.
+ */
+void writeInt(std::ostream& output, std::uint64_t value, std::size_t size)
+{
+    for (std::size_t i = 0; i < size; ++i)
+        output.put(static_cast<char>((value >> (8 * i)) & 0xFF));
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Read little-endian integer.
+ *
+ * @param      input  The input stream.
+ * @param      size   Number of bytes.
+ *
+ * @return     The value.
+ */
+std::uint64_t readInt(std::istream& input, std::size_t size)
+{
+    std::uint64_t value = 0;
+
+    for (std::size_t i = 0; i < size; ++i)
+        value |= std::uint64_t(static_cast<unsigned char>(input.get()))
+                 << (8 * i);
+
+    return value;
+}
+
+/* ************************************************************************* */
+
+} // namespace
+
+/* ************************************************************************* */
+
+String Cache::tag()
+{
+    return "shard-" SHARD_VERSION "-" + toString(Version);
+}
+
+/* ************************************************************************* */
+
+FilePath Cache::path(const tokenizer::Source& source) const
+{
+    const auto content = source.source();
+
+    std::ostringstream os;
+    os << std::hex << std::setw(16) << std::setfill('0') << hash(content)
+       << "-" << std::dec << content.size() << ".ir";
+
+    return m_directory / tag() / os.str();
+}
+
+/* ************************************************************************* */
+
+Optional<ir::Module> Cache::load(const tokenizer::Source& source) const
+{
+    std::ifstream file(path(source), std::ios::in | std::ios::binary);
+
+    if (!file.is_open())
+        return {};
+
+    // Truncated entries must not be read as garbage
+    file.exceptions(std::ios::failbit | std::ios::badbit);
+
+    try
+    {
+        char magic[sizeof(Magic)];
+        file.read(magic, sizeof(magic));
+
+        if (!std::equal(magic, magic + sizeof(magic), Magic))
+            return {};
+
+        // Entry must belong to the source
+        const auto content = source.source();
+
+        if (readInt(file, 8) != hash(content) ||
+            readInt(file, 8) != content.size())
+            return {};
+
+        // Hash and length can collide, the stored content cannot
+        String stored(content.size(), '\0');
+        file.read(stored.data(), stored.size());
+
+        if (stored != content)
+            return {};
+
+        return ir::deserialize(file);
+    }
+    catch (const std::exception&)
+    {
+        return {};
+    }
+}
+
+/* ************************************************************************* */
+
+bool Cache::store(const tokenizer::Source& source, const ir::Module& module)
+    const
+{
+    const auto target = path(source);
+
+    std::error_code error;
+    fs::create_directories(target.parent_path(), error);
+
+    if (error)
+        return false;
+
+    const auto temporary = FilePath(target.string() + temporarySuffix());
+
+    {
+        std::ofstream file(
+            temporary, std::ios::out | std::ios::binary | std::ios::trunc);
+
+        if (!file.is_open())
+            return false;
+
+        const auto content = source.source();
+
+        file.write(Magic, sizeof(Magic));
+        writeInt(file, hash(content), 8);
+        writeInt(file, content.size(), 8);
+        file.write(content.data(), content.size());
+
+        try
+        {
+            ir::serialize(file, module);
+            file.flush();
+        }
+        catch (const std::exception&)
+        {
+            // Module cannot be represented, e.g. unsupported type
+            file.setstate(std::ios::failbit);
+        }
+
+        if (!file)
+        {
+            file.close();
+            fs::remove(temporary, error);
+            return false;
+        }
+    }
+
+    // Replace entry at once
+    fs::rename(temporary, target, error);
+
+    if (error)
+    {
+        fs::remove(temporary, error);
+        return false;
+    }
+
+    return true;
+}
+
+/* ************************************************************************* */
+
+ir::Module Cache::compile(tokenizer::Source& source) const
+{
+    if (auto module = load(source))
+        return std::move(*module);
+
+    auto module = driver::compile(source);
+    store(source, module);
+
+    return module;
+}
+
+/* ************************************************************************* */
+
+std::uint64_t Cache::hash(StringView content) noexcept
+{
+    std::uint64_t result = 0xcbf29ce484222325;
+
+    for (const char c : content)
+    {
+        result ^= static_cast<unsigned char>(c);
+        result *= 0x100000001b3;
+    }
+
+    return result;
+}
+
+/* ************************************************************************* */
+
+} // namespace shard::driver
+
+/* ************************************************************************* */
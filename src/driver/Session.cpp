@@ -0,0 +1,191 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// Declaration
+#include "shard/driver/Session.hpp"
+
+// C++
+#include <cstddef>
+#include <exception>
+#include <utility>
+
+// Shard
+#include "shard/Assert.hpp"
+#include "shard/ast/AnalysisContext.hpp"
+#include "shard/ast/exceptions.hpp"
+#include "shard/ast/decl/FunctionDecl.hpp"
+#include "shard/builtin/Parser.hpp"
+#include "shard/driver/exceptions.hpp"
+#include "shard/tokenizer/Tokenizer.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::driver {
+
+/* ************************************************************************* */
+
+namespace {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Rethrow source error with source filename.
+ *
+ * @param      source  The source.
+ * @param      error   The error.
+ */
+[[noreturn]] void rethrow(
+    const tokenizer::Source& source,
+    const std::exception_ptr& error)
+{
+    try
+    {
+        std::rethrow_exception(error);
+    }
+    catch (const ast::SemanticError& err)
+    {
+        // AST knows only offsets, resolve location for the report
+        throw SourceError(
+            source.filename(), err.what(), source.location(err.offset()));
+    }
+    catch (const LocationError& err)
+    {
+        throw SourceError(source.filename(), err.message(), err.location());
+    }
+}
+
+/* ************************************************************************* */
+
+} // namespace
+
+/* ************************************************************************* */
+
+ThreadPool& Session::pool()
+{
+    if (!m_pool)
+        m_pool = makeUnique<ThreadPool>(m_threadCount);
+
+    return *m_pool;
+}
+
+/* ************************************************************************* */
+
+void Session::parse()
+{
+    const auto count = m_sources.size();
+
+    m_asts.clear();
+    m_asts.resize(count);
+
+    Vector<std::exception_ptr> errors(count);
+
+    pool().parallelFor(count, [this, &errors](unsigned, std::size_t i) {
+        try
+        {
+            tokenizer::Tokenizer tokenizer(*m_sources[i]);
+            builtin::Parser parser(tokenizer);
+
+            m_asts[i] = parser.parseSource();
+        }
+        catch (...)
+        {
+            errors[i] = std::current_exception();
+        }
+    });
+
+    // Report in source order independently of scheduling
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (errors[i])
+            rethrow(*m_sources[i], errors[i]);
+    }
+}
+
+/* ************************************************************************* */
+
+void Session::analyse()
+{
+    SHARD_ASSERT(m_asts.size() == m_sources.size());
+
+    ast::AnalysisContext context(&ast::AnalysisContext::builtins());
+
+    // Merge top-level functions into the global scope
+    for (std::size_t i = 0; i < m_asts.size(); ++i)
+    {
+        try
+        {
+            m_asts[i].declare(context);
+        }
+        catch (const ast::SemanticError&)
+        {
+            rethrow(*m_sources[i], std::current_exception());
+        }
+    }
+
+    // Global variables are visible only after their declaration
+    for (std::size_t i = 0; i < m_asts.size(); ++i)
+    {
+        try
+        {
+            m_asts[i].analyseGlobals(context);
+        }
+        catch (const ast::SemanticError&)
+        {
+            rethrow(*m_sources[i], std::current_exception());
+        }
+    }
+
+    // Bodies see only the globals and their own locals, functions of all
+    // sources are analysed as a single batch
+    Vector<std::pair<std::size_t, ViewPtr<ast::FunctionDecl>>> items;
+
+    for (std::size_t i = 0; i < m_asts.size(); ++i)
+    {
+        for (auto decl : m_asts[i].functions())
+            items.emplace_back(i, decl);
+    }
+
+    Vector<std::exception_ptr> errors(items.size());
+
+    // Scopes leave a context empty, so each worker reuses its own
+    Vector<ast::AnalysisContext> locals(
+        pool().size(), ast::AnalysisContext(&context));
+
+    pool().parallelFor(
+        items.size(),
+        [&locals, &items, &errors](unsigned worker, std::size_t i) {
+            try
+            {
+                items[i].second->analyse(locals[worker]);
+            }
+            catch (...)
+            {
+                errors[i] = std::current_exception();
+            }
+        });
+
+    for (std::size_t i = 0; i < items.size(); ++i)
+    {
+        if (errors[i])
+            rethrow(*m_sources[items[i].first], errors[i]);
+    }
+}
+
+/* ************************************************************************* */
+
+} // namespace shard::driver
+
+/* ************************************************************************* */
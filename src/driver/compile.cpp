@@ -0,0 +1,60 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// Declaration
+#include "shard/driver/compile.hpp"
+
+// Shard
+#include "shard/ast/Source.hpp"
+#include "shard/ast/exceptions.hpp"
+#include "shard/builtin/Parser.hpp"
+#include "shard/codegen/Codegen.hpp"
+#include "shard/exceptions.hpp"
+#include "shard/tokenizer/Tokenizer.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::driver {
+
+/* ************************************************************************* */
+
+ir::Module compile(tokenizer::Source& source)
+{
+    auto tokenizer = tokenizer::Tokenizer{source};
+    auto parser    = builtin::Parser{tokenizer};
+
+    // Parse source
+    auto ast = parser.parseSource();
+
+    try
+    {
+        // Same checks as a session, nothing invalid reaches the cache
+        ast.analyse();
+
+        return codegen::generate(ast);
+    }
+    catch (const ast::SemanticError& err)
+    {
+        // AST knows only offsets, resolve location for the report
+        throw LocationError(err.what(), source.location(err.offset()));
+    }
+}
+
+/* ************************************************************************* */
+
+} // namespace shard::driver
+
+/* ************************************************************************* */
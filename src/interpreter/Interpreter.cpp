@@ -23,10 +23,16 @@
 // Shard
 #include "shard/interpreter/Exception.hpp"
 #include "shard/ir/Block.hpp"
+#include "shard/ir/Clone.hpp"
 #include "shard/ir/Constant.hpp"
+#include "shard/ir/DominatorTree.hpp"
 #include "shard/ir/Function.hpp"
+#include "shard/ir/Gvn.hpp"
 #include "shard/ir/Instruction.hpp"
+#include "shard/ir/Licm.hpp"
+#include "shard/ir/LoopInfo.hpp"
 #include "shard/ir/Module.hpp"
+#include "shard/ir/SimplifyCfg.hpp"
 
 /* ************************************************************************* */
 
@@ -82,6 +88,8 @@ Value castTo(T value, const ir::Type& type)
 {
     switch (type.kind())
     {
+    case ir::TypeKind::Int1: return Value{bool(value)};
+
     case ir::TypeKind::Int8: return Value{int8_t(value)};
 
     case ir::TypeKind::Int16: return Value{int16_t(value)};
@@ -276,18 +284,127 @@ Value Interpreter::call(StringView name, const Vector<Value>& args)
     if (function == nullptr)
         throw Exception("Unable to find function: " + String(name));
 
+    return call(*function, args);
+}
+
+/* ************************************************************************* */
+
+ViewPtr<const ir::Function> Interpreter::optimized(
+    const ir::Function& function) const
+{
+    auto it = m_functions.find(&function);
+
+    if (it == m_functions.end())
+        return nullptr;
+
+    return it->second.optimized.get();
+}
+
+/* ************************************************************************* */
+
+ViewPtr<const JitFunction> Interpreter::compiled(
+    const ir::Function& function) const
+{
+    auto it = m_functions.find(&function);
+
+    if (it == m_functions.end())
+        return nullptr;
+
+    return it->second.code.get();
+}
+
+/* ************************************************************************* */
+
+ViewPtr<const JitFunction> Interpreter::osrCode(
+    const ir::Function& function) const
+{
+    auto it = m_functions.find(&function);
+
+    if (it == m_functions.end())
+        return nullptr;
+
+    return it->second.osr.get();
+}
+
+/* ************************************************************************* */
+
+Value Interpreter::call(const ir::Function& function, const Vector<Value>& args)
+{
+    // References to unordered map elements are stable
+    auto& state = m_functions[&function];
+    ++state.calls;
+
+    const bool hot =
+        (m_tierUpThreshold && state.calls >= m_tierUpThreshold) ||
+        (m_osrThreshold && state.backedges >= m_osrThreshold);
+
+    if (!state.promoted && hot)
+        promote(function, state);
+
+    if (state.code)
+        return state.code->call(*this, args);
+
+    if (state.optimized)
+        return interpret(*state.optimized, args, nullptr);
+
+    return interpret(function, args, &state);
+}
+
+/* ************************************************************************* */
+
+Value Interpreter::interpret(
+    const ir::Function& function,
+    const Vector<Value>& args,
+    ViewPtr<FunctionState> state)
+{
+    if (state && m_osrThreshold && !state->analyzed)
+        analyze(function, *state);
+
     // Create new stack
     m_stack.push({});
 
     // Copy arguments to the frame
     for (size_t i = 0; i < args.size(); ++i)
-        currentFrame().value(*function->arg(i)) = args[i];
+        currentFrame().value(*function.arg(i)) = args[i];
+
+    ViewPtr<const ir::Block> block = function.blocks().front().get();
+
+    while (block)
+    {
+        currentFrame().nextBlock() = nullptr;
+        evalBlock(*block);
 
-    // Eval the first block
-    evalBlock(*function->blocks().front());
+        const auto next = currentFrame().nextBlock();
+
+        if (state && state->loopEdges.count({block, next}))
+        {
+            if (m_osrThreshold && ++state->backedges >= m_osrThreshold)
+            {
+                if (!state->osrCompiled)
+                {
+                    state->osrCompiled = true;
+                    state->osr = JitFunction::compile(function, state->headers);
+                }
+
+                // Continue the loop in native code
+                if (state->osr)
+                {
+                    auto result =
+                        state->osr->enter(*this, *next, currentFrame());
+                    m_stack.pop();
+                    return result;
+                }
+            }
+        }
+
+        block = next;
+    }
 
     // Copy result from stack
-    auto result = castTo(m_stack.top().result(), *function->returnType());
+    Value result;
+
+    if (function.returnType())
+        result = castTo(m_stack.top().result(), *function.returnType());
 
     m_stack.pop();
 
@@ -296,6 +413,39 @@ Value Interpreter::call(StringView name, const Vector<Value>& args)
 
 /* ************************************************************************* */
 
+void Interpreter::promote(const ir::Function& function, FunctionState& state)
+{
+    state.promoted  = true;
+    state.optimized = ir::clone(function);
+
+    ir::simplifyCfg(*state.optimized);
+    ir::licm(*state.optimized);
+    ir::gvn(*state.optimized);
+    ir::simplifyCfg(*state.optimized);
+
+    state.code = JitFunction::compile(*state.optimized);
+}
+
+/* ************************************************************************* */
+
+void Interpreter::analyze(const ir::Function& function, FunctionState& state)
+{
+    state.analyzed = true;
+
+    const ir::DominatorTree tree(function);
+    const ir::LoopInfo info(function, tree);
+
+    for (const auto& loop : info.allLoops())
+    {
+        state.headers.push_back(loop->header());
+
+        for (auto latch : loop->latches())
+            state.loopEdges.insert({latch, loop->header()});
+    }
+}
+
+/* ************************************************************************* */
+
 Value Interpreter::fetchValue(const ir::Value& value)
 {
     if (!value.isConst())
@@ -357,7 +507,7 @@ Value Interpreter::fetchValue(const ir::Value& value)
 
 void Interpreter::evalBlock(const ir::Block& block)
 {
-    // Just evaluate all instructions
+    // Just evaluate all instructions, branches only set the next block
     for (const auto& instr : block.instructions())
         evalInstruction(*instr);
 }
@@ -602,7 +752,7 @@ void Interpreter::evalInstruction(const ir::InstructionXor& instr)
 void Interpreter::evalInstruction(const ir::InstructionBranch& instr)
 {
     // Jump to other block
-    evalBlock(*instr.block());
+    currentFrame().nextBlock() = instr.block();
 }
 
 /* ************************************************************************* */
@@ -613,11 +763,11 @@ void Interpreter::evalInstruction(const ir::InstructionBranchCondition& instr)
 
     if (cond.get<bool>())
     {
-        evalBlock(*instr.blockTrue());
+        currentFrame().nextBlock() = instr.blockTrue();
     }
     else
     {
-        evalBlock(*instr.blockFalse());
+        currentFrame().nextBlock() = instr.blockFalse();
     }
 }
 
@@ -635,7 +785,8 @@ void Interpreter::evalInstruction(const ir::InstructionCall& instr)
     auto res = call(instr.name(), args);
 
     // Store result value
-    currentFrame().value(*instr.result()) = res;
+    if (instr.result())
+        currentFrame().value(*instr.result()) = res;
 }
 
 /* ************************************************************************* */
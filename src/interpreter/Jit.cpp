@@ -0,0 +1,1332 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// Declaration
+#include "shard/interpreter/Jit.hpp"
+
+// C++
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+// Shard
+#include "shard/HashMap.hpp"
+#include "shard/Set.hpp"
+#include "shard/interpreter/Exception.hpp"
+#include "shard/interpreter/Frame.hpp"
+#include "shard/interpreter/Interpreter.hpp"
+#include "shard/ir/Block.hpp"
+#include "shard/ir/Constant.hpp"
+#include "shard/ir/Function.hpp"
+#include "shard/ir/Instruction.hpp"
+
+/* ************************************************************************* */
+
+#if SHARD_INTERPRETER_JIT && defined(__x86_64__) && \
+    (defined(__unix__) || defined(__APPLE__))
+#define SHARD_JIT_X86_64 1
+#include <sys/mman.h>
+#include <unistd.h>
+#else
+#define SHARD_JIT_X86_64 0
+#endif
+
+/* ************************************************************************* */
+
+namespace shard::interpreter {
+
+/* ************************************************************************* */
+
+namespace {
+
+/* ************************************************************************* */
+
+/// Exception thrown by a function called from compiled code.
+thread_local std::exception_ptr s_exception;
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Returns if type kind is a fundamental type.
+ *
+ * @param      kind  The type kind.
+ *
+ * @return     True if fundamental, False otherwise.
+ */
+bool isFundamental(ir::TypeKind kind) noexcept
+{
+    return kind != ir::TypeKind::Pointer && kind != ir::TypeKind::Struct;
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Returns if type is a fundamental type.
+ *
+ * @param      type  The type.
+ *
+ * @return     True if fundamental, False otherwise.
+ */
+bool isFundamental(ViewPtr<const ir::Type> type) noexcept
+{
+    return type && isFundamental(type->kind());
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Returns if type kind is a floating point type.
+ *
+ * @param      kind  The type kind.
+ *
+ * @return     True if float, False otherwise.
+ */
+bool isFloat(ir::TypeKind kind) noexcept
+{
+    return kind == ir::TypeKind::Float32 || kind == ir::TypeKind::Float64;
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Convert value to raw bits used by compiled code.
+ *
+ * @details    Integers are sign extended to 64 bits, floats are stored in
+ *             the low bits.
+ *
+ * @param      value  The value.
+ * @param      kind   The required type.
+ *
+ * @return     The bits.
+ */
+std::uint64_t toBits(const Value& value, ir::TypeKind kind)
+{
+    return value.visit([kind](auto val) -> std::uint64_t {
+        if constexpr (std::is_same_v<decltype(val), std::monostate>)
+        {
+            return 0;
+        }
+        else
+        {
+            switch (kind)
+            {
+            case ir::TypeKind::Int1: return val ? 1 : 0;
+            case ir::TypeKind::Int8:
+                return static_cast<std::int64_t>(static_cast<std::int8_t>(val));
+            case ir::TypeKind::Int16:
+                return static_cast<std::int64_t>(
+                    static_cast<std::int16_t>(val));
+            case ir::TypeKind::Int32:
+                return static_cast<std::int64_t>(
+                    static_cast<std::int32_t>(val));
+            case ir::TypeKind::Int64: return static_cast<std::int64_t>(val);
+
+            case ir::TypeKind::Float32:
+            {
+                const float number = static_cast<float>(val);
+                std::uint32_t bits;
+                std::memcpy(&bits, &number, sizeof(bits));
+                return bits;
+            }
+
+            case ir::TypeKind::Float64:
+            {
+                const double number = static_cast<double>(val);
+                std::uint64_t bits;
+                std::memcpy(&bits, &number, sizeof(bits));
+                return bits;
+            }
+
+            default: throw Exception("Unsupported value type");
+            }
+        }
+    });
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Convert raw bits used by compiled code into value.
+ *
+ * @param      bits  The bits.
+ * @param      kind  The value type.
+ *
+ * @return     The value.
+ */
+Value fromBits(std::uint64_t bits, ir::TypeKind kind)
+{
+    switch (kind)
+    {
+    case ir::TypeKind::Int1: return Value{bits != 0};
+    case ir::TypeKind::Int8: return Value{static_cast<std::int8_t>(bits)};
+    case ir::TypeKind::Int16: return Value{static_cast<std::int16_t>(bits)};
+    case ir::TypeKind::Int32: return Value{static_cast<std::int32_t>(bits)};
+    case ir::TypeKind::Int64: return Value{static_cast<std::int64_t>(bits)};
+
+    case ir::TypeKind::Float32:
+    {
+        const auto low = static_cast<std::uint32_t>(bits);
+        float number;
+        std::memcpy(&number, &low, sizeof(number));
+        return Value{number};
+    }
+
+    case ir::TypeKind::Float64:
+    {
+        double number;
+        std::memcpy(&number, &bits, sizeof(number));
+        return Value{number};
+    }
+
+    default: throw Exception("Unsupported value type");
+    }
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Returns raw bits of a constant.
+ *
+ * @param      value  The constant.
+ *
+ * @return     The bits.
+ */
+std::uint64_t constantBits(const ir::Value& value)
+{
+    const auto kind = value.type()->kind();
+
+    switch (kind)
+    {
+    case ir::TypeKind::Int1:
+        return toBits(static_cast<const ir::ConstInt1&>(value).value(), kind);
+    case ir::TypeKind::Int8:
+        return toBits(static_cast<const ir::ConstInt8&>(value).value(), kind);
+    case ir::TypeKind::Int16:
+        return toBits(static_cast<const ir::ConstInt16&>(value).value(), kind);
+    case ir::TypeKind::Int32:
+        return toBits(static_cast<const ir::ConstInt32&>(value).value(), kind);
+    case ir::TypeKind::Int64:
+        return toBits(static_cast<const ir::ConstInt64&>(value).value(), kind);
+    case ir::TypeKind::Float32:
+        return toBits(
+            static_cast<const ir::ConstFloat32&>(value).value(), kind);
+    case ir::TypeKind::Float64:
+        return toBits(
+            static_cast<const ir::ConstFloat64&>(value).value(), kind);
+    default: throw Exception("Unsupported constant type");
+    }
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Call function from compiled code.
+ *
+ * @details    Exceptions cannot be propagated through compiled code, they are
+ *             stored and rethrown when compiled code returns.
+ *
+ * @param      interpreter  The interpreter.
+ * @param      site         The call site.
+ * @param      args         The arguments.
+ * @param      result       Result destination.
+ *
+ * @return     Zero on success, non-zero if the call has thrown.
+ */
+std::uint64_t callFunction(
+    Interpreter* interpreter,
+    const JitFunction::CallSite* site,
+    const std::uint64_t* args,
+    std::uint64_t* result) noexcept
+{
+    try
+    {
+        Vector<Value> values;
+        values.reserve(site->argumentTypes.size());
+
+        for (size_t i = 0; i < site->argumentTypes.size(); ++i)
+            values.push_back(fromBits(args[i], site->argumentTypes[i]));
+
+        const auto value = interpreter->call(site->name, values);
+
+        *result = site->returnType && !value.isNothing()
+                      ? toBits(value, site->returnType->kind())
+                      : 0;
+
+        return 0;
+    }
+    catch (...)
+    {
+        s_exception = std::current_exception();
+        return 1;
+    }
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      General purpose registers.
+ */
+enum class Reg : std::uint8_t
+{
+    Rax = 0,
+    Rcx = 1,
+    Rdx = 2,
+    Rsi = 6,
+    Rdi = 7,
+};
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Conditions codes for SETcc and Jcc.
+ */
+enum class Cond : std::uint8_t
+{
+    Below        = 0x2,
+    AboveEqual   = 0x3,
+    Equal        = 0x4,
+    NotEqual     = 0x5,
+    BelowEqual   = 0x6,
+    Above        = 0x7,
+    Parity       = 0xA,
+    NotParity    = 0xB,
+    Less         = 0xC,
+    GreaterEqual = 0xD,
+    LessEqual    = 0xE,
+    Greater      = 0xF,
+};
+
+/* ************************************************************************* */
+
+/**
+ * @brief      x86-64 machine code writer.
+ *
+ * @details    Memory operands are always relative to RBP with 32-bit
+ *             displacement.
+ */
+class Assembler
+{
+
+public:
+    // Accessors & Mutators
+
+    /**
+     * @brief      Returns generated code.
+     *
+     * @return     The code.
+     */
+    const Vector<std::uint8_t>& code() const noexcept
+    {
+        return m_code;
+    }
+
+    /**
+     * @brief      Returns current code position.
+     *
+     * @return     The position.
+     */
+    std::size_t position() const noexcept
+    {
+        return m_code.size();
+    }
+
+public:
+    // Operations
+
+    void bytes(std::initializer_list<std::uint8_t> values)
+    {
+        m_code.insert(m_code.end(), values.begin(), values.end());
+    }
+
+    void imm32(std::int32_t value)
+    {
+        for (int i = 0; i < 4; ++i)
+            m_code.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+    }
+
+    void imm64(std::uint64_t value)
+    {
+        for (int i = 0; i < 8; ++i)
+            m_code.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+    }
+
+    /// ModRM for [rbp + disp32] with register.
+    void memory(std::uint8_t reg, std::int32_t offset)
+    {
+        m_code.push_back(0x85 | (reg << 3));
+        imm32(offset);
+    }
+
+    /// mov reg, [rbp + offset]
+    void load(Reg reg, std::int32_t offset)
+    {
+        bytes({0x48, 0x8B});
+        memory(static_cast<std::uint8_t>(reg), offset);
+    }
+
+    /// mov [rbp + offset], reg
+    void store(std::int32_t offset, Reg reg)
+    {
+        bytes({0x48, 0x89});
+        memory(static_cast<std::uint8_t>(reg), offset);
+    }
+
+    /// lea reg, [rbp + offset]
+    void lea(Reg reg, std::int32_t offset)
+    {
+        bytes({0x48, 0x8D});
+        memory(static_cast<std::uint8_t>(reg), offset);
+    }
+
+    /// mov reg, imm64
+    void move(Reg reg, std::uint64_t value)
+    {
+        bytes({0x48, static_cast<std::uint8_t>(0xB8 + static_cast<int>(reg))});
+        imm64(value);
+    }
+
+    /// movq xmm, [rbp + offset]
+    void loadXmm(std::uint8_t xmm, std::int32_t offset)
+    {
+        bytes({0xF3, 0x0F, 0x7E});
+        memory(xmm, offset);
+    }
+
+    /// movq [rbp + offset], xmm0
+    void storeXmm0(std::int32_t offset)
+    {
+        bytes({0x66, 0x0F, 0xD6});
+        memory(0, offset);
+    }
+
+    /// movq xmm, rax
+    void moveXmm(std::uint8_t xmm)
+    {
+        const auto modrm = static_cast<std::uint8_t>(0xC0 | xmm << 3);
+        bytes({0x66, 0x48, 0x0F, 0x6E, modrm});
+    }
+
+    /// Scalar SSE operation xmm0, xmm1.
+    void sse(bool dbl, std::uint8_t opcode)
+    {
+        const auto prefix = static_cast<std::uint8_t>(dbl ? 0xF2 : 0xF3);
+        bytes({prefix, 0x0F, opcode, 0xC1});
+    }
+
+    /// setcc reg8; reg is AL or CL
+    void set(Cond cond, Reg reg)
+    {
+        bytes({0x0F,
+               static_cast<std::uint8_t>(0x90 | static_cast<int>(cond)),
+               static_cast<std::uint8_t>(0xC0 | static_cast<int>(reg))});
+    }
+
+    /// jmp rel32, returns position of displacement
+    std::size_t jump()
+    {
+        bytes({0xE9});
+        imm32(0);
+        return position() - 4;
+    }
+
+    /// jcc rel32, returns position of displacement
+    std::size_t jump(Cond cond)
+    {
+        bytes({0x0F, static_cast<std::uint8_t>(0x80 | static_cast<int>(cond))});
+        imm32(0);
+        return position() - 4;
+    }
+
+    /// Patch jump displacement to target position.
+    void patch(std::size_t at, std::size_t target)
+    {
+        const auto disp = static_cast<std::int32_t>(target - (at + 4));
+        std::memcpy(&m_code[at], &disp, sizeof(disp));
+    }
+
+    /// leave; ret
+    void leave()
+    {
+        bytes({0xC9, 0xC3});
+    }
+
+private:
+    // Data Members
+
+    /// Generated code.
+    Vector<std::uint8_t> m_code;
+};
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Translates IR function into machine code.
+ */
+class Compiler
+{
+
+public:
+    // Ctors & Dtors
+
+    /**
+     * @brief      Constructor.
+     *
+     * @param      function  The function.
+     */
+    explicit Compiler(const ir::Function& function)
+        : m_function(function)
+    {
+        // Nothing to do
+    }
+
+public:
+    // Accessors & Mutators
+
+    /**
+     * @brief      Returns generated code.
+     *
+     * @return     The code.
+     */
+    const Vector<std::uint8_t>& code() const noexcept
+    {
+        return m_asm.code();
+    }
+
+    /**
+     * @brief      Returns call sites referenced by code.
+     *
+     * @return     The call sites.
+     */
+    PtrVector<JitFunction::CallSite>& callSites() noexcept
+    {
+        return m_callSites;
+    }
+
+    /**
+     * @brief      Returns value slots in frame order.
+     *
+     * @return     The slots.
+     */
+    Vector<JitFunction::Slot>& slots() noexcept
+    {
+        return m_slotList;
+    }
+
+    /**
+     * @brief      Returns block entry points.
+     *
+     * @return     The entry points.
+     */
+    HashMap<ViewPtr<const ir::Block>, std::size_t>& entries() noexcept
+    {
+        return m_entries;
+    }
+
+public:
+    // Operations
+
+    /**
+     * @brief      Generate function code.
+     *
+     * @param      entries  Blocks where execution can enter from a frame.
+     */
+    void compile(const Vector<ViewPtr<const ir::Block>>& entries)
+    {
+        allocateSlots();
+
+        // Arguments occupy the first slots
+        prologue(m_function.arguments().size());
+
+        for (const auto& block : m_function.blocks())
+        {
+            m_labels[block.get()] = m_asm.position();
+
+            for (const auto& instr : block->instructions())
+                compileInstruction(*instr);
+
+            // Falling out of block returns from the function
+            if (!block->terminator())
+                returnVoid();
+        }
+
+        // Abort execution when called function has thrown
+        const auto abort = m_asm.position();
+        returnVoid();
+
+        // Block entries load all slots and continue at the block
+        for (auto block : entries)
+        {
+            m_entries[block] = m_asm.position();
+            prologue(m_slotList.size());
+            m_jumps.push_back({m_asm.jump(), block});
+        }
+
+        for (const auto& [at, block] : m_jumps)
+            m_asm.patch(at, m_labels.at(block));
+
+        for (auto at : m_aborts)
+            m_asm.patch(at, abort);
+    }
+
+private:
+    // Constants
+
+    /// Frame offset of the interpreter pointer.
+    static constexpr std::int32_t InterpreterOffset = -8;
+
+private:
+    // Operations
+
+    /**
+     * @brief      Assign stack slots to function values.
+     */
+    void allocateSlots()
+    {
+        std::int32_t offset = InterpreterOffset;
+        size_t arguments    = 0;
+
+        auto assign = [&](const ir::Value& value, ir::TypeKind kind) {
+            offset -= 8;
+            m_slots[&value] = offset;
+            m_slotList.push_back({&value, kind});
+        };
+
+        for (const auto& arg : m_function.arguments())
+            assign(*arg, arg->type()->kind());
+
+        for (const auto& block : m_function.blocks())
+        {
+            for (const auto& instr : block->instructions())
+            {
+                if (instr->is<ir::InstructionAlloc>())
+                {
+                    const auto& alloc = instr->as<ir::InstructionAlloc>();
+                    assign(*alloc.result(), alloc.type()->kind());
+                }
+                else if (instr->is<ir::InstructionCmp>())
+                {
+                    // Comparison results are booleans
+                    assign(*instr->result(), ir::TypeKind::Int1);
+                    m_booleans.insert(instr->result());
+                }
+                else if (instr->result())
+                {
+                    assign(*instr->result(), instr->result()->type()->kind());
+                }
+
+                if (instr->is<ir::InstructionCall>())
+                {
+                    const auto& call = instr->as<ir::InstructionCall>();
+                    arguments = std::max(arguments, call.arguments().size());
+                }
+            }
+        }
+
+        // Result of void calls
+        offset -= 8;
+        m_scratchOffset = offset;
+
+        // Call arguments
+        offset -= static_cast<std::int32_t>(8 * arguments);
+        m_argumentsOffset = offset;
+
+        m_frameSize = (-offset + 15) & ~15;
+    }
+
+    /**
+     * @brief      Returns value slot offset.
+     *
+     * @param      value  The value.
+     *
+     * @return     The offset from RBP.
+     */
+    std::int32_t slot(const ir::Value& value) const
+    {
+        return m_slots.at(&value);
+    }
+
+    /**
+     * @brief      Emit function prologue.
+     *
+     * @details    Slots are initialized from the data array passed in RDI.
+     *
+     * @param      count  Number of initialized slots.
+     */
+    void prologue(std::size_t count)
+    {
+        m_asm.bytes({0x55});             // push rbp
+        m_asm.bytes({0x48, 0x89, 0xE5}); // mov rbp, rsp
+        m_asm.bytes({0x48, 0x81, 0xEC}); // sub rsp, imm32
+        m_asm.imm32(m_frameSize);
+
+        // Interpreter pointer
+        m_asm.store(InterpreterOffset, Reg::Rsi);
+
+        // mov rax, [rdi + 8 * i]
+        for (size_t i = 0; i < count; ++i)
+        {
+            m_asm.bytes({0x48, 0x8B, 0x87});
+            m_asm.imm32(static_cast<std::int32_t>(8 * i));
+            m_asm.store(slot(*m_slotList[i].value), Reg::Rax);
+        }
+    }
+
+    /**
+     * @brief      Load value into general purpose register.
+     *
+     * @param      reg    The register.
+     * @param      value  The value.
+     */
+    void loadInt(Reg reg, const ir::Value& value)
+    {
+        if (value.isConst())
+            m_asm.move(reg, constantBits(value));
+        else
+            m_asm.load(reg, slot(value));
+    }
+
+    /**
+     * @brief      Load value into SSE register.
+     *
+     * @param      xmm    The register number.
+     * @param      value  The value.
+     */
+    void loadFloat(std::uint8_t xmm, const ir::Value& value)
+    {
+        if (value.isConst())
+        {
+            m_asm.move(Reg::Rax, constantBits(value));
+            m_asm.moveXmm(xmm);
+        }
+        else
+        {
+            m_asm.loadXmm(xmm, slot(value));
+        }
+    }
+
+    /**
+     * @brief      Sign extend RAX to canonical form of the type.
+     *
+     * @param      kind  The type kind.
+     */
+    void normalize(ir::TypeKind kind)
+    {
+        switch (kind)
+        {
+        case ir::TypeKind::Int8:
+            m_asm.bytes({0x48, 0x0F, 0xBE, 0xC0}); // movsx rax, al
+            break;
+        case ir::TypeKind::Int16:
+            m_asm.bytes({0x48, 0x0F, 0xBF, 0xC0}); // movsx rax, ax
+            break;
+        case ir::TypeKind::Int32:
+            m_asm.bytes({0x48, 0x63, 0xC0}); // movsxd rax, eax
+            break;
+        default: break;
+        }
+    }
+
+    /**
+     * @brief      Emit return without value.
+     */
+    void returnVoid()
+    {
+        m_asm.bytes({0x31, 0xC0}); // xor eax, eax
+        m_asm.leave();
+    }
+
+    /**
+     * @brief      Compile binary instruction.
+     *
+     * @param      instr  The instruction.
+     *
+     * @tparam     T      The instruction type.
+     */
+    template<typename T>
+    void compileBinary(const ir::Instruction& instr)
+    {
+        const auto& binary = instr.as<T>();
+        const auto kind    = binary.type()->kind();
+
+        if (isFloat(kind))
+        {
+            const bool dbl = kind == ir::TypeKind::Float64;
+
+            loadFloat(0, *binary.value1());
+            loadFloat(1, *binary.value2());
+
+            switch (instr.kind())
+            {
+            case ir::InstructionKind::Add: m_asm.sse(dbl, 0x58); break;
+            case ir::InstructionKind::Sub: m_asm.sse(dbl, 0x5C); break;
+            case ir::InstructionKind::Mul: m_asm.sse(dbl, 0x59); break;
+            case ir::InstructionKind::Div: m_asm.sse(dbl, 0x5E); break;
+            default: throw Exception("Unsupported float operation");
+            }
+
+            m_asm.storeXmm0(slot(*binary.result()));
+            return;
+        }
+
+        loadInt(Reg::Rax, *binary.value1());
+        loadInt(Reg::Rcx, *binary.value2());
+
+        switch (instr.kind())
+        {
+        case ir::InstructionKind::Add:
+            m_asm.bytes({0x48, 0x01, 0xC8}); // add rax, rcx
+            break;
+        case ir::InstructionKind::Sub:
+            m_asm.bytes({0x48, 0x29, 0xC8}); // sub rax, rcx
+            break;
+        case ir::InstructionKind::Mul:
+            m_asm.bytes({0x48, 0x0F, 0xAF, 0xC1}); // imul rax, rcx
+            break;
+        case ir::InstructionKind::Div:
+            m_asm.bytes({0x48, 0x99});       // cqo
+            m_asm.bytes({0x48, 0xF7, 0xF9}); // idiv rcx
+            break;
+        case ir::InstructionKind::Rem:
+            m_asm.bytes({0x48, 0x99});       // cqo
+            m_asm.bytes({0x48, 0xF7, 0xF9}); // idiv rcx
+            m_asm.bytes({0x48, 0x89, 0xD0}); // mov rax, rdx
+            break;
+        case ir::InstructionKind::And:
+            m_asm.bytes({0x48, 0x21, 0xC8}); // and rax, rcx
+            break;
+        case ir::InstructionKind::Or:
+            m_asm.bytes({0x48, 0x09, 0xC8}); // or rax, rcx
+            break;
+        case ir::InstructionKind::Xor:
+            m_asm.bytes({0x48, 0x31, 0xC8}); // xor rax, rcx
+            break;
+        default: throw Exception("Unsupported integer operation");
+        }
+
+        normalize(kind);
+        m_asm.store(slot(*binary.result()), Reg::Rax);
+    }
+
+    /**
+     * @brief      Compile comparison instruction.
+     *
+     * @param      instr  The instruction.
+     */
+    void compileCmp(const ir::InstructionCmp& instr)
+    {
+        using Operation = ir::InstructionCmp::Operation;
+
+        const auto kind = instr.type()->kind();
+
+        if (isFloat(kind))
+        {
+            const auto op = instr.operation();
+
+            // Less comparisons are greater comparisons with swapped operands
+            // so unordered operands give false
+            const bool swap =
+                op == Operation::LessThan || op == Operation::LessEqual;
+
+            loadFloat(swap ? 1 : 0, *instr.value1());
+            loadFloat(swap ? 0 : 1, *instr.value2());
+
+            // ucomiss/ucomisd xmm0, xmm1
+            if (kind == ir::TypeKind::Float64)
+                m_asm.bytes({0x66, 0x0F, 0x2E, 0xC1});
+            else
+                m_asm.bytes({0x0F, 0x2E, 0xC1});
+
+            switch (op)
+            {
+            case Operation::Equal:
+                m_asm.set(Cond::Equal, Reg::Rax);
+                m_asm.set(Cond::NotParity, Reg::Rcx);
+                m_asm.bytes({0x20, 0xC8}); // and al, cl
+                break;
+            case Operation::NotEqual:
+                m_asm.set(Cond::NotEqual, Reg::Rax);
+                m_asm.set(Cond::Parity, Reg::Rcx);
+                m_asm.bytes({0x08, 0xC8}); // or al, cl
+                break;
+            case Operation::GreaterThan:
+            case Operation::LessThan: m_asm.set(Cond::Above, Reg::Rax); break;
+            case Operation::GreaterEqual:
+            case Operation::LessEqual:
+                m_asm.set(Cond::AboveEqual, Reg::Rax);
+                break;
+            }
+        }
+        else
+        {
+            loadInt(Reg::Rax, *instr.value1());
+            loadInt(Reg::Rcx, *instr.value2());
+            m_asm.bytes({0x48, 0x39, 0xC8}); // cmp rax, rcx
+
+            switch (instr.operation())
+            {
+            case Operation::Equal: m_asm.set(Cond::Equal, Reg::Rax); break;
+            case Operation::NotEqual:
+                m_asm.set(Cond::NotEqual, Reg::Rax);
+                break;
+            case Operation::GreaterThan:
+                m_asm.set(Cond::Greater, Reg::Rax);
+                break;
+            case Operation::GreaterEqual:
+                m_asm.set(Cond::GreaterEqual, Reg::Rax);
+                break;
+            case Operation::LessThan: m_asm.set(Cond::Less, Reg::Rax); break;
+            case Operation::LessEqual:
+                m_asm.set(Cond::LessEqual, Reg::Rax);
+                break;
+            }
+        }
+
+        m_asm.bytes({0x0F, 0xB6, 0xC0}); // movzx eax, al
+        m_asm.store(slot(*instr.result()), Reg::Rax);
+    }
+
+    /**
+     * @brief      Compile function call.
+     *
+     * @param      instr  The instruction.
+     */
+    void compileCall(const ir::InstructionCall& instr)
+    {
+        auto site        = makeUnique<JitFunction::CallSite>();
+        site->name       = instr.name();
+        site->returnType = instr.resultType();
+
+        for (size_t i = 0; i < instr.arguments().size(); ++i)
+        {
+            const auto& arg = *instr.arguments()[i];
+
+            // Comparison results are booleans
+            site->argumentTypes.push_back(
+                m_booleans.count(&arg) ? ir::TypeKind::Int1
+                                       : arg.type()->kind());
+
+            loadInt(Reg::Rax, arg);
+            m_asm.store(
+                m_argumentsOffset + static_cast<std::int32_t>(8 * i),
+                Reg::Rax);
+        }
+
+        const auto result =
+            instr.result() ? slot(*instr.result()) : m_scratchOffset;
+
+        m_asm.load(Reg::Rdi, InterpreterOffset);
+        m_asm.move(Reg::Rsi, reinterpret_cast<std::uint64_t>(site.get()));
+        m_asm.lea(Reg::Rdx, m_argumentsOffset);
+        m_asm.lea(Reg::Rcx, result);
+        m_asm.move(Reg::Rax, reinterpret_cast<std::uint64_t>(&callFunction));
+        m_asm.bytes({0xFF, 0xD0});       // call rax
+        m_asm.bytes({0x48, 0x85, 0xC0}); // test rax, rax
+        m_aborts.push_back(m_asm.jump(Cond::NotEqual));
+
+        m_callSites.push_back(std::move(site));
+    }
+
+    /**
+     * @brief      Compile instruction.
+     *
+     * @param      instr  The instruction.
+     */
+    void compileInstruction(const ir::Instruction& instr)
+    {
+        switch (instr.kind())
+        {
+        case ir::InstructionKind::Alloc: break;
+
+        case ir::InstructionKind::Store:
+        {
+            const auto& store = instr.as<ir::InstructionStore>();
+            loadInt(Reg::Rax, *store.value());
+            m_asm.store(slot(*store.pointer()), Reg::Rax);
+            break;
+        }
+
+        case ir::InstructionKind::Load:
+        {
+            const auto& load = instr.as<ir::InstructionLoad>();
+            m_asm.load(Reg::Rax, slot(*load.pointer()));
+            m_asm.store(slot(*load.result()), Reg::Rax);
+            break;
+        }
+
+        case ir::InstructionKind::Add:
+            compileBinary<ir::InstructionAdd>(instr);
+            break;
+        case ir::InstructionKind::Sub:
+            compileBinary<ir::InstructionSub>(instr);
+            break;
+        case ir::InstructionKind::Mul:
+            compileBinary<ir::InstructionMul>(instr);
+            break;
+        case ir::InstructionKind::Div:
+            compileBinary<ir::InstructionDiv>(instr);
+            break;
+        case ir::InstructionKind::Rem:
+            compileBinary<ir::InstructionRem>(instr);
+            break;
+        case ir::InstructionKind::And:
+            compileBinary<ir::InstructionAnd>(instr);
+            break;
+        case ir::InstructionKind::Or:
+            compileBinary<ir::InstructionOr>(instr);
+            break;
+        case ir::InstructionKind::Xor:
+            compileBinary<ir::InstructionXor>(instr);
+            break;
+
+        case ir::InstructionKind::Cmp:
+            compileCmp(instr.as<ir::InstructionCmp>());
+            break;
+
+        case ir::InstructionKind::Branch:
+            m_jumps.push_back(
+                {m_asm.jump(), instr.as<ir::InstructionBranch>().block()});
+            break;
+
+        case ir::InstructionKind::BranchCondition:
+        {
+            const auto& branch = instr.as<ir::InstructionBranchCondition>();
+            loadInt(Reg::Rax, *branch.condition());
+            m_asm.bytes({0x48, 0x85, 0xC0}); // test rax, rax
+            m_jumps.push_back({m_asm.jump(Cond::NotEqual), branch.blockTrue()});
+            m_jumps.push_back({m_asm.jump(), branch.blockFalse()});
+            break;
+        }
+
+        case ir::InstructionKind::Call:
+            compileCall(instr.as<ir::InstructionCall>());
+            break;
+
+        case ir::InstructionKind::Return:
+            loadInt(Reg::Rax, *instr.as<ir::InstructionReturn>().value());
+            m_asm.leave();
+            break;
+
+        case ir::InstructionKind::ReturnVoid: returnVoid(); break;
+        }
+    }
+
+private:
+    // Data Members
+
+    /// Compiled function.
+    const ir::Function& m_function;
+
+    /// Code writer.
+    Assembler m_asm;
+
+    /// Value slots.
+    HashMap<ViewPtr<const ir::Value>, std::int32_t> m_slots;
+
+    /// Value slots in frame order.
+    Vector<JitFunction::Slot> m_slotList;
+
+    /// Block entry points.
+    HashMap<ViewPtr<const ir::Block>, std::size_t> m_entries;
+
+    /// Values holding comparison result.
+    Set<ViewPtr<const ir::Value>> m_booleans;
+
+    /// Frame offset of void call results.
+    std::int32_t m_scratchOffset = 0;
+
+    /// Frame offset of call arguments.
+    std::int32_t m_argumentsOffset = 0;
+
+    /// Frame size.
+    std::int32_t m_frameSize = 0;
+
+    /// Block positions.
+    HashMap<ViewPtr<const ir::Block>, std::size_t> m_labels;
+
+    /// Jumps to patch.
+    Vector<std::pair<std::size_t, ViewPtr<const ir::Block>>> m_jumps;
+
+    /// Jumps to abort code.
+    Vector<std::size_t> m_aborts;
+
+    /// Call sites.
+    PtrVector<JitFunction::CallSite> m_callSites;
+};
+
+/* ************************************************************************* */
+
+} // namespace
+
+/* ************************************************************************* */
+
+JitFunction::JitFunction(
+    const ir::Function& function,
+    const Vector<std::uint8_t>& code,
+    PtrVector<CallSite> callSites,
+    Vector<Slot> slots,
+    HashMap<ViewPtr<const ir::Block>, std::size_t> entries)
+    : m_function(&function)
+    , m_codeSize(code.size())
+    , m_callSites(std::move(callSites))
+    , m_slots(std::move(slots))
+    , m_entries(std::move(entries))
+{
+#if SHARD_JIT_X86_64
+    const auto page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    m_memorySize    = (code.size() + page - 1) / page * page;
+
+    m_memory = mmap(
+        nullptr,
+        m_memorySize,
+        PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS,
+        -1,
+        0);
+
+    if (m_memory == MAP_FAILED)
+        throw Exception("Unable to allocate executable memory");
+
+    std::memcpy(m_memory, code.data(), code.size());
+
+    // Memory is never writable and executable at the same time
+    if (mprotect(m_memory, m_memorySize, PROT_READ | PROT_EXEC) != 0)
+    {
+        munmap(m_memory, m_memorySize);
+        throw Exception("Unable to make memory executable");
+    }
+#else
+    throw Exception("JIT compilation is not available");
+#endif
+}
+
+/* ************************************************************************* */
+
+JitFunction::~JitFunction()
+{
+#if SHARD_JIT_X86_64
+    munmap(m_memory, m_memorySize);
+#endif
+}
+
+/* ************************************************************************* */
+
+bool JitFunction::isAvailable() noexcept
+{
+    return SHARD_JIT_X86_64;
+}
+
+/* ************************************************************************* */
+
+bool JitFunction::isCompilable(const ir::Function& function)
+{
+    if (function.blocks().empty())
+        return false;
+
+    if (function.returnType() && !isFundamental(function.returnType()))
+        return false;
+
+    Set<ViewPtr<const ir::Value>> values;
+    Set<ViewPtr<const ir::Value>> pointers;
+
+    for (const auto& arg : function.arguments())
+    {
+        if (!isFundamental(arg->type()))
+            return false;
+
+        values.insert(arg.get());
+    }
+
+    for (const auto& block : function.blocks())
+    {
+        for (const auto& instr : block->instructions())
+        {
+            if (instr->is<ir::InstructionAlloc>())
+            {
+                const auto& alloc = instr->as<ir::InstructionAlloc>();
+
+                if (!isFundamental(alloc.type()) || alloc.count() != 1)
+                    return false;
+
+                pointers.insert(alloc.result());
+            }
+            else if (instr->result())
+            {
+                if (!isFundamental(instr->result()->type()))
+                    return false;
+
+                values.insert(instr->result());
+            }
+        }
+    }
+
+    auto isOperand = [&](ViewPtr<const ir::Value> value) {
+        if (value->isConst())
+            return isFundamental(value->type());
+
+        return values.count(value) != 0;
+    };
+
+    for (const auto& block : function.blocks())
+    {
+        for (const auto& instr : block->instructions())
+        {
+            switch (instr->kind())
+            {
+            case ir::InstructionKind::Store:
+            {
+                const auto& store = instr->as<ir::InstructionStore>();
+
+                if (store.index() != 0 || !pointers.count(store.pointer()) ||
+                    !isOperand(store.value()))
+                    return false;
+
+                continue;
+            }
+
+            case ir::InstructionKind::Load:
+            {
+                const auto& load = instr->as<ir::InstructionLoad>();
+
+                if (load.index() != 0 || !pointers.count(load.pointer()))
+                    return false;
+
+                continue;
+            }
+
+            case ir::InstructionKind::Add:
+            case ir::InstructionKind::Sub:
+            case ir::InstructionKind::Mul:
+            case ir::InstructionKind::Div:
+            case ir::InstructionKind::Cmp:
+            {
+                const auto kind = instr->result()->type()->kind();
+
+                if (kind == ir::TypeKind::Int1)
+                    return false;
+
+                break;
+            }
+
+            case ir::InstructionKind::Rem:
+            case ir::InstructionKind::And:
+            case ir::InstructionKind::Or:
+            case ir::InstructionKind::Xor:
+            {
+                const auto kind = instr->result()->type()->kind();
+
+                if (kind == ir::TypeKind::Int1 || isFloat(kind))
+                    return false;
+
+                break;
+            }
+
+            default: break;
+            }
+
+            for (auto operand : instr->operands())
+            {
+                if (!isOperand(operand))
+                    return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/* ************************************************************************* */
+
+UniquePtr<JitFunction> JitFunction::compile(
+    const ir::Function& function,
+    const Vector<ViewPtr<const ir::Block>>& entries)
+{
+    if (!isAvailable() || !isCompilable(function))
+        return nullptr;
+
+    Compiler compiler(function);
+    compiler.compile(entries);
+
+    return makeUnique<JitFunction>(
+        function,
+        compiler.code(),
+        std::move(compiler.callSites()),
+        std::move(compiler.slots()),
+        std::move(compiler.entries()));
+}
+
+/* ************************************************************************* */
+
+Value JitFunction::call(Interpreter& interpreter, const Vector<Value>& args)
+    const
+{
+    const auto& types = m_function->parameterTypes();
+
+    if (args.size() != types.size())
+        throw Exception("Invalid number of arguments");
+
+    Vector<std::uint64_t> bits(args.size());
+
+    for (size_t i = 0; i < args.size(); ++i)
+        bits[i] = toBits(args[i], types[i]->kind());
+
+    return run(interpreter, 0, bits);
+}
+
+/* ************************************************************************* */
+
+Value JitFunction::enter(
+    Interpreter& interpreter,
+    const ir::Block& block,
+    Frame& frame) const
+{
+    Vector<std::uint64_t> bits(m_slots.size());
+
+    // Values not computed yet are nothing and become zero
+    for (size_t i = 0; i < m_slots.size(); ++i)
+        bits[i] = toBits(frame.value(*m_slots[i].value), m_slots[i].kind);
+
+    return run(interpreter, m_entries.at(&block), bits);
+}
+
+/* ************************************************************************* */
+
+Value JitFunction::run(
+    Interpreter& interpreter,
+    std::size_t offset,
+    const Vector<std::uint64_t>& data) const
+{
+    const auto entry = reinterpret_cast<Entry>(
+        static_cast<std::uint8_t*>(m_memory) + offset);
+    const auto result = entry(data.data(), &interpreter);
+
+    if (s_exception)
+        std::rethrow_exception(std::exchange(s_exception, nullptr));
+
+    if (!m_function->returnType())
+        return {};
+
+    return fromBits(result, m_function->returnType()->kind());
+}
+
+/* ************************************************************************* */
+
+} // namespace shard::interpreter
+
+/* ************************************************************************* */
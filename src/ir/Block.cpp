@@ -0,0 +1,56 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// Declaration
+#include "shard/ir/Block.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::ir {
+
+/* ************************************************************************* */
+
+Vector<ViewPtr<Block>> Block::successors() const
+{
+    const auto term = terminator();
+
+    if (!term)
+        return {};
+
+    switch (term->kind())
+    {
+    case InstructionKind::Branch:
+        return {term->as<InstructionBranch>().block()};
+
+    case InstructionKind::BranchCondition:
+    {
+        const auto& branch = term->as<InstructionBranchCondition>();
+
+        if (branch.blockTrue() == branch.blockFalse())
+            return {branch.blockTrue()};
+
+        return {branch.blockTrue(), branch.blockFalse()};
+    }
+
+    default: return {};
+    }
+}
+
+/* ************************************************************************* */
+
+} // namespace shard::ir
+
+/* ************************************************************************* */
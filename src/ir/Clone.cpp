@@ -0,0 +1,212 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// Declaration
+#include "shard/ir/Clone.hpp"
+
+// Shard
+#include "shard/HashMap.hpp"
+#include "shard/ir/Block.hpp"
+#include "shard/ir/Function.hpp"
+#include "shard/ir/Instruction.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::ir {
+
+/* ************************************************************************* */
+
+namespace {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Copy binary instruction.
+ *
+ * @param      block  The destination block.
+ * @param      instr  The instruction.
+ *
+ * @tparam     T      The instruction type.
+ *
+ * @return     The copy.
+ */
+template<typename T>
+ViewPtr<Instruction> cloneBinary(Block& block, const Instruction& instr)
+{
+    const auto& binary = instr.as<T>();
+
+    return block.createInstruction<T>(
+        binary.type(), binary.value1(), binary.value2());
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Copy instruction.
+ *
+ * @details    Operands still refer to values of the original function.
+ *
+ * @param      block   The destination block.
+ * @param      instr   The instruction.
+ * @param      blocks  Mapping of original blocks to copied ones.
+ *
+ * @return     The copy.
+ */
+ViewPtr<Instruction> cloneInstruction(
+    Block& block,
+    const Instruction& instr,
+    const HashMap<ViewPtr<const Block>, ViewPtr<Block>>& blocks)
+{
+    switch (instr.kind())
+    {
+    case InstructionKind::Alloc:
+    {
+        const auto& alloc = instr.as<InstructionAlloc>();
+        return block.createInstruction<InstructionAlloc>(
+            alloc.type(), alloc.count());
+    }
+
+    case InstructionKind::Store:
+    {
+        const auto& store = instr.as<InstructionStore>();
+        return block.createInstruction<InstructionStore>(
+            store.pointer(), store.value(), store.index());
+    }
+
+    case InstructionKind::Load:
+    {
+        const auto& load = instr.as<InstructionLoad>();
+        return block.createInstruction<InstructionLoad>(
+            load.pointer(), load.index());
+    }
+
+    case InstructionKind::Add: return cloneBinary<InstructionAdd>(block, instr);
+    case InstructionKind::Sub: return cloneBinary<InstructionSub>(block, instr);
+    case InstructionKind::Mul: return cloneBinary<InstructionMul>(block, instr);
+    case InstructionKind::Div: return cloneBinary<InstructionDiv>(block, instr);
+    case InstructionKind::Rem: return cloneBinary<InstructionRem>(block, instr);
+    case InstructionKind::And: return cloneBinary<InstructionAnd>(block, instr);
+    case InstructionKind::Or: return cloneBinary<InstructionOr>(block, instr);
+    case InstructionKind::Xor: return cloneBinary<InstructionXor>(block, instr);
+
+    case InstructionKind::Cmp:
+    {
+        const auto& cmp = instr.as<InstructionCmp>();
+        return block.createInstruction<InstructionCmp>(
+            cmp.operation(), cmp.type(), cmp.value1(), cmp.value2());
+    }
+
+    case InstructionKind::Branch:
+    {
+        const auto& branch = instr.as<InstructionBranch>();
+        return block.createInstruction<InstructionBranch>(
+            blocks.at(branch.block()));
+    }
+
+    case InstructionKind::BranchCondition:
+    {
+        const auto& branch = instr.as<InstructionBranchCondition>();
+        return block.createInstruction<InstructionBranchCondition>(
+            branch.condition(),
+            blocks.at(branch.blockTrue()),
+            blocks.at(branch.blockFalse()));
+    }
+
+    case InstructionKind::Call:
+    {
+        const auto& call = instr.as<InstructionCall>();
+
+        if (call.resultType())
+        {
+            return block.createInstruction<InstructionCall>(
+                call.name(), call.resultType(), call.arguments());
+        }
+
+        return block.createInstruction<InstructionCall>(
+            call.name(), call.arguments());
+    }
+
+    case InstructionKind::Return:
+    {
+        const auto& ret = instr.as<InstructionReturn>();
+        return block.createInstruction<InstructionReturn>(
+            ret.type(), ret.value());
+    }
+
+    case InstructionKind::ReturnVoid:
+        return block.createInstruction<InstructionReturnVoid>();
+    }
+
+    return nullptr;
+}
+
+/* ************************************************************************* */
+
+} // namespace
+
+/* ************************************************************************* */
+
+UniquePtr<Function> clone(const Function& function)
+{
+    auto result = makeUnique<Function>(
+        function.name(), function.returnType(), function.parameterTypes());
+
+    HashMap<ViewPtr<const Block>, ViewPtr<Block>> blocks;
+    HashMap<ViewPtr<const Value>, ViewPtr<Value>> values;
+
+    for (size_t i = 0; i < function.arguments().size(); ++i)
+        values[function.arg(i)] = result->arg(i);
+
+    // Blocks first so branches can refer to them
+    for (const auto& block : function.blocks())
+        blocks[block.get()] = result->createBlock();
+
+    Vector<ViewPtr<Instruction>> instructions;
+
+    for (const auto& block : function.blocks())
+    {
+        for (const auto& instr : block->instructions())
+        {
+            auto copy =
+                cloneInstruction(*blocks.at(block.get()), *instr, blocks);
+
+            if (instr->result())
+                values[instr->result()] = copy->result();
+
+            instructions.push_back(copy);
+        }
+    }
+
+    // Values can be used before definition in block order
+    for (auto instr : instructions)
+    {
+        for (auto operand : instr->operands())
+        {
+            auto it = values.find(ViewPtr<const Value>(operand));
+
+            if (it != values.end())
+                instr->replaceUsesOf(operand, it->second);
+        }
+    }
+
+    return result;
+}
+
+/* ************************************************************************* */
+
+} // namespace shard::ir
+
+/* ************************************************************************* */
@@ -0,0 +1,186 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// Declaration
+#include "shard/ir/DominatorTree.hpp"
+
+// C++
+#include <algorithm>
+#include <utility>
+
+// Shard
+#include "shard/ir/Block.hpp"
+#include "shard/ir/Function.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::ir {
+
+/* ************************************************************************* */
+
+DominatorTree::DominatorTree(const Function& function)
+{
+    const auto entry = function.entryBlock();
+
+    if (!entry)
+        return;
+
+    // Post-order traversal
+    {
+        Map<ViewPtr<const Block>, bool> visited;
+        Vector<std::pair<ViewPtr<Block>, size_t>> stack{{entry, 0}};
+        visited[entry] = true;
+
+        while (!stack.empty())
+        {
+            auto& top        = stack.back();
+            const auto succs = top.first->successors();
+
+            if (top.second < succs.size())
+            {
+                const auto succ = succs[top.second++];
+
+                if (!visited[succ])
+                {
+                    visited[succ] = true;
+                    stack.push_back({succ, 0});
+                }
+            }
+            else
+            {
+                m_blocks.push_back(top.first);
+                stack.pop_back();
+            }
+        }
+    }
+
+    std::reverse(m_blocks.begin(), m_blocks.end());
+
+    for (size_t i = 0; i < m_blocks.size(); ++i)
+        m_indices[m_blocks[i]] = i;
+
+    constexpr size_t undefined = static_cast<size_t>(-1);
+
+    m_nodes.resize(m_blocks.size(), Node{undefined, {}, 0, 0});
+    m_nodes[0].idom = 0;
+
+    const auto predecessors = function.predecessors();
+
+    auto intersect = [this](size_t first, size_t second) {
+        // Blocks with higher index are deeper in the tree
+        while (first != second)
+        {
+            while (first > second)
+                first = m_nodes[first].idom;
+
+            while (second > first)
+                second = m_nodes[second].idom;
+        }
+
+        return first;
+    };
+
+    for (bool changed = true; changed;)
+    {
+        changed = false;
+
+        for (size_t i = 1; i < m_blocks.size(); ++i)
+        {
+            size_t idom = undefined;
+
+            for (auto pred : predecessors.at(m_blocks[i]))
+            {
+                const auto it = m_indices.find(pred);
+
+                // Unreachable or not processed yet
+                if (it == m_indices.end() ||
+                    m_nodes[it->second].idom == undefined)
+                    continue;
+
+                idom = idom == undefined ? it->second
+                                         : intersect(it->second, idom);
+            }
+
+            if (m_nodes[i].idom != idom)
+            {
+                m_nodes[i].idom = idom;
+                changed         = true;
+            }
+        }
+    }
+
+    for (size_t i = 1; i < m_blocks.size(); ++i)
+        m_nodes[m_nodes[i].idom].children.push_back(m_blocks[i]);
+
+    // Number tree nodes for constant time dominance queries
+    size_t counter = 0;
+    Vector<std::pair<size_t, size_t>> stack{{0, 0}};
+    m_nodes[0].in = counter++;
+
+    while (!stack.empty())
+    {
+        auto& top         = stack.back();
+        const auto& nodes = m_nodes[top.first].children;
+
+        if (top.second < nodes.size())
+        {
+            const auto child = m_indices.at(nodes[top.second++]);
+            m_nodes[child].in = counter++;
+            stack.push_back({child, 0});
+        }
+        else
+        {
+            m_nodes[top.first].out = counter++;
+            stack.pop_back();
+        }
+    }
+}
+
+/* ************************************************************************* */
+
+ViewPtr<Block> DominatorTree::idom(ViewPtr<const Block> block) const
+{
+    const auto it = m_indices.find(block);
+
+    if (it == m_indices.end() || it->second == 0)
+        return nullptr;
+
+    return m_blocks[m_nodes[it->second].idom];
+}
+
+/* ************************************************************************* */
+
+bool DominatorTree::dominates(
+    ViewPtr<const Block> dominator,
+    ViewPtr<const Block> block) const
+{
+    const auto first  = m_indices.find(dominator);
+    const auto second = m_indices.find(block);
+
+    if (first == m_indices.end() || second == m_indices.end())
+        return false;
+
+    const auto& outer = m_nodes[first->second];
+    const auto& inner = m_nodes[second->second];
+
+    return outer.in <= inner.in && inner.out <= outer.out;
+}
+
+/* ************************************************************************* */
+
+} // namespace shard::ir
+
+/* ************************************************************************* */
@@ -39,6 +39,24 @@ Function::Function(
 
 /* ************************************************************************* */
 
+Map<ViewPtr<Block>, Vector<ViewPtr<Block>>> Function::predecessors() const
+{
+    Map<ViewPtr<Block>, Vector<ViewPtr<Block>>> result;
+
+    for (const auto& block : m_blocks)
+        result[block.get()];
+
+    for (const auto& block : m_blocks)
+    {
+        for (auto succ : block->successors())
+            result[succ].push_back(block.get());
+    }
+
+    return result;
+}
+
+/* ************************************************************************* */
+
 } // namespace shard::ir
 
 /* ************************************************************************* */
@@ -0,0 +1,412 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// Declaration
+#include "shard/ir/Gvn.hpp"
+
+// C++
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <utility>
+
+// Shard
+#include "shard/HashMap.hpp"
+#include "shard/Set.hpp"
+#include "shard/utility.hpp"
+#include "shard/ir/Block.hpp"
+#include "shard/ir/Constant.hpp"
+#include "shard/ir/DominatorTree.hpp"
+#include "shard/ir/Function.hpp"
+#include "shard/ir/Instruction.hpp"
+#include "shard/ir/Module.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::ir {
+
+/* ************************************************************************* */
+
+namespace {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Returns constant value bits.
+ *
+ * @param      value  The constant value.
+ *
+ * @return     The value bits.
+ */
+std::uint64_t constantBits(const Value& value) noexcept
+{
+    std::uint64_t bits = 0;
+
+    auto copy = [&bits](auto constant) {
+        std::memcpy(&bits, &constant, sizeof(constant));
+    };
+
+    switch (value.type()->kind())
+    {
+    case TypeKind::Int1:
+        copy(static_cast<const ConstInt1&>(value).value());
+        break;
+    case TypeKind::Int8:
+        copy(static_cast<const ConstInt8&>(value).value());
+        break;
+    case TypeKind::Int16:
+        copy(static_cast<const ConstInt16&>(value).value());
+        break;
+    case TypeKind::Int32:
+        copy(static_cast<const ConstInt32&>(value).value());
+        break;
+    case TypeKind::Int64:
+        copy(static_cast<const ConstInt64&>(value).value());
+        break;
+    case TypeKind::Float32:
+        copy(static_cast<const ConstFloat32&>(value).value());
+        break;
+    case TypeKind::Float64:
+        copy(static_cast<const ConstFloat64&>(value).value());
+        break;
+    default: break;
+    }
+
+    return bits;
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Returns operand hash.
+ *
+ * @details    Constants are hashed by value, other values by identity.
+ *
+ * @param      value  The value.
+ *
+ * @return     The hash.
+ */
+std::size_t hashOperand(ViewPtr<const Value> value) noexcept
+{
+    if (!value->isConst())
+        return std::hash<ViewPtr<const Value>>{}(value);
+
+    return hashCombine(
+        value->type()->hash(),
+        std::hash<std::uint64_t>{}(constantBits(*value)));
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Returns if operands are the same value.
+ *
+ * @param      first   The first value.
+ * @param      second  The second value.
+ *
+ * @return     True if same, False otherwise.
+ */
+bool sameOperand(ViewPtr<const Value> first, ViewPtr<const Value> second)
+{
+    if (first == second)
+        return true;
+
+    if (!first->isConst() || !second->isConst())
+        return false;
+
+    return first->type()->equals(*second->type()) &&
+           constantBits(*first) == constantBits(*second);
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Computed expression.
+ */
+struct Expression
+{
+    /// Instruction kind.
+    InstructionKind kind;
+
+    /// Working type.
+    ViewPtr<const Type> type;
+
+    /// Comparison operation.
+    InstructionCmp::Operation operation;
+
+    /// The first operand.
+    ViewPtr<const Value> value1;
+
+    /// The second operand.
+    ViewPtr<const Value> value2;
+
+    /**
+     * @brief      Returns if operands can be swapped.
+     *
+     * @return     True if commutative, False otherwise.
+     */
+    bool isCommutative() const noexcept
+    {
+        switch (kind)
+        {
+        case InstructionKind::Add:
+        case InstructionKind::Mul:
+        case InstructionKind::And:
+        case InstructionKind::Or:
+        case InstructionKind::Xor: return true;
+
+        case InstructionKind::Cmp:
+            return operation == InstructionCmp::Operation::Equal ||
+                   operation == InstructionCmp::Operation::NotEqual;
+
+        default: return false;
+        }
+    }
+};
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Expression hash function.
+ */
+struct ExpressionHash
+{
+    std::size_t operator()(const Expression& expr) const noexcept
+    {
+        std::size_t result = std::hash<int>{}(static_cast<int>(expr.kind));
+        result             = hashCombine(result, expr.type->hash());
+        result             = hashCombine(
+            result, std::hash<int>{}(static_cast<int>(expr.operation)));
+
+        const auto first  = hashOperand(expr.value1);
+        const auto second = hashOperand(expr.value2);
+
+        // Order independent hash for commutative operations
+        if (expr.isCommutative())
+            return hashCombine(result, first + second);
+
+        return hashCombine(hashCombine(result, first), second);
+    }
+};
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Expression comparison function.
+ */
+struct ExpressionEqual
+{
+    bool operator()(const Expression& lhs, const Expression& rhs) const
+    {
+        if (lhs.kind != rhs.kind || lhs.operation != rhs.operation ||
+            !lhs.type->equals(*rhs.type))
+            return false;
+
+        if (sameOperand(lhs.value1, rhs.value1) &&
+            sameOperand(lhs.value2, rhs.value2))
+            return true;
+
+        return lhs.isCommutative() && sameOperand(lhs.value1, rhs.value2) &&
+               sameOperand(lhs.value2, rhs.value1);
+    }
+};
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Build expression from binary instruction.
+ *
+ * @param      instr   The instruction.
+ * @param      leader  Function returning value representative.
+ *
+ * @tparam     T       The binary instruction type.
+ * @tparam     Leader  The leader function type.
+ *
+ * @return     The expression.
+ */
+template<typename T, typename Leader>
+Expression makeExpression(const Instruction& instr, Leader leader)
+{
+    const auto& binary = instr.as<T>();
+
+    return Expression{binary.kind(),
+                      binary.type(),
+                      InstructionCmp::Operation::Equal,
+                      leader(binary.value1()),
+                      leader(binary.value2())};
+}
+
+/* ************************************************************************* */
+
+} // namespace
+
+/* ************************************************************************* */
+
+bool gvn(Function& function)
+{
+    if (function.blocks().empty())
+        return false;
+
+    const DominatorTree tree(function);
+
+    // Replaced values and their representatives
+    HashMap<ViewPtr<Value>, ViewPtr<Value>> leaders;
+
+    // Expressions computed in dominating blocks
+    HashMap<Expression, ViewPtr<Value>, ExpressionHash, ExpressionEqual>
+        available;
+
+    // Redundant instructions
+    Set<ViewPtr<const Instruction>> redundant;
+
+    auto leader = [&leaders](ViewPtr<Value> value) {
+        const auto it = leaders.find(value);
+        return it != leaders.end() ? it->second : value;
+    };
+
+    // Dominator tree traversal, the second item marks block leaving
+    Vector<std::pair<ViewPtr<Block>, bool>> stack{
+        {function.entryBlock(), true}};
+    Vector<Vector<Expression>> scopes;
+
+    while (!stack.empty())
+    {
+        const auto [block, enter] = stack.back();
+        stack.pop_back();
+
+        if (!enter)
+        {
+            // Expressions are no longer available outside the subtree
+            for (const auto& expr : scopes.back())
+                available.erase(expr);
+
+            scopes.pop_back();
+            continue;
+        }
+
+        auto& scope = scopes.emplace_back();
+        stack.push_back({block, false});
+
+        for (auto child : tree.children(block))
+            stack.push_back({child, true});
+
+        for (const auto& instr : block->instructions())
+        {
+            Expression expr;
+
+            switch (instr->kind())
+            {
+            case InstructionKind::Add:
+                expr = makeExpression<InstructionAdd>(*instr, leader);
+                break;
+            case InstructionKind::Sub:
+                expr = makeExpression<InstructionSub>(*instr, leader);
+                break;
+            case InstructionKind::Mul:
+                expr = makeExpression<InstructionMul>(*instr, leader);
+                break;
+            case InstructionKind::Div:
+                expr = makeExpression<InstructionDiv>(*instr, leader);
+                break;
+            case InstructionKind::Rem:
+                expr = makeExpression<InstructionRem>(*instr, leader);
+                break;
+            case InstructionKind::Cmp:
+                expr = makeExpression<InstructionCmp>(*instr, leader);
+                expr.operation = instr->as<InstructionCmp>().operation();
+                break;
+            case InstructionKind::And:
+                expr = makeExpression<InstructionAnd>(*instr, leader);
+                break;
+            case InstructionKind::Or:
+                expr = makeExpression<InstructionOr>(*instr, leader);
+                break;
+            case InstructionKind::Xor:
+                expr = makeExpression<InstructionXor>(*instr, leader);
+                break;
+            default: continue;
+            }
+
+            const auto [it, inserted] =
+                available.insert({expr, instr->result()});
+
+            if (inserted)
+            {
+                scope.push_back(expr);
+            }
+            else
+            {
+                leaders[instr->result()] = it->second;
+                redundant.insert(instr.get());
+            }
+        }
+    }
+
+    if (redundant.empty())
+        return false;
+
+    for (const auto& block : function.blocks())
+    {
+        auto& instructions = block->instructions();
+
+        // Uses are rewritten before the defining instructions are released
+        for (const auto& instr : instructions)
+        {
+            for (auto operand : instr->operands())
+            {
+                const auto replacement = leader(operand);
+
+                if (replacement != operand)
+                    instr->replaceUsesOf(operand, replacement);
+            }
+        }
+    }
+
+    for (const auto& block : function.blocks())
+    {
+        auto& instructions = block->instructions();
+
+        instructions.erase(
+            std::remove_if(
+                instructions.begin(),
+                instructions.end(),
+                [&redundant](const auto& instr) {
+                    return redundant.count(instr.get()) != 0;
+                }),
+            instructions.end());
+    }
+
+    return true;
+}
+
+/* ************************************************************************* */
+
+bool gvn(Module& module)
+{
+    bool changed = false;
+
+    for (const auto& function : module.functions())
+        changed |= gvn(*function);
+
+    return changed;
+}
+
+/* ************************************************************************* */
+
+} // namespace shard::ir
+
+/* ************************************************************************* */
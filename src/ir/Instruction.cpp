@@ -0,0 +1,231 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// Declaration
+#include "shard/ir/Instruction.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::ir {
+
+/* ************************************************************************* */
+
+namespace {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Returns binary instruction operands.
+ *
+ * @param      instr  The instruction.
+ *
+ * @tparam     T      The binary instruction type.
+ *
+ * @return     The operands.
+ */
+template<typename T>
+Vector<ViewPtr<Value>> binaryOperands(const Instruction& instr)
+{
+    const auto& binary = instr.as<T>();
+    return {binary.value1(), binary.value2()};
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Replace binary instruction operands.
+ *
+ * @param      instr  The instruction.
+ * @param      from   The replaced value.
+ * @param      to     The new value.
+ *
+ * @tparam     T      The binary instruction type.
+ *
+ * @return     If any operand was replaced.
+ */
+template<typename T>
+bool replaceBinaryOperands(
+    Instruction& instr,
+    ViewPtr<Value> from,
+    ViewPtr<Value> to) noexcept
+{
+    auto& binary  = instr.as<T>();
+    bool replaced = false;
+
+    if (binary.value1() == from)
+    {
+        binary.setValue1(to);
+        replaced = true;
+    }
+
+    if (binary.value2() == from)
+    {
+        binary.setValue2(to);
+        replaced = true;
+    }
+
+    return replaced;
+}
+
+/* ************************************************************************* */
+
+} // namespace
+
+/* ************************************************************************* */
+
+ViewPtr<Value> Instruction::result() const noexcept
+{
+    if (!hasResult())
+        return nullptr;
+
+    return static_cast<const ResultInstruction&>(*this).result();
+}
+
+/* ************************************************************************* */
+
+Vector<ViewPtr<Value>> Instruction::operands() const
+{
+    switch (m_kind)
+    {
+    case InstructionKind::Store:
+    {
+        const auto& instr = as<InstructionStore>();
+        return {instr.pointer(), instr.value()};
+    }
+
+    case InstructionKind::Load: return {as<InstructionLoad>().pointer()};
+    case InstructionKind::Add: return binaryOperands<InstructionAdd>(*this);
+    case InstructionKind::Sub: return binaryOperands<InstructionSub>(*this);
+    case InstructionKind::Mul: return binaryOperands<InstructionMul>(*this);
+    case InstructionKind::Div: return binaryOperands<InstructionDiv>(*this);
+    case InstructionKind::Rem: return binaryOperands<InstructionRem>(*this);
+    case InstructionKind::Cmp: return binaryOperands<InstructionCmp>(*this);
+    case InstructionKind::And: return binaryOperands<InstructionAnd>(*this);
+    case InstructionKind::Or: return binaryOperands<InstructionOr>(*this);
+    case InstructionKind::Xor: return binaryOperands<InstructionXor>(*this);
+
+    case InstructionKind::BranchCondition:
+        return {as<InstructionBranchCondition>().condition()};
+
+    case InstructionKind::Call: return as<InstructionCall>().arguments();
+    case InstructionKind::Return: return {as<InstructionReturn>().value()};
+    default: return {};
+    }
+}
+
+/* ************************************************************************* */
+
+bool Instruction::replaceUsesOf(ViewPtr<Value> from, ViewPtr<Value> to) noexcept
+{
+    switch (m_kind)
+    {
+    case InstructionKind::Store:
+    {
+        auto& instr   = as<InstructionStore>();
+        bool replaced = false;
+
+        if (instr.pointer() == from)
+        {
+            instr.setPointer(to);
+            replaced = true;
+        }
+
+        if (instr.value() == from)
+        {
+            instr.setValue(to);
+            replaced = true;
+        }
+
+        return replaced;
+    }
+
+    case InstructionKind::Load:
+    {
+        auto& instr = as<InstructionLoad>();
+
+        if (instr.pointer() != from)
+            return false;
+
+        instr.setPointer(to);
+        return true;
+    }
+
+    case InstructionKind::Add:
+        return replaceBinaryOperands<InstructionAdd>(*this, from, to);
+    case InstructionKind::Sub:
+        return replaceBinaryOperands<InstructionSub>(*this, from, to);
+    case InstructionKind::Mul:
+        return replaceBinaryOperands<InstructionMul>(*this, from, to);
+    case InstructionKind::Div:
+        return replaceBinaryOperands<InstructionDiv>(*this, from, to);
+    case InstructionKind::Rem:
+        return replaceBinaryOperands<InstructionRem>(*this, from, to);
+    case InstructionKind::Cmp:
+        return replaceBinaryOperands<InstructionCmp>(*this, from, to);
+    case InstructionKind::And:
+        return replaceBinaryOperands<InstructionAnd>(*this, from, to);
+    case InstructionKind::Or:
+        return replaceBinaryOperands<InstructionOr>(*this, from, to);
+    case InstructionKind::Xor:
+        return replaceBinaryOperands<InstructionXor>(*this, from, to);
+
+    case InstructionKind::BranchCondition:
+    {
+        auto& instr = as<InstructionBranchCondition>();
+
+        if (instr.condition() != from)
+            return false;
+
+        instr.setCondition(to);
+        return true;
+    }
+
+    case InstructionKind::Call:
+    {
+        bool replaced = false;
+
+        for (auto& arg : as<InstructionCall>().arguments())
+        {
+            if (arg == from)
+            {
+                arg      = to;
+                replaced = true;
+            }
+        }
+
+        return replaced;
+    }
+
+    case InstructionKind::Return:
+    {
+        auto& instr = as<InstructionReturn>();
+
+        if (instr.value() != from)
+            return false;
+
+        instr.setValue(to);
+        return true;
+    }
+
+    default: return false;
+    }
+}
+
+/* ************************************************************************* */
+
+} // namespace shard::ir
+
+/* ************************************************************************* */
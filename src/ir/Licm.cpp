@@ -0,0 +1,366 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// Declaration
+#include "shard/ir/Licm.hpp"
+
+// C++
+#include <algorithm>
+
+// Shard
+#include "shard/Map.hpp"
+#include "shard/Set.hpp"
+#include "shard/ir/Block.hpp"
+#include "shard/ir/DominatorTree.hpp"
+#include "shard/ir/Function.hpp"
+#include "shard/ir/Instruction.hpp"
+#include "shard/ir/LoopInfo.hpp"
+#include "shard/ir/Module.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::ir {
+
+/* ************************************************************************* */
+
+namespace {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Memory effects of the function.
+ */
+struct MemoryInfo
+{
+    /// Allocated pointers which never escape the function.
+    Set<ViewPtr<const Value>> locals;
+
+    /**
+     * @brief      Returns if pointer can be accessed only directly.
+     *
+     * @param      pointer  The pointer.
+     *
+     * @return     True if local, False otherwise.
+     */
+    bool isLocal(ViewPtr<const Value> pointer) const
+    {
+        return locals.count(pointer) != 0;
+    }
+};
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Find allocations which are not passed anywhere.
+ *
+ * @param      function  The function.
+ *
+ * @return     Memory information.
+ */
+MemoryInfo analyseMemory(const Function& function)
+{
+    MemoryInfo info;
+    Set<ViewPtr<const Value>> escaping;
+
+    for (const auto& block : function.blocks())
+    {
+        for (const auto& instr : block->instructions())
+        {
+            if (instr->is<InstructionAlloc>())
+            {
+                info.locals.insert(instr->result());
+            }
+            else if (instr->is<InstructionStore>())
+            {
+                escaping.insert(instr->as<InstructionStore>().value());
+            }
+            else if (instr->is<InstructionCall>())
+            {
+                for (auto arg : instr->as<InstructionCall>().arguments())
+                    escaping.insert(arg);
+            }
+        }
+    }
+
+    for (auto value : escaping)
+        info.locals.erase(value);
+
+    return info;
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Returns if instruction can be executed speculatively.
+ *
+ * @param      instr  The instruction.
+ *
+ * @return     True if pure arithmetic, False otherwise.
+ */
+bool isSpeculatable(const Instruction& instr)
+{
+    switch (instr.kind())
+    {
+    case InstructionKind::Add:
+    case InstructionKind::Sub:
+    case InstructionKind::Mul:
+    case InstructionKind::Cmp:
+    case InstructionKind::And:
+    case InstructionKind::Or:
+    case InstructionKind::Xor: return true;
+    default: return false;
+    }
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Returns loop preheader, creates one if necessary.
+ *
+ * @details    Preheader is the only block outside the loop jumping into the
+ *             loop header and its only successor is the header.
+ *
+ * @param      function  The function.
+ * @param      loop      The loop.
+ *
+ * @return     The preheader block.
+ */
+ViewPtr<Block> createPreheader(Function& function, const Loop& loop)
+{
+    const auto header       = loop.header();
+    const auto predecessors = function.predecessors();
+
+    Vector<ViewPtr<Block>> outside;
+
+    for (auto pred : predecessors.at(header))
+    {
+        if (!loop.contains(pred))
+            outside.push_back(pred);
+    }
+
+    if (outside.size() == 1)
+    {
+        const auto term = outside.front()->terminator();
+
+        if (term && term->is<InstructionBranch>())
+            return outside.front();
+    }
+
+    auto preheader = makeUnique<Block>();
+    preheader->createInstruction<InstructionBranch>(header);
+
+    // Redirect loop entries into the preheader
+    for (auto pred : outside)
+    {
+        const auto term = pred->terminator();
+
+        if (term->is<InstructionBranch>())
+        {
+            term->as<InstructionBranch>().setBlock(preheader.get());
+        }
+        else if (term->is<InstructionBranchCondition>())
+        {
+            auto& branch = term->as<InstructionBranchCondition>();
+
+            if (branch.blockTrue() == header)
+                branch.setBlockTrue(preheader.get());
+
+            if (branch.blockFalse() == header)
+                branch.setBlockFalse(preheader.get());
+        }
+    }
+
+    // Header without outside predecessor is the entry block and the
+    // preheader becomes the new entry
+    auto& blocks = function.blocks();
+    auto it      = std::find_if(blocks.begin(), blocks.end(), [&](auto& ptr) {
+        return ptr.get() == header;
+    });
+
+    return blocks.insert(it, std::move(preheader))->get();
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Hoist loop invariant instructions from the loop.
+ *
+ * @param      function  The function.
+ * @param      tree      The dominator tree.
+ * @param      loop      The loop.
+ *
+ * @return     If the function was changed.
+ */
+bool hoistInvariants(
+    Function& function,
+    const DominatorTree& tree,
+    const Loop& loop)
+{
+    const auto memory = analyseMemory(function);
+
+    // Values defined inside the loop
+    Set<ViewPtr<const Value>> defined;
+
+    // Memory written inside the loop
+    Vector<ViewPtr<const Value>> stored;
+    bool calls = false;
+
+    for (auto block : loop.blocks())
+    {
+        for (const auto& instr : block->instructions())
+        {
+            if (instr->result())
+                defined.insert(instr->result());
+
+            if (instr->is<InstructionStore>())
+                stored.push_back(instr->as<InstructionStore>().pointer());
+            else if (instr->is<InstructionCall>())
+                calls = true;
+        }
+    }
+
+    const auto exiting = loop.exitingBlocks();
+
+    auto isInvariant = [&](ViewPtr<const Value> value) {
+        return value->isConst() || defined.count(value) == 0;
+    };
+
+    auto isExecuted = [&](ViewPtr<const Block> block) {
+        return !exiting.empty() &&
+               std::all_of(exiting.begin(), exiting.end(), [&](auto exit) {
+                   return tree.dominates(block, exit);
+               });
+    };
+
+    auto isUnmodified = [&](ViewPtr<const Value> pointer) {
+        if (calls && !memory.isLocal(pointer))
+            return false;
+
+        return std::none_of(stored.begin(), stored.end(), [&](auto dest) {
+            return dest == pointer ||
+                   !(memory.isLocal(pointer) || memory.isLocal(dest));
+        });
+    };
+
+    Vector<std::pair<ViewPtr<Block>, ViewPtr<Instruction>>> hoisted;
+
+    // Reverse post-order visits definitions before uses
+    for (auto block : loop.blocks())
+    {
+        for (const auto& instr : block->instructions())
+        {
+            bool candidate = false;
+
+            switch (instr->kind())
+            {
+            case InstructionKind::Div:
+            case InstructionKind::Rem: candidate = isExecuted(block); break;
+
+            case InstructionKind::Load:
+                candidate =
+                    isUnmodified(instr->as<InstructionLoad>().pointer());
+                break;
+
+            default: candidate = isSpeculatable(*instr); break;
+            }
+
+            if (!candidate)
+                continue;
+
+            const auto operands = instr->operands();
+
+            if (!std::all_of(operands.begin(), operands.end(), isInvariant))
+                continue;
+
+            defined.erase(instr->result());
+            hoisted.push_back({block, instr.get()});
+        }
+    }
+
+    if (hoisted.empty())
+        return false;
+
+    const auto preheader = createPreheader(function, loop);
+    auto& target         = preheader->instructions();
+
+    for (const auto& [block, instr] : hoisted)
+    {
+        auto& instructions = block->instructions();
+        auto it            = std::find_if(
+            instructions.begin(), instructions.end(), [&](auto& ptr) {
+                return ptr.get() == instr;
+            });
+
+        // Insert before the terminator
+        target.insert(std::prev(target.end()), std::move(*it));
+        instructions.erase(it);
+    }
+
+    return true;
+}
+
+/* ************************************************************************* */
+
+} // namespace
+
+/* ************************************************************************* */
+
+bool licm(Function& function)
+{
+    if (function.blocks().empty())
+        return false;
+
+    Vector<ViewPtr<Block>> headers;
+
+    {
+        DominatorTree tree(function);
+        LoopInfo info(function, tree);
+
+        for (const auto& loop : info.allLoops())
+            headers.push_back(loop->header());
+    }
+
+    bool changed = false;
+
+    // Loop structure is changed by created preheaders
+    for (auto header : headers)
+    {
+        DominatorTree tree(function);
+        LoopInfo info(function, tree);
+
+        changed |= hoistInvariants(function, tree, *info.loopFor(header));
+    }
+
+    return changed;
+}
+
+/* ************************************************************************* */
+
+bool licm(Module& module)
+{
+    bool changed = false;
+
+    for (const auto& function : module.functions())
+        changed |= licm(*function);
+
+    return changed;
+}
+
+/* ************************************************************************* */
+
+} // namespace shard::ir
+
+/* ************************************************************************* */
@@ -0,0 +1,151 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// Declaration
+#include "shard/ir/LoopInfo.hpp"
+
+// C++
+#include <algorithm>
+
+// Shard
+#include "shard/ir/Block.hpp"
+#include "shard/ir/DominatorTree.hpp"
+#include "shard/ir/Function.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::ir {
+
+/* ************************************************************************* */
+
+Vector<ViewPtr<Block>> Loop::exitingBlocks() const
+{
+    Vector<ViewPtr<Block>> result;
+
+    for (auto block : m_blocks)
+    {
+        const auto succs = block->successors();
+
+        const bool exiting =
+            std::any_of(succs.begin(), succs.end(), [this](auto succ) {
+                return !contains(succ);
+            });
+
+        if (exiting)
+            result.push_back(block);
+    }
+
+    return result;
+}
+
+/* ************************************************************************* */
+
+LoopInfo::LoopInfo(const Function& function, const DominatorTree& tree)
+{
+    const auto predecessors = function.predecessors();
+
+    for (auto header : tree.blocks())
+    {
+        UniquePtr<Loop> loop;
+        Vector<ViewPtr<Block>> stack;
+
+        // Back edge: the source is dominated by the target
+        for (auto pred : predecessors.at(header))
+        {
+            if (!tree.dominates(header, pred))
+                continue;
+
+            if (!loop)
+            {
+                loop = makeUnique<Loop>(header);
+                loop->m_blockSet.insert(header);
+            }
+
+            loop->m_latches.push_back(pred);
+            stack.push_back(pred);
+        }
+
+        if (!loop)
+            continue;
+
+        // Everything reaching the latches without going through the header
+        while (!stack.empty())
+        {
+            const auto block = stack.back();
+            stack.pop_back();
+
+            if (!loop->m_blockSet.insert(block).second)
+                continue;
+
+            for (auto pred : predecessors.at(block))
+            {
+                if (tree.isReachable(pred))
+                    stack.push_back(pred);
+            }
+        }
+
+        for (auto block : tree.blocks())
+        {
+            if (loop->contains(block))
+                loop->m_blocks.push_back(block);
+        }
+
+        m_loops.push_back(std::move(loop));
+    }
+
+    // Nested loops are smaller than the enclosing ones
+    std::stable_sort(
+        m_loops.begin(), m_loops.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs->blocks().size() < rhs->blocks().size();
+        });
+
+    for (size_t i = 0; i < m_loops.size(); ++i)
+    {
+        const auto loop = makeView(m_loops[i]);
+
+        for (size_t j = i + 1; j < m_loops.size(); ++j)
+        {
+            if (m_loops[j]->contains(loop->header()))
+            {
+                loop->m_parent = m_loops[j].get();
+                loop->m_parent->m_subLoops.push_back(loop);
+                break;
+            }
+        }
+
+        if (!loop->m_parent)
+            m_topLevel.push_back(loop);
+
+        // Smaller loops are processed first so the innermost one is kept
+        for (auto block : loop->blocks())
+            m_blockLoops.insert({block, loop});
+    }
+}
+
+/* ************************************************************************* */
+
+ViewPtr<Loop> LoopInfo::loopFor(ViewPtr<const Block> block) const
+{
+    const auto it = m_blockLoops.find(block);
+
+    return it != m_blockLoops.end() ? it->second : nullptr;
+}
+
+/* ************************************************************************* */
+
+} // namespace shard::ir
+
+/* ************************************************************************* */
@@ -450,6 +450,30 @@ ViewPtr<Value> readValue(std::istream& input, Mapping& mapping)
 
 /* ************************************************************************* */
 
+/**
+ * @brief      Read instruction operand, either constant or value index.
+ *
+ * @param      input    The input.
+ * @param      isConst  If operand is constant.
+ * @param      type     The constant type.
+ * @param      module   The module.
+ * @param      mapping  The value mapping.
+ *
+ * @return     The operand.
+ */
+ViewPtr<Value> readOperand(
+    std::istream& input,
+    bool isConst,
+    ViewPtr<Type> type,
+    Module& module,
+    Mapping& mapping)
+{
+    return isConst ? readConst(input, type, module)
+                   : readValue(input, mapping);
+}
+
+/* ************************************************************************* */
+
 UniquePtr<InstructionAlloc> readInstructionAlloc(
     std::istream& input,
     int code,
@@ -587,31 +611,17 @@ UniquePtr<InstructionAdd> readInstructionAdd(
     Module& module,
     Mapping& mapping)
 {
-    // | `add`       | `0x30` + `<type>` + `<value1>` + `<value2>` | 1+N+2+2
-    // bytes   | | `add`       | `0x31` + `<type>` + `<value1>` + `<constant>`
-    // | 1+N+2+M bytes   |
-
-    UniquePtr<InstructionAdd> instr;
+    // | `add` | `0x30` + `<type>` + `<value1>` + `<value2>` |
+    // | `add` | `0x31` + `<type>` + `<value1>` + `<constant>` |
+    // | `add` | `0x32` + `<type>` + `<constant>` + `<value2>` |
+    // | `add` | `0x33` + `<type>` + `<constant>` + `<constant>` |
 
+    const int variant = code - 0x30;
     auto type   = readType(input, module);
-    auto value1 = readValue(input, mapping);
-
-    if (code == 0x30)
-    {
-        auto value2 = readValue(input, mapping);
-
-        instr = makeUnique<InstructionAdd>(type, value1, value2);
-    }
-    else if (code == 0x31)
-    {
-        auto value2 = readConst(input, type, module);
+    auto value1 = readOperand(input, variant & 2, type, module, mapping);
+    auto value2 = readOperand(input, variant & 1, type, module, mapping);
 
-        instr = makeUnique<InstructionAdd>(type, value1, value2);
-    }
-    else
-    {
-        throw std::runtime_error("Unknown instruction code");
-    }
+    auto instr = makeUnique<InstructionAdd>(type, value1, value2);
 
     int16_t result = readInt16(input);
 
@@ -629,40 +639,17 @@ UniquePtr<InstructionSub> readInstructionSub(
     Module& module,
     Mapping& mapping)
 {
-    // | `sub`       | `0x40` + `<type>` + `<value1>` + `<value2>` | 1+N+2+2
-    // bytes   | | `sub`       | `0x41` + `<type>` + `<value1>` + `<constant>`
-    // | 1+N+2+M bytes   | | `sub`       | `0x42` + `<type>` + `<constant>` +
-    // `<value2>`              | 1+N+M+2 bytes   |
-
-    UniquePtr<InstructionSub> instr;
-
-    auto type = readType(input, module);
-
-    if (code == 0x40)
-    {
-        auto value1 = readValue(input, mapping);
-        auto value2 = readValue(input, mapping);
+    // | `sub` | `0x40` + `<type>` + `<value1>` + `<value2>` |
+    // | `sub` | `0x41` + `<type>` + `<value1>` + `<constant>` |
+    // | `sub` | `0x42` + `<type>` + `<constant>` + `<value2>` |
+    // | `sub` | `0x43` + `<type>` + `<constant>` + `<constant>` |
 
-        instr = makeUnique<InstructionSub>(type, value1, value2);
-    }
-    else if (code == 0x41)
-    {
-        auto value1 = readValue(input, mapping);
-        auto value2 = readConst(input, type, module);
-
-        instr = makeUnique<InstructionSub>(type, value1, value2);
-    }
-    else if (code == 0x42)
-    {
-        auto value1 = readConst(input, type, module);
-        auto value2 = readValue(input, mapping);
+    const int variant = code - 0x40;
+    auto type   = readType(input, module);
+    auto value1 = readOperand(input, variant & 2, type, module, mapping);
+    auto value2 = readOperand(input, variant & 1, type, module, mapping);
 
-        instr = makeUnique<InstructionSub>(type, value1, value2);
-    }
-    else
-    {
-        throw std::runtime_error("Unknown instruction code");
-    }
+    auto instr = makeUnique<InstructionSub>(type, value1, value2);
 
     int16_t result = readInt16(input);
 
@@ -680,31 +667,17 @@ UniquePtr<InstructionMul> readInstructionMul(
     Module& module,
     Mapping& mapping)
 {
-    // | `mul`       | `0x50` + `<type>` + `<value1>` + `<value2>` | 1+N+2+2
-    // bytes   | | `mul`       | `0x51` + `<type>` + `<value1>` + `<constant>`
-    // | 1+N+2+M bytes   |
-
-    UniquePtr<InstructionMul> instr;
+    // | `mul` | `0x50` + `<type>` + `<value1>` + `<value2>` |
+    // | `mul` | `0x51` + `<type>` + `<value1>` + `<constant>` |
+    // | `mul` | `0x52` + `<type>` + `<constant>` + `<value2>` |
+    // | `mul` | `0x53` + `<type>` + `<constant>` + `<constant>` |
 
+    const int variant = code - 0x50;
     auto type   = readType(input, module);
-    auto value1 = readValue(input, mapping);
-
-    if (code == 0x50)
-    {
-        auto value2 = readValue(input, mapping);
-
-        instr = makeUnique<InstructionMul>(type, value1, value2);
-    }
-    else if (code == 0x51)
-    {
-        auto value2 = readConst(input, type, module);
+    auto value1 = readOperand(input, variant & 2, type, module, mapping);
+    auto value2 = readOperand(input, variant & 1, type, module, mapping);
 
-        instr = makeUnique<InstructionMul>(type, value1, value2);
-    }
-    else
-    {
-        throw std::runtime_error("Unknown instruction code");
-    }
+    auto instr = makeUnique<InstructionMul>(type, value1, value2);
 
     int16_t result = readInt16(input);
 
@@ -722,40 +695,17 @@ UniquePtr<InstructionDiv> readInstructionDiv(
     Module& module,
     Mapping& mapping)
 {
-    // | `div`       | `0x60` + `<type>` + `<value1>` + `<value2>` | 1+N+2+2
-    // bytes   | | `div`       | `0x61` + `<type>` + `<value1>` + `<constant>`
-    // | 1+N+2+M bytes   | | `div`       | `0x62` + `<type>` + `<constant>` +
-    // `<value2>`              | 1+N+M+2 bytes   |
-
-    UniquePtr<InstructionDiv> instr;
-
-    auto type = readType(input, module);
-
-    if (code == 0x60)
-    {
-        auto value1 = readValue(input, mapping);
-        auto value2 = readValue(input, mapping);
+    // | `div` | `0x60` + `<type>` + `<value1>` + `<value2>` |
+    // | `div` | `0x61` + `<type>` + `<value1>` + `<constant>` |
+    // | `div` | `0x62` + `<type>` + `<constant>` + `<value2>` |
+    // | `div` | `0x63` + `<type>` + `<constant>` + `<constant>` |
 
-        instr = makeUnique<InstructionDiv>(type, value1, value2);
-    }
-    else if (code == 0x61)
-    {
-        auto value1 = readValue(input, mapping);
-        auto value2 = readConst(input, type, module);
-
-        instr = makeUnique<InstructionDiv>(type, value1, value2);
-    }
-    else if (code == 0x62)
-    {
-        auto value1 = readConst(input, type, module);
-        auto value2 = readValue(input, mapping);
+    const int variant = code - 0x60;
+    auto type   = readType(input, module);
+    auto value1 = readOperand(input, variant & 2, type, module, mapping);
+    auto value2 = readOperand(input, variant & 1, type, module, mapping);
 
-        instr = makeUnique<InstructionDiv>(type, value1, value2);
-    }
-    else
-    {
-        throw std::runtime_error("Unknown instruction code");
-    }
+    auto instr = makeUnique<InstructionDiv>(type, value1, value2);
 
     int16_t result = readInt16(input);
 
@@ -773,40 +723,17 @@ UniquePtr<InstructionRem> readInstructionRem(
     Module& module,
     Mapping& mapping)
 {
-    // | `rem`       | `0x70` + `<type>` + `<value1>` + `<value2>` | 1+N+2+2
-    // bytes   | | `rem`       | `0x71` + `<type>` + `<value1>` + `<constant>`
-    // | 1+N+2+M bytes   | | `rem`       | `0x72` + `<type>` + `<constant>` +
-    // `<value2>`              | 1+N+M+2 bytes   |
+    // | `rem` | `0x70` + `<type>` + `<value1>` + `<value2>` |
+    // | `rem` | `0x71` + `<type>` + `<value1>` + `<constant>` |
+    // | `rem` | `0x72` + `<type>` + `<constant>` + `<value2>` |
+    // | `rem` | `0x73` + `<type>` + `<constant>` + `<constant>` |
 
-    UniquePtr<InstructionRem> instr;
-
-    auto type = readType(input, module);
-
-    if (code == 0x70)
-    {
-        auto value1 = readValue(input, mapping);
-        auto value2 = readValue(input, mapping);
-
-        instr = makeUnique<InstructionRem>(type, value1, value2);
-    }
-    else if (code == 0x71)
-    {
-        auto value1 = readValue(input, mapping);
-        auto value2 = readConst(input, type, module);
-
-        instr = makeUnique<InstructionRem>(type, value1, value2);
-    }
-    else if (code == 0x72)
-    {
-        auto value1 = readConst(input, type, module);
-        auto value2 = readValue(input, mapping);
+    const int variant = code - 0x70;
+    auto type   = readType(input, module);
+    auto value1 = readOperand(input, variant & 2, type, module, mapping);
+    auto value2 = readOperand(input, variant & 1, type, module, mapping);
 
-        instr = makeUnique<InstructionRem>(type, value1, value2);
-    }
-    else
-    {
-        throw std::runtime_error("Unknown instruction code");
-    }
+    auto instr = makeUnique<InstructionRem>(type, value1, value2);
 
     int16_t result = readInt16(input);
 
@@ -824,32 +751,18 @@ UniquePtr<InstructionCmp> readInstructionCmp(
     Module& module,
     Mapping& mapping)
 {
-    // | `cmp`       | `0x80` + `<op>` + `<type>` + `<value1>` + `<value2>` |
-    // 1+1+N+2+2 bytes | | `cmp`       | `0x81` + `<op>` + `<type>` + `<value1>`
-    // + `<constant>`     | 1+1+N+2+M bytes |
-
-    UniquePtr<InstructionCmp> instr;
+    // | `cmp` | `0x80` + `<op>` + `<type>` + `<value1>` + `<value2>` |
+    // | `cmp` | `0x81` + `<op>` + `<type>` + `<value1>` + `<constant>` |
+    // | `cmp` | `0x82` + `<op>` + `<type>` + `<constant>` + `<value2>` |
+    // | `cmp` | `0x83` + `<op>` + `<type>` + `<constant>` + `<constant>` |
 
+    const int variant = code - 0x80;
     auto op     = static_cast<InstructionCmp::Operation>(readByte(input));
     auto type   = readType(input, module);
-    auto value1 = readValue(input, mapping);
-
-    if (code == 0x80)
-    {
-        auto value2 = readValue(input, mapping);
-
-        instr = makeUnique<InstructionCmp>(op, type, value1, value2);
-    }
-    else if (code == 0x81)
-    {
-        auto value2 = readConst(input, type, module);
+    auto value1 = readOperand(input, variant & 2, type, module, mapping);
+    auto value2 = readOperand(input, variant & 1, type, module, mapping);
 
-        instr = makeUnique<InstructionCmp>(op, type, value1, value2);
-    }
-    else
-    {
-        throw std::runtime_error("Unknown instruction code");
-    }
+    auto instr = makeUnique<InstructionCmp>(op, type, value1, value2);
 
     int16_t result = readInt16(input);
 
@@ -867,40 +780,17 @@ UniquePtr<InstructionAnd> readInstructionAnd(
     Module& module,
     Mapping& mapping)
 {
-    // | `and`       | `0x90` + `<type>` + `<value1>` + `<value2>` | 1+N+2+2
-    // bytes   | | `and`       | `0x91` + `<type>` + `<value1>` + `<constant>`
-    // | 1+N+2+M bytes   | | `and`       | `0x92` + `<type>` + `<constant>` +
-    // `<value2>`              | 1+N+M+2 bytes   |
-
-    UniquePtr<InstructionAnd> instr;
-
-    auto type = readType(input, module);
-
-    if (code == 0x90)
-    {
-        auto value1 = readValue(input, mapping);
-        auto value2 = readValue(input, mapping);
+    // | `and` | `0x90` + `<type>` + `<value1>` + `<value2>` |
+    // | `and` | `0x91` + `<type>` + `<value1>` + `<constant>` |
+    // | `and` | `0x92` + `<type>` + `<constant>` + `<value2>` |
+    // | `and` | `0x93` + `<type>` + `<constant>` + `<constant>` |
 
-        instr = makeUnique<InstructionAnd>(type, value1, value2);
-    }
-    else if (code == 0x91)
-    {
-        auto value1 = readValue(input, mapping);
-        auto value2 = readConst(input, type, module);
+    const int variant = code - 0x90;
+    auto type   = readType(input, module);
+    auto value1 = readOperand(input, variant & 2, type, module, mapping);
+    auto value2 = readOperand(input, variant & 1, type, module, mapping);
 
-        instr = makeUnique<InstructionAnd>(type, value1, value2);
-    }
-    else if (code == 0x92)
-    {
-        auto value1 = readConst(input, type, module);
-        auto value2 = readValue(input, mapping);
-
-        instr = makeUnique<InstructionAnd>(type, value1, value2);
-    }
-    else
-    {
-        throw std::runtime_error("Unknown instruction code");
-    }
+    auto instr = makeUnique<InstructionAnd>(type, value1, value2);
 
     int16_t result = readInt16(input);
 
@@ -918,40 +808,17 @@ UniquePtr<InstructionOr> readInstructionOr(
     Module& module,
     Mapping& mapping)
 {
-    // | `or`        | `0xA0` + `<type>` + `<value1>` + `<value2>` | 1+N+2+2
-    // bytes   | | `or`        | `0xA1` + `<type>` + `<value1>` + `<constant>`
-    // | 1+N+2+M bytes   | | `or`        | `0xA2` + `<type>` + `<constant>` +
-    // `<value2>`              | 1+N+M+2 bytes   |
+    // | `or` | `0xA0` + `<type>` + `<value1>` + `<value2>` |
+    // | `or` | `0xA1` + `<type>` + `<value1>` + `<constant>` |
+    // | `or` | `0xA2` + `<type>` + `<constant>` + `<value2>` |
+    // | `or` | `0xA3` + `<type>` + `<constant>` + `<constant>` |
 
-    UniquePtr<InstructionOr> instr;
-
-    auto type = readType(input, module);
-
-    if (code == 0xA0)
-    {
-        auto value1 = readValue(input, mapping);
-        auto value2 = readValue(input, mapping);
-
-        instr = makeUnique<InstructionOr>(type, value1, value2);
-    }
-    else if (code == 0xA1)
-    {
-        auto value1 = readValue(input, mapping);
-        auto value2 = readConst(input, type, module);
+    const int variant = code - 0xA0;
+    auto type   = readType(input, module);
+    auto value1 = readOperand(input, variant & 2, type, module, mapping);
+    auto value2 = readOperand(input, variant & 1, type, module, mapping);
 
-        instr = makeUnique<InstructionOr>(type, value1, value2);
-    }
-    else if (code == 0xA2)
-    {
-        auto value1 = readConst(input, type, module);
-        auto value2 = readValue(input, mapping);
-
-        instr = makeUnique<InstructionOr>(type, value1, value2);
-    }
-    else
-    {
-        throw std::runtime_error("Unknown instruction code");
-    }
+    auto instr = makeUnique<InstructionOr>(type, value1, value2);
 
     int16_t result = readInt16(input);
 
@@ -969,40 +836,17 @@ UniquePtr<InstructionXor> readInstructionXor(
     Module& module,
     Mapping& mapping)
 {
-    // | `xor`       | `0xB0` + `<type>` + `<value1>` + `<value2>` | 1+N+2+2
-    // bytes   | | `xor`       | `0xB1` + `<type>` + `<value1>` + `<constant>`
-    // | 1+N+2+M bytes   | | `xor`       | `0xB2` + `<type>` + `<constant>` +
-    // `<value2>`              | 1+N+M+2 bytes   |
-
-    UniquePtr<InstructionXor> instr;
-
-    auto type = readType(input, module);
-
-    if (code == 0xB0)
-    {
-        auto value1 = readValue(input, mapping);
-        auto value2 = readValue(input, mapping);
-
-        instr = makeUnique<InstructionXor>(type, value1, value2);
-    }
-    else if (code == 0xB1)
-    {
-        auto value1 = readValue(input, mapping);
-        auto value2 = readConst(input, type, module);
+    // | `xor` | `0xB0` + `<type>` + `<value1>` + `<value2>` |
+    // | `xor` | `0xB1` + `<type>` + `<value1>` + `<constant>` |
+    // | `xor` | `0xB2` + `<type>` + `<constant>` + `<value2>` |
+    // | `xor` | `0xB3` + `<type>` + `<constant>` + `<constant>` |
 
-        instr = makeUnique<InstructionXor>(type, value1, value2);
-    }
-    else if (code == 0xB2)
-    {
-        auto value1 = readConst(input, type, module);
-        auto value2 = readValue(input, mapping);
+    const int variant = code - 0xB0;
+    auto type   = readType(input, module);
+    auto value1 = readOperand(input, variant & 2, type, module, mapping);
+    auto value2 = readOperand(input, variant & 1, type, module, mapping);
 
-        instr = makeUnique<InstructionXor>(type, value1, value2);
-    }
-    else
-    {
-        throw std::runtime_error("Unknown instruction code");
-    }
+    auto instr = makeUnique<InstructionXor>(type, value1, value2);
 
     int16_t result = readInt16(input);
 
@@ -1035,10 +879,12 @@ UniquePtr<InstructionBranchCondition> readInstructionBranchCondition(
     Module& module,
     Mapping& mapping)
 {
-    // | `branch`    | `0xC1` + `<value>` + `<label1>` + `<label2>` | 1+2+2+2
-    // bytes   |
+    // | `branch` | `0xC1` + `<value>` + `<label1>` + `<label2>` |
+    // | `branch` | `0xC2` + `<type>` + `<constant>` + `<label1>` + `<label2>` |
 
-    auto value = readValue(input, mapping);
+    auto value = code == 0xC1
+                     ? readValue(input, mapping)
+                     : readConst(input, readType(input, module), module);
     auto lab1  = readUint16(input);
     auto lab2  = readUint16(input);
 
@@ -1127,9 +973,11 @@ UniquePtr<InstructionReturn> readInstructionReturn(
     Mapping& mapping)
 {
     // | `return`    | `0xE1` + `<type>` + `<value>` | 1+N+2 bytes     |
+    // | `return`    | `0xE2` + `<type>` + `<constant>` | 1+N+M bytes     |
 
     auto type  = readType(input, module);
-    auto value = readValue(input, mapping);
+    auto value = code == 0xE1 ? readValue(input, mapping)
+                              : readConst(input, type, module);
 
     return makeUnique<InstructionReturn>(type, value);
 }
@@ -1165,35 +1013,49 @@ readInstruction(std::istream& input, Module& module, Mapping& mapping)
     case 0x20:
     case 0x21: return readInstructionLoad(input, code, module, mapping);
     case 0x30:
-    case 0x31: return readInstructionAdd(input, code, module, mapping);
+    case 0x31:
+    case 0x32:
+    case 0x33: return readInstructionAdd(input, code, module, mapping);
     case 0x40:
     case 0x41:
-    case 0x42: return readInstructionSub(input, code, module, mapping);
+    case 0x42:
+    case 0x43: return readInstructionSub(input, code, module, mapping);
     case 0x50:
-    case 0x51: return readInstructionMul(input, code, module, mapping);
+    case 0x51:
+    case 0x52:
+    case 0x53: return readInstructionMul(input, code, module, mapping);
     case 0x60:
     case 0x61:
-    case 0x62: return readInstructionDiv(input, code, module, mapping);
+    case 0x62:
+    case 0x63: return readInstructionDiv(input, code, module, mapping);
     case 0x70:
     case 0x71:
-    case 0x72: return readInstructionRem(input, code, module, mapping);
+    case 0x72:
+    case 0x73: return readInstructionRem(input, code, module, mapping);
     case 0x80:
-    case 0x81: return readInstructionCmp(input, code, module, mapping);
+    case 0x81:
+    case 0x82:
+    case 0x83: return readInstructionCmp(input, code, module, mapping);
     case 0x90:
     case 0x91:
-    case 0x92: return readInstructionAnd(input, code, module, mapping);
+    case 0x92:
+    case 0x93: return readInstructionAnd(input, code, module, mapping);
     case 0xA0:
     case 0xA1:
-    case 0xA2: return readInstructionOr(input, code, module, mapping);
+    case 0xA2:
+    case 0xA3: return readInstructionOr(input, code, module, mapping);
     case 0xB0:
     case 0xB1:
-    case 0xB2: return readInstructionXor(input, code, module, mapping);
+    case 0xB2:
+    case 0xB3: return readInstructionXor(input, code, module, mapping);
     case 0xC0: return readInstructionBranch(input, code, module, mapping);
     case 0xC1:
+    case 0xC2:
         return readInstructionBranchCondition(input, code, module, mapping);
     case 0xD0:
     case 0xD1: return readInstructionCall(input, code, module, mapping);
-    case 0xE1: return readInstructionReturn(input, code, module, mapping);
+    case 0xE1:
+    case 0xE2: return readInstructionReturn(input, code, module, mapping);
     case 0xE0: return readInstructionReturnVoid(input, code, module, mapping);
     }
 
@@ -1283,7 +1145,7 @@ Module deserialize(std::istream& input)
     Byte versionMajor = readByte(input);
     Byte versionMinor = readByte(input);
 
-    if (versionMajor != Byte(0x00) || versionMinor != Byte(0x01))
+    if (versionMajor != Byte(0x00) || versionMinor != Byte(0x02))
         throw std::runtime_error("unsupported version");
 
     // TODO: read structures
@@ -410,6 +410,47 @@ void writeBlock(std::ostream& out, Mapping& mapping, ViewPtr<Block> block)
 
 /* ************************************************************************* */
 
+/**
+ * @brief      Write instruction operand, either constant or value index.
+ *
+ * @param      out      The output stream.
+ * @param      mapping  The mapping in block.
+ * @param      value    The operand.
+ */
+void writeOperand(std::ostream& out, Mapping& mapping, ViewPtr<Value> value)
+{
+    if (value->isConst())
+        writeConst(out, value);
+    else
+        writeValue(out, mapping, value);
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Returns code of binary instruction by constant operands.
+ *
+ * @details    Base code is followed by variants with constant second,
+ *             constant first and both constant operands.
+ *
+ * @param      base   The base instruction code.
+ * @param      instr  The instruction.
+ *
+ * @tparam     Instr  Instruction type.
+ *
+ * @return     The instruction code.
+ */
+template<typename Instr>
+Byte binaryCode(Byte base, const Instr& instr)
+{
+    const int first  = instr.value1()->isConst() ? 2 : 0;
+    const int second = instr.value2()->isConst() ? 1 : 0;
+
+    return static_cast<Byte>(static_cast<int>(base) + (first | second));
+}
+
+/* ************************************************************************* */
+
 void writeInstruction(
     std::ostream& out,
     Mapping& mapping,
@@ -520,25 +561,15 @@ void writeInstruction(
     Mapping& mapping,
     const InstructionAdd& instr)
 {
-    // | `add`       | `0x30` + `<type>` + `<value1>` + `<value2>` | 1+N+2+2
-    // bytes   | | `add`       | `0x31` + `<type>` + `<value1>` + `<constant>`
-    // | 1+N+2+M bytes   |
-
-    if (!instr.value2()->isConst())
-    {
-        writeByte(out, Byte{0x30});
-        writeType(out, *instr.resultType());
-        writeValue(out, mapping, instr.value1());
-        writeValue(out, mapping, instr.value2());
-    }
-    else
-    {
-        writeByte(out, Byte{0x31});
-        writeType(out, *instr.resultType());
-        writeValue(out, mapping, instr.value1());
-        writeConst(out, instr.value2());
-    }
+    // | `add` | `0x30` + `<type>` + `<value1>` + `<value2>` |
+    // | `add` | `0x31` + `<type>` + `<value1>` + `<constant>` |
+    // | `add` | `0x32` + `<type>` + `<constant>` + `<value2>` |
+    // | `add` | `0x33` + `<type>` + `<constant>` + `<constant>` |
 
+    writeByte(out, binaryCode(Byte{0x30}, instr));
+    writeType(out, *instr.resultType());
+    writeOperand(out, mapping, instr.value1());
+    writeOperand(out, mapping, instr.value2());
     writeValue(out, mapping, instr.result());
 }
 
@@ -549,36 +580,15 @@ void writeInstruction(
     Mapping& mapping,
     const InstructionSub& instr)
 {
-    // | `sub`       | `0x40` + `<type>` + `<value1>` + `<value2>` | 1+N+2+2
-    // bytes   | | `sub`       | `0x41` + `<type>` + `<value1>` + `<constant>`
-    // | 1+N+2+M bytes   | | `sub`       | `0x42` + `<type>` + `<constant>` +
-    // `<value2>`              | 1+N+M+2 bytes   |
-
-    if (!instr.value2()->isConst())
-    {
-        if (!instr.value1()->isConst())
-        {
-            writeByte(out, Byte{0x40});
-            writeType(out, *instr.resultType());
-            writeValue(out, mapping, instr.value1());
-            writeValue(out, mapping, instr.value2());
-        }
-        else
-        {
-            writeByte(out, Byte{0x42});
-            writeType(out, *instr.resultType());
-            writeConst(out, instr.value1());
-            writeValue(out, mapping, instr.value2());
-        }
-    }
-    else
-    {
-        writeByte(out, Byte{0x41});
-        writeType(out, *instr.resultType());
-        writeValue(out, mapping, instr.value1());
-        writeConst(out, instr.value2());
-    }
+    // | `sub` | `0x40` + `<type>` + `<value1>` + `<value2>` |
+    // | `sub` | `0x41` + `<type>` + `<value1>` + `<constant>` |
+    // | `sub` | `0x42` + `<type>` + `<constant>` + `<value2>` |
+    // | `sub` | `0x43` + `<type>` + `<constant>` + `<constant>` |
 
+    writeByte(out, binaryCode(Byte{0x40}, instr));
+    writeType(out, *instr.resultType());
+    writeOperand(out, mapping, instr.value1());
+    writeOperand(out, mapping, instr.value2());
     writeValue(out, mapping, instr.result());
 }
 
@@ -589,25 +599,15 @@ void writeInstruction(
     Mapping& mapping,
     const InstructionMul& instr)
 {
-    // | `mul`       | `0x50` + `<type>` + `<value1>` + `<value2>` | 1+N+2+2
-    // bytes   | | `mul`       | `0x51` + `<type>` + `<value1>` + `<constant>`
-    // | 1+N+2+M bytes   |
-
-    if (!instr.value2()->isConst())
-    {
-        writeByte(out, Byte{0x50});
-        writeType(out, *instr.resultType());
-        writeValue(out, mapping, instr.value1());
-        writeValue(out, mapping, instr.value2());
-    }
-    else
-    {
-        writeByte(out, Byte{0x51});
-        writeType(out, *instr.resultType());
-        writeValue(out, mapping, instr.value1());
-        writeConst(out, instr.value2());
-    }
+    // | `mul` | `0x50` + `<type>` + `<value1>` + `<value2>` |
+    // | `mul` | `0x51` + `<type>` + `<value1>` + `<constant>` |
+    // | `mul` | `0x52` + `<type>` + `<constant>` + `<value2>` |
+    // | `mul` | `0x53` + `<type>` + `<constant>` + `<constant>` |
 
+    writeByte(out, binaryCode(Byte{0x50}, instr));
+    writeType(out, *instr.resultType());
+    writeOperand(out, mapping, instr.value1());
+    writeOperand(out, mapping, instr.value2());
     writeValue(out, mapping, instr.result());
 }
 
@@ -618,36 +618,15 @@ void writeInstruction(
     Mapping& mapping,
     const InstructionDiv& instr)
 {
-    // | `div`       | `0x60` + `<type>` + `<value1>` + `<value2>` | 1+N+2+2
-    // bytes   | | `div`       | `0x61` + `<type>` + `<value1>` + `<constant>`
-    // | 1+N+2+M bytes   | | `div`       | `0x62` + `<type>` + `<constant>` +
-    // `<value2>`              | 1+N+M+2 bytes   |
-
-    if (!instr.value2()->isConst())
-    {
-        if (!instr.value1()->isConst())
-        {
-            writeByte(out, Byte{0x60});
-            writeType(out, *instr.resultType());
-            writeValue(out, mapping, instr.value1());
-            writeValue(out, mapping, instr.value2());
-        }
-        else
-        {
-            writeByte(out, Byte{0x62});
-            writeType(out, *instr.resultType());
-            writeConst(out, instr.value1());
-            writeValue(out, mapping, instr.value2());
-        }
-    }
-    else
-    {
-        writeByte(out, Byte{0x61});
-        writeType(out, *instr.resultType());
-        writeValue(out, mapping, instr.value1());
-        writeConst(out, instr.value2());
-    }
+    // | `div` | `0x60` + `<type>` + `<value1>` + `<value2>` |
+    // | `div` | `0x61` + `<type>` + `<value1>` + `<constant>` |
+    // | `div` | `0x62` + `<type>` + `<constant>` + `<value2>` |
+    // | `div` | `0x63` + `<type>` + `<constant>` + `<constant>` |
 
+    writeByte(out, binaryCode(Byte{0x60}, instr));
+    writeType(out, *instr.resultType());
+    writeOperand(out, mapping, instr.value1());
+    writeOperand(out, mapping, instr.value2());
     writeValue(out, mapping, instr.result());
 }
 
@@ -658,36 +637,15 @@ void writeInstruction(
     Mapping& mapping,
     const InstructionRem& instr)
 {
-    // | `rem`       | `0x70` + `<type>` + `<value1>` + `<value2>` | 1+N+2+2
-    // bytes   | | `rem`       | `0x71` + `<type>` + `<value1>` + `<constant>`
-    // | 1+N+2+M bytes   | | `rem`       | `0x72` + `<type>` + `<constant>` +
-    // `<value2>`              | 1+N+M+2 bytes   |
-
-    if (!instr.value2()->isConst())
-    {
-        if (!instr.value1()->isConst())
-        {
-            writeByte(out, Byte{0x70});
-            writeType(out, *instr.resultType());
-            writeValue(out, mapping, instr.value1());
-            writeValue(out, mapping, instr.value2());
-        }
-        else
-        {
-            writeByte(out, Byte{0x72});
-            writeType(out, *instr.resultType());
-            writeConst(out, instr.value1());
-            writeValue(out, mapping, instr.value2());
-        }
-    }
-    else
-    {
-        writeByte(out, Byte{0x71});
-        writeType(out, *instr.resultType());
-        writeValue(out, mapping, instr.value1());
-        writeConst(out, instr.value2());
-    }
+    // | `rem` | `0x70` + `<type>` + `<value1>` + `<value2>` |
+    // | `rem` | `0x71` + `<type>` + `<value1>` + `<constant>` |
+    // | `rem` | `0x72` + `<type>` + `<constant>` + `<value2>` |
+    // | `rem` | `0x73` + `<type>` + `<constant>` + `<constant>` |
 
+    writeByte(out, binaryCode(Byte{0x70}, instr));
+    writeType(out, *instr.resultType());
+    writeOperand(out, mapping, instr.value1());
+    writeOperand(out, mapping, instr.value2());
     writeValue(out, mapping, instr.result());
 }
 
@@ -698,27 +656,16 @@ void writeInstruction(
     Mapping& mapping,
     const InstructionCmp& instr)
 {
-    // | `cmp`       | `0x80` + `<op>` + `<type>` + `<value1>` + `<value2>` |
-    // 1+1+N+2+2 bytes | | `cmp`       | `0x81` + `<op>` + `<type>` + `<value1>`
-    // + `<constant>`     | 1+1+N+2+M bytes |
-
-    if (!instr.value2()->isConst())
-    {
-        writeByte(out, Byte{0x80});
-        writeByte(out, static_cast<Byte>(instr.operation()));
-        writeType(out, *instr.resultType());
-        writeValue(out, mapping, instr.value1());
-        writeValue(out, mapping, instr.value2());
-    }
-    else
-    {
-        writeByte(out, Byte{0x81});
-        writeByte(out, static_cast<Byte>(instr.operation()));
-        writeType(out, *instr.resultType());
-        writeValue(out, mapping, instr.value1());
-        writeConst(out, instr.value2());
-    }
+    // | `cmp` | `0x80` + `<op>` + `<type>` + `<value1>` + `<value2>` |
+    // | `cmp` | `0x81` + `<op>` + `<type>` + `<value1>` + `<constant>` |
+    // | `cmp` | `0x82` + `<op>` + `<type>` + `<constant>` + `<value2>` |
+    // | `cmp` | `0x83` + `<op>` + `<type>` + `<constant>` + `<constant>` |
 
+    writeByte(out, binaryCode(Byte{0x80}, instr));
+    writeByte(out, static_cast<Byte>(instr.operation()));
+    writeType(out, *instr.resultType());
+    writeOperand(out, mapping, instr.value1());
+    writeOperand(out, mapping, instr.value2());
     writeValue(out, mapping, instr.result());
 }
 
@@ -729,35 +676,16 @@ void writeInstruction(
     Mapping& mapping,
     const InstructionAnd& instr)
 {
-    // | `and`       | `0x90` + `<type>` + `<value1>` + `<value2>` | 1+N+2+2
-    // bytes   | | `and`       | `0x91` + `<type>` + `<value1>` + `<constant>`
-    // | 1+N+2+M bytes   | | `and`       | `0x92` + `<type>` + `<constant>` +
-    // `<value2>`              | 1+N+M+2 bytes   |
+    // | `and` | `0x90` + `<type>` + `<value1>` + `<value2>` |
+    // | `and` | `0x91` + `<type>` + `<value1>` + `<constant>` |
+    // | `and` | `0x92` + `<type>` + `<constant>` + `<value2>` |
+    // | `and` | `0x93` + `<type>` + `<constant>` + `<constant>` |
 
-    if (!instr.value2()->isConst())
-    {
-        if (!instr.value1()->isConst())
-        {
-            writeByte(out, Byte{0x90});
-            writeType(out, *instr.resultType());
-            writeValue(out, mapping, instr.value1());
-            writeValue(out, mapping, instr.value2());
-        }
-        else
-        {
-            writeByte(out, Byte{0x92});
-            writeType(out, *instr.resultType());
-            writeConst(out, instr.value1());
-            writeValue(out, mapping, instr.value2());
-        }
-    }
-    else
-    {
-        writeByte(out, Byte{0x91});
-        writeType(out, *instr.resultType());
-        writeValue(out, mapping, instr.value1());
-        writeConst(out, instr.value2());
-    }
+    writeByte(out, binaryCode(Byte{0x90}, instr));
+    writeType(out, *instr.resultType());
+    writeOperand(out, mapping, instr.value1());
+    writeOperand(out, mapping, instr.value2());
+    writeValue(out, mapping, instr.result());
 }
 
 /* ************************************************************************* */
@@ -767,36 +695,15 @@ void writeInstruction(
     Mapping& mapping,
     const InstructionOr& instr)
 {
-    // | `or`        | `0xA0` + `<type>` + `<value1>` + `<value2>` | 1+N+2+2
-    // bytes   | | `or`        | `0xA1` + `<type>` + `<value1>` + `<constant>`
-    // | 1+N+2+M bytes   | | `or`        | `0xA2` + `<type>` + `<constant>` +
-    // `<value2>`              | 1+N+M+2 bytes   |
-
-    if (!instr.value2()->isConst())
-    {
-        if (!instr.value1()->isConst())
-        {
-            writeByte(out, Byte{0xA0});
-            writeType(out, *instr.resultType());
-            writeValue(out, mapping, instr.value1());
-            writeValue(out, mapping, instr.value2());
-        }
-        else
-        {
-            writeByte(out, Byte{0xA2});
-            writeType(out, *instr.resultType());
-            writeConst(out, instr.value1());
-            writeValue(out, mapping, instr.value2());
-        }
-    }
-    else
-    {
-        writeByte(out, Byte{0xA1});
-        writeType(out, *instr.resultType());
-        writeValue(out, mapping, instr.value1());
-        writeConst(out, instr.value2());
-    }
+    // | `or` | `0xA0` + `<type>` + `<value1>` + `<value2>` |
+    // | `or` | `0xA1` + `<type>` + `<value1>` + `<constant>` |
+    // | `or` | `0xA2` + `<type>` + `<constant>` + `<value2>` |
+    // | `or` | `0xA3` + `<type>` + `<constant>` + `<constant>` |
 
+    writeByte(out, binaryCode(Byte{0xA0}, instr));
+    writeType(out, *instr.resultType());
+    writeOperand(out, mapping, instr.value1());
+    writeOperand(out, mapping, instr.value2());
     writeValue(out, mapping, instr.result());
 }
 
@@ -807,36 +714,15 @@ void writeInstruction(
     Mapping& mapping,
     const InstructionXor& instr)
 {
-    // | `xor`       | `0xB0` + `<type>` + `<value1>` + `<value2>` | 1+N+2+2
-    // bytes   | | `xor`       | `0xB1` + `<type>` + `<value1>` + `<constant>`
-    // | 1+N+2+M bytes   | | `xor`       | `0xB2` + `<type>` + `<constant>` +
-    // `<value2>`              | 1+N+M+2 bytes   |
-
-    if (!instr.value2()->isConst())
-    {
-        if (!instr.value1()->isConst())
-        {
-            writeByte(out, Byte{0xB0});
-            writeType(out, *instr.resultType());
-            writeValue(out, mapping, instr.value1());
-            writeValue(out, mapping, instr.value2());
-        }
-        else
-        {
-            writeByte(out, Byte{0xB2});
-            writeType(out, *instr.resultType());
-            writeConst(out, instr.value1());
-            writeValue(out, mapping, instr.value2());
-        }
-    }
-    else
-    {
-        writeByte(out, Byte{0xB1});
-        writeType(out, *instr.resultType());
-        writeValue(out, mapping, instr.value1());
-        writeConst(out, instr.value2());
-    }
+    // | `xor` | `0xB0` + `<type>` + `<value1>` + `<value2>` |
+    // | `xor` | `0xB1` + `<type>` + `<value1>` + `<constant>` |
+    // | `xor` | `0xB2` + `<type>` + `<constant>` + `<value2>` |
+    // | `xor` | `0xB3` + `<type>` + `<constant>` + `<constant>` |
 
+    writeByte(out, binaryCode(Byte{0xB0}, instr));
+    writeType(out, *instr.resultType());
+    writeOperand(out, mapping, instr.value1());
+    writeOperand(out, mapping, instr.value2());
     writeValue(out, mapping, instr.result());
 }
 
@@ -860,11 +746,21 @@ void writeInstruction(
     Mapping& mapping,
     const InstructionBranchCondition& instr)
 {
-    // | `branch`    | `0xC1` + `<value>` + `<label1>` + `<label2>` | 1+2+2+2
-    // bytes   |
+    // | `branch` | `0xC1` + `<value>` + `<label1>` + `<label2>` |
+    // | `branch` | `0xC2` + `<type>` + `<constant>` + `<label1>` + `<label2>` |
+
+    if (!instr.condition()->isConst())
+    {
+        writeByte(out, Byte{0xC1});
+        writeValue(out, mapping, instr.condition());
+    }
+    else
+    {
+        writeByte(out, Byte{0xC2});
+        writeType(out, *instr.condition()->type());
+        writeConst(out, instr.condition());
+    }
 
-    writeByte(out, Byte{0xC1});
-    writeValue(out, mapping, instr.condition());
     writeBlock(out, mapping, instr.blockTrue());
     writeBlock(out, mapping, instr.blockFalse());
 }
@@ -939,10 +835,20 @@ void writeInstruction(
     const InstructionReturn& instr)
 {
     // | `return`    | `0xE1` + `<type>` + `<value>` | 1+N+2 bytes     |
+    // | `return`    | `0xE2` + `<type>` + `<constant>` | 1+N+M bytes     |
 
-    writeByte(out, Byte{0xE1});
-    writeType(out, *instr.type());
-    writeUint16(out, mapValue(mapping, instr.value()));
+    if (!instr.value()->isConst())
+    {
+        writeByte(out, Byte{0xE1});
+        writeType(out, *instr.type());
+        writeValue(out, mapping, instr.value());
+    }
+    else
+    {
+        writeByte(out, Byte{0xE2});
+        writeType(out, *instr.type());
+        writeConst(out, instr.value());
+    }
 }
 
 /* ************************************************************************* */
@@ -1055,6 +961,15 @@ void writeFunction(std::ostream& output, const Function& function)
 
     // Blocks
     Mapping mapping;
+
+    // Reader maps arguments in order before any other value
+    for (const auto& arg : function.arguments())
+        mapValue(mapping, arg.get());
+
+    // Reader refers blocks by position
+    for (const auto& block : function.blocks())
+        mapping.blocks.emplace(block.get(), mapping.blocks.size());
+
     writeList(output, function.blocks(), [&](auto& output, const auto& block) {
         writeBlock(output, mapping, *block);
     });
@@ -1074,9 +989,9 @@ void serialize(std::ostream& output, const Module& module)
     writeByte(output, Byte('R'));
     writeByte(output, Byte('D'));
 
-    // Version 0.1
+    // Version 0.2
     writeByte(output, Byte(0x00));
-    writeByte(output, Byte(0x01));
+    writeByte(output, Byte(0x02));
 
     // TODO: write structures
     writeUint16(output, 0);
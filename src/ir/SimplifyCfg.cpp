@@ -0,0 +1,324 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// Declaration
+#include "shard/ir/SimplifyCfg.hpp"
+
+// Shard
+#include "shard/Set.hpp"
+#include "shard/ir/Block.hpp"
+#include "shard/ir/Constant.hpp"
+#include "shard/ir/Function.hpp"
+#include "shard/ir/Instruction.hpp"
+#include "shard/ir/Module.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::ir {
+
+/* ************************************************************************* */
+
+namespace {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Returns if block contains only an unconditional branch.
+ *
+ * @param      block  The block.
+ *
+ * @return     True if block is empty, False otherwise.
+ */
+bool isEmptyBranch(const Block& block)
+{
+    return block.size() == 1 &&
+           block.instructions().front()->is<InstructionBranch>();
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Follow a chain of empty blocks to the final target.
+ *
+ * @param      block  The block jump to.
+ *
+ * @return     The first block in chain which does something.
+ */
+ViewPtr<Block> resolveTarget(ViewPtr<Block> block)
+{
+    Set<ViewPtr<Block>> visited;
+
+    // Visited set prevents infinite loop over a cycle of empty blocks
+    while (isEmptyBranch(*block) && visited.insert(block).second)
+        block = block->instructions().front()->as<InstructionBranch>().block();
+
+    return block;
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Replace conditional branches which always jump to the same
+ *             block by unconditional branch.
+ *
+ * @param      function  The function.
+ *
+ * @return     If the function was changed.
+ */
+bool foldConditions(Function& function)
+{
+    bool changed = false;
+
+    for (const auto& block : function.blocks())
+    {
+        const auto term = block->terminator();
+
+        if (!term || !term->is<InstructionBranchCondition>())
+            continue;
+
+        const auto& branch = term->as<InstructionBranchCondition>();
+        const auto condition = branch.condition();
+        ViewPtr<Block> target;
+
+        if (branch.blockTrue() == branch.blockFalse())
+        {
+            target = branch.blockTrue();
+        }
+        else if (condition->isConst() && condition->type()->is<TypeInt1>())
+        {
+            target = static_cast<const ConstInt1&>(*condition).value()
+                         ? branch.blockTrue()
+                         : branch.blockFalse();
+        }
+
+        if (!target)
+            continue;
+
+        block->instructions().back() = makeUnique<InstructionBranch>(target);
+        changed                      = true;
+    }
+
+    return changed;
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Redirect branches going through empty blocks directly to the
+ *             final target.
+ *
+ * @param      function  The function.
+ *
+ * @return     If the function was changed.
+ */
+bool threadJumps(Function& function)
+{
+    bool changed = false;
+
+    for (const auto& block : function.blocks())
+    {
+        const auto term = block->terminator();
+
+        if (!term)
+            continue;
+
+        if (term->is<InstructionBranch>())
+        {
+            auto& branch = term->as<InstructionBranch>();
+            auto target  = resolveTarget(branch.block());
+
+            if (target != branch.block())
+            {
+                branch.setBlock(target);
+                changed = true;
+            }
+        }
+        else if (term->is<InstructionBranchCondition>())
+        {
+            auto& branch     = term->as<InstructionBranchCondition>();
+            auto targetTrue  = resolveTarget(branch.blockTrue());
+            auto targetFalse = resolveTarget(branch.blockFalse());
+
+            if (targetTrue != branch.blockTrue())
+            {
+                branch.setBlockTrue(targetTrue);
+                changed = true;
+            }
+
+            if (targetFalse != branch.blockFalse())
+            {
+                branch.setBlockFalse(targetFalse);
+                changed = true;
+            }
+        }
+    }
+
+    return changed;
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Merge blocks into their only predecessor if the predecessor
+ *             unconditionally jumps into them.
+ *
+ * @param      function  The function.
+ *
+ * @return     If the function was changed.
+ */
+bool mergeBlocks(Function& function)
+{
+    bool changed      = false;
+    auto predecessors = function.predecessors();
+    const auto entry  = function.entryBlock();
+
+    for (const auto& ptr : function.blocks())
+    {
+        const auto block = makeView(ptr);
+
+        while (true)
+        {
+            const auto term = block->terminator();
+
+            if (!term || !term->is<InstructionBranch>())
+                break;
+
+            const auto succ = term->as<InstructionBranch>().block();
+
+            if (succ == block || succ == entry)
+                break;
+
+            if (predecessors[succ].size() != 1)
+                break;
+
+            // Replace branch by successor instructions
+            auto& instructions = block->instructions();
+            instructions.pop_back();
+
+            for (auto& instr : succ->instructions())
+                instructions.push_back(std::move(instr));
+
+            succ->instructions().clear();
+            predecessors[succ].clear();
+
+            // Merged block is the new predecessor of successor's successors
+            for (auto next : block->successors())
+            {
+                for (auto& pred : predecessors[next])
+                {
+                    if (pred == succ)
+                        pred = block;
+                }
+            }
+
+            changed = true;
+        }
+    }
+
+    return changed;
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Remove blocks which cannot be reached from the entry block.
+ *
+ * @param      function  The function.
+ *
+ * @return     If the function was changed.
+ */
+bool removeUnreachable(Function& function)
+{
+    Set<ViewPtr<Block>> reachable;
+    Vector<ViewPtr<Block>> stack{function.entryBlock()};
+
+    while (!stack.empty())
+    {
+        const auto block = stack.back();
+        stack.pop_back();
+
+        if (!reachable.insert(block).second)
+            continue;
+
+        for (auto succ : block->successors())
+            stack.push_back(succ);
+    }
+
+    if (reachable.size() == function.blocks().size())
+        return false;
+
+    PtrVector<Block> blocks;
+    blocks.reserve(reachable.size());
+
+    for (auto& block : function.blocks())
+    {
+        if (reachable.count(block.get()))
+            blocks.push_back(std::move(block));
+    }
+
+    function.setBlocks(std::move(blocks));
+
+    return true;
+}
+
+/* ************************************************************************* */
+
+} // namespace
+
+/* ************************************************************************* */
+
+bool simplifyCfg(Function& function)
+{
+    if (function.blocks().empty())
+        return false;
+
+    bool changed = false;
+
+    while (true)
+    {
+        bool iteration = false;
+
+        iteration |= foldConditions(function);
+        iteration |= threadJumps(function);
+        iteration |= mergeBlocks(function);
+        iteration |= removeUnreachable(function);
+
+        if (!iteration)
+            break;
+
+        changed = true;
+    }
+
+    return changed;
+}
+
+/* ************************************************************************* */
+
+bool simplifyCfg(Module& module)
+{
+    bool changed = false;
+
+    for (const auto& function : module.functions())
+        changed |= simplifyCfg(*function);
+
+    return changed;
+}
+
+/* ************************************************************************* */
+
+} // namespace shard::ir
+
+/* ************************************************************************* */
@@ -0,0 +1,110 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// Declaration
+#include "shard/ir/Type.hpp"
+
+// C++
+#include <functional>
+
+// Shard
+#include "shard/utility.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::ir {
+
+/* ************************************************************************* */
+
+bool Type::equals(const Type& other) const noexcept
+{
+    if (this == &other)
+        return true;
+
+    if (kind() != other.kind())
+        return false;
+
+    switch (kind())
+    {
+    case TypeKind::Pointer:
+    {
+        const auto first  = as<TypePointer>().type();
+        const auto second = other.as<TypePointer>().type();
+
+        if (!first || !second)
+            return first == second;
+
+        return first->equals(*second);
+    }
+
+    case TypeKind::Struct:
+    {
+        const auto& first  = as<TypeStruct>();
+        const auto& second = other.as<TypeStruct>();
+
+        if (first.size() != second.size())
+            return false;
+
+        for (size_t i = 0; i < first.size(); ++i)
+        {
+            if (!first.field(i)->equals(*second.field(i)))
+                return false;
+        }
+
+        return true;
+    }
+
+    default: return true;
+    }
+}
+
+/* ************************************************************************* */
+
+std::size_t Type::hash() const noexcept
+{
+    std::size_t result = std::hash<int>{}(static_cast<int>(kind()));
+
+    switch (kind())
+    {
+    case TypeKind::Pointer:
+    {
+        const auto type = as<TypePointer>().type();
+
+        if (type)
+            result = hashCombine(result, type->hash());
+
+        break;
+    }
+
+    case TypeKind::Struct:
+    {
+        for (const auto& field : as<TypeStruct>().fields())
+            result = hashCombine(result, field->hash());
+
+        break;
+    }
+
+    default: break;
+    }
+
+    return result;
+}
+
+/* ************************************************************************* */
+
+} // namespace shard::ir
+
+/* ************************************************************************* */
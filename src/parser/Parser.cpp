@@ -16,6 +16,9 @@
 
 #include "shard/parser/Parser.hpp"
 
+// C++
+#include <utility>
+
 /* ************************************************************************* */
 
 namespace shard::parser {
@@ -27,16 +30,15 @@ namespace {
 /* ************************************************************************* */
 
 /**
- * @brief      Calculate node end location from start location and token value.
+ * @brief      Calculate node end offset from token.
  *
- * @param      start  The start location.
- * @param      value  The token value.
+ * @param      token  The token.
  *
- * @return     End location.
+ * @return     End offset.
  */
-SourceLocation endLocation(const SourceLocation& start, const String& value)
+std::uint32_t endOffset(const tokenizer::Token& token)
 {
-    return {start.line(), start.column() + int(value.size())};
+    return token.offset() + token.value().size();
 }
 
 /* ************************************************************************* */
@@ -52,9 +54,9 @@ ast::IntLiteralExpr Parser::parseIntLiteralExpr()
     // Must be number
     check(tokenizer::TokenType::NumberLiteral);
 
-    auto value = std::stoi(token().value());
-    auto start = token().location();
-    auto end   = endLocation(start, token().value());
+    auto value = std::stoi(String(token().value()));
+    auto start = token().offset();
+    auto end   = endOffset(token());
 
     next();
 
@@ -70,13 +72,13 @@ ast::IdentifierExpr Parser::parseIdentifierExpr()
     // Must be identifier
     check(tokenizer::TokenType::Identifier);
 
-    auto value = token().value();
-    auto start = token().location();
-    auto end   = endLocation(start, token().value());
+    auto name  = symbol();
+    auto start = token().offset();
+    auto end   = endOffset(token());
 
     next();
 
-    return ast::IdentifierExpr{value, {start, end}};
+    return ast::IdentifierExpr{name, {start, end}};
 }
 
 /* ************************************************************************* */
@@ -87,7 +89,7 @@ ast::ParenExpr Parser::parseParenExpr()
 
     // "(", EXPRESSION, ")"
 
-    auto start = token().location();
+    auto start = token().offset();
 
     requireOther("(");
 
@@ -96,8 +98,7 @@ ast::ParenExpr Parser::parseParenExpr()
 
     requireOther(")");
 
-    auto cur = token().location();
-    auto end = endLocation(cur, token().value());
+    auto end = previousEnd();
 
     return ast::ParenExpr{std::move(expr), {start, end}};
 }
@@ -126,7 +127,7 @@ ast::ExprPtr Parser::parsePrimaryExpr()
     // Unknown
     else
     {
-        throw ParseError("unsupported expression", token().location());
+        throw ParseError("unsupported expression", location());
     }
 }
 
@@ -136,19 +137,18 @@ ast::ExprPtr Parser::parsePrefixExpr()
 {
     checkEol();
 
-    auto start = token().location();
+    auto start = token().offset();
 
     if (!isPrefixOperator())
         return parsePostfixExpr();
 
-    auto op = token().value();
+    auto op = String(token().value());
     next();
 
     // Parse another expression
     auto expr = parsePrefixExpr();
 
-    auto cur = token().location();
-    auto end = endLocation(cur, token().value());
+    auto end = expr->sourceRange().end();
 
     return make<ast::PrefixUnaryExpr>(
         std::move(op), std::move(expr), SourceRange{start, end});
@@ -160,7 +160,7 @@ ast::ExprPtr Parser::parsePostfixExpr()
 {
     checkEol();
 
-    auto start = token().location();
+    auto start = token().offset();
 
     // Primary expression
     ast::ExprPtr expr = parsePrimaryExpr();
@@ -168,9 +168,8 @@ ast::ExprPtr Parser::parsePostfixExpr()
     // Additinal postfix operators
     while (!isEmpty() && isPostfixOperator())
     {
-        auto op  = token().value();
-        auto cur = token().location();
-        auto end = endLocation(cur, token().value());
+        auto op  = String(token().value());
+        auto end = endOffset(token());
 
         next();
 
@@ -195,33 +194,46 @@ ast::ExprPtr Parser::parsePostfixExpr()
 /* ************************************************************************* */
 
 ast::ExprPtr Parser::parseBinaryExpr()
+{
+    return parseBinaryExpr(1);
+}
+
+/* ************************************************************************* */
+
+ast::ExprPtr Parser::parseBinaryExpr(unsigned precedence)
 {
     checkEol();
 
-    auto start = token().location();
+    auto start = token().offset();
 
     // Parse prefix operator
-    auto expr1 = parsePrefixExpr();
+    auto expr = parsePrefixExpr();
 
-    if (isBinaryOperator())
+    while (true)
     {
-        auto op = token().value();
+        const auto info = binaryOperator();
+
+        if (info.precedence == 0 || info.precedence < precedence)
+            break;
+
+        auto op = String(token().value());
         next();
 
-        auto expr2 = parseBinaryExpr();
+        // Right operand of left associative operator binds only tighter ones
+        auto rhs = parseBinaryExpr(
+            info.associativity == Associativity::Left ? info.precedence + 1
+                                                      : info.precedence);
 
-        auto end = expr2->sourceRange().end();
+        auto end = rhs->sourceRange().end();
 
-        return make<ast::BinaryExpr>(
+        expr = make<ast::BinaryExpr>(
             std::move(op),
-            std::move(expr1),
-            std::move(expr2),
+            std::move(expr),
+            std::move(rhs),
             SourceRange{start, end});
     }
-    else
-    {
-        return expr1;
-    }
+
+    return expr;
 }
 
 /* ************************************************************************* */
@@ -240,7 +252,9 @@ ast::Source Parser::parseSource()
     while (!isEmpty())
         stmts.push_back(parseStmt());
 
-    return ast::Source{std::move(stmts)};
+    auto context = std::exchange(m_context, makeUnique<ast::Context>());
+
+    return ast::Source{std::move(stmts), std::move(context)};
 }
 
 /* ************************************************************************* */
@@ -249,6 +263,13 @@ ast::StmtPtr Parser::parseStmt()
 {
     checkEol();
 
+    // Keyword handler
+    const auto& handler =
+        m_keywordParsers[static_cast<std::size_t>(token().keyword())];
+
+    if (handler)
+        return handler(*this);
+
     // Find handler
     auto it = m_stmtParsers.find(token().value());
 
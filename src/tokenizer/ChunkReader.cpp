@@ -0,0 +1,139 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// Declaration
+#include "shard/tokenizer/ChunkReader.hpp"
+
+// C++
+#include <cerrno>
+#include <ios>
+#include <istream>
+#include <system_error>
+
+#if defined(__unix__) || defined(__APPLE__)
+#    include <unistd.h>
+#endif
+
+/* ************************************************************************* */
+
+namespace shard::tokenizer {
+
+/* ************************************************************************* */
+
+ChunkReader::ChunkReader(std::istream& input, std::size_t chunkSize)
+    : m_input(&input)
+    , m_buffer(chunkSize)
+{
+    // Nothing to do
+}
+
+/* ************************************************************************* */
+
+ChunkReader::ChunkReader(int fd, std::size_t chunkSize)
+    : m_fd(fd)
+    , m_buffer(chunkSize)
+{
+    // Nothing to do
+}
+
+/* ************************************************************************* */
+
+std::size_t ChunkReader::read(String& output)
+{
+    // Failed input is never read again, not even reported as exhausted
+    if (m_error)
+        throw std::system_error(m_error, "unable to read input");
+
+    const auto start = output.size();
+
+    while (!m_empty && output.size() == start)
+    {
+        const auto size = readRaw();
+
+        if (size == 0)
+        {
+            m_empty = true;
+
+            // Lone CR at the end of input
+            if (m_carriageReturn)
+                output.push_back('\r');
+
+            break;
+        }
+
+        output.reserve(output.size() + size + 1);
+
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            const char chr = m_buffer[i];
+
+            // CR is written once it's known it isn't followed by LF
+            if (m_carriageReturn && chr != '\n')
+                output.push_back('\r');
+
+            m_carriageReturn = chr == '\r';
+
+            if (!m_carriageReturn)
+                output.push_back(chr);
+        }
+    }
+
+    return output.size() - start;
+}
+
+/* ************************************************************************* */
+
+std::size_t ChunkReader::readRaw()
+{
+    if (m_input)
+    {
+        m_input->read(m_buffer.data(), m_buffer.size());
+
+        if (m_input->bad())
+            fail(std::make_error_code(std::io_errc::stream));
+
+        return m_input->gcount();
+    }
+
+#if defined(__unix__) || defined(__APPLE__)
+    while (true)
+    {
+        const auto count = ::read(m_fd, m_buffer.data(), m_buffer.size());
+
+        if (count >= 0)
+            return count;
+
+        if (errno != EINTR)
+            fail(std::error_code(errno, std::generic_category()));
+    }
+#else
+    return 0;
+#endif
+}
+
+/* ************************************************************************* */
+
+void ChunkReader::fail(std::error_code error)
+{
+    m_error = error;
+    throw std::system_error(m_error, "unable to read input");
+}
+
+/* ************************************************************************* */
+
+} // namespace shard::tokenizer
+
+/* ************************************************************************* */
@@ -0,0 +1,475 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// Declaration
+#include "shard/tokenizer/Scanner.hpp"
+
+// C++
+#if defined(__x86_64__) && defined(__GNUC__)
+#    define SHARD_TOKENIZER_SIMD 1
+#    include <immintrin.h>
+#endif
+
+// Shard
+#include "shard/tokenizer/CharClass.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::tokenizer {
+
+/* ************************************************************************* */
+
+namespace {
+
+/* ************************************************************************* */
+
+/// Scanning function.
+using ScanFn = std::size_t (*)(const char*, std::size_t, std::size_t) noexcept;
+
+/// Searching function for one character.
+using UntilFn =
+    std::size_t (*)(const char*, std::size_t, std::size_t, char) noexcept;
+
+/// Searching function for two characters.
+using UntilAnyFn = std::size_t (*)(
+    const char*, std::size_t, std::size_t, char, char) noexcept;
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Scanning implementation for a single instruction set.
+ */
+struct Implementation
+{
+    /// Whitespace skipping.
+    ScanFn whitespace;
+
+    /// Identifier skipping.
+    ScanFn identifier;
+
+    /// Character search.
+    UntilFn until;
+
+    /// Two characters search.
+    UntilAnyFn untilAny;
+};
+
+/* ************************************************************************* */
+
+std::size_t scalarWhitespace(
+    const char* data,
+    std::size_t position,
+    std::size_t end) noexcept
+{
+    while (position < end && chars::isWhitespace(data[position]))
+        ++position;
+
+    return position;
+}
+
+/* ************************************************************************* */
+
+std::size_t scalarIdentifier(
+    const char* data,
+    std::size_t position,
+    std::size_t end) noexcept
+{
+    while (position < end && chars::isIdentifier(data[position]))
+        ++position;
+
+    return position;
+}
+
+/* ************************************************************************* */
+
+std::size_t scalarUntil(
+    const char* data,
+    std::size_t position,
+    std::size_t end,
+    char chr) noexcept
+{
+    while (position < end && data[position] != chr)
+        ++position;
+
+    return position;
+}
+
+/* ************************************************************************* */
+
+std::size_t scalarUntilAny(
+    const char* data,
+    std::size_t position,
+    std::size_t end,
+    char chr1,
+    char chr2) noexcept
+{
+    while (position < end && data[position] != chr1 && data[position] != chr2)
+        ++position;
+
+    return position;
+}
+
+/* ************************************************************************* */
+
+#ifdef SHARD_TOKENIZER_SIMD
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Returns mask of identifier characters in 16 bytes.
+ *
+ * @details    Letters are folded to lower case by setting bit 5, characters
+ *             outside of ASCII are negative and never match the ranges.
+ */
+inline __m128i sse2IdentifierMask(__m128i value) noexcept
+{
+    const __m128i lower = _mm_or_si128(value, _mm_set1_epi8(0x20));
+
+    const __m128i letter = _mm_and_si128(
+        _mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+        _mm_cmplt_epi8(lower, _mm_set1_epi8('z' + 1)));
+
+    const __m128i digit = _mm_and_si128(
+        _mm_cmpgt_epi8(value, _mm_set1_epi8('0' - 1)),
+        _mm_cmplt_epi8(value, _mm_set1_epi8('9' + 1)));
+
+    const __m128i underscore = _mm_cmpeq_epi8(value, _mm_set1_epi8('_'));
+
+    return _mm_or_si128(letter, _mm_or_si128(digit, underscore));
+}
+
+/* ************************************************************************* */
+
+std::size_t sse2Whitespace(
+    const char* data,
+    std::size_t position,
+    std::size_t end) noexcept
+{
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab   = _mm_set1_epi8('\t');
+
+    for (; position + 16 <= end; position += 16)
+    {
+        const __m128i value =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position));
+
+        const __m128i match = _mm_or_si128(
+            _mm_cmpeq_epi8(value, space), _mm_cmpeq_epi8(value, tab));
+
+        const unsigned stop = ~unsigned(_mm_movemask_epi8(match)) & 0xFFFF;
+
+        if (stop)
+            return position + __builtin_ctz(stop);
+    }
+
+    return scalarWhitespace(data, position, end);
+}
+
+/* ************************************************************************* */
+
+std::size_t sse2Identifier(
+    const char* data,
+    std::size_t position,
+    std::size_t end) noexcept
+{
+    for (; position + 16 <= end; position += 16)
+    {
+        const __m128i value =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position));
+
+        const unsigned stop =
+            ~unsigned(_mm_movemask_epi8(sse2IdentifierMask(value))) & 0xFFFF;
+
+        if (stop)
+            return position + __builtin_ctz(stop);
+    }
+
+    return scalarIdentifier(data, position, end);
+}
+
+/* ************************************************************************* */
+
+std::size_t sse2Until(
+    const char* data,
+    std::size_t position,
+    std::size_t end,
+    char chr) noexcept
+{
+    const __m128i needle = _mm_set1_epi8(chr);
+
+    for (; position + 16 <= end; position += 16)
+    {
+        const __m128i value =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position));
+
+        const unsigned stop =
+            _mm_movemask_epi8(_mm_cmpeq_epi8(value, needle));
+
+        if (stop)
+            return position + __builtin_ctz(stop);
+    }
+
+    return scalarUntil(data, position, end, chr);
+}
+
+/* ************************************************************************* */
+
+std::size_t sse2UntilAny(
+    const char* data,
+    std::size_t position,
+    std::size_t end,
+    char chr1,
+    char chr2) noexcept
+{
+    const __m128i needle1 = _mm_set1_epi8(chr1);
+    const __m128i needle2 = _mm_set1_epi8(chr2);
+
+    for (; position + 16 <= end; position += 16)
+    {
+        const __m128i value =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position));
+
+        const __m128i match = _mm_or_si128(
+            _mm_cmpeq_epi8(value, needle1), _mm_cmpeq_epi8(value, needle2));
+
+        const unsigned stop = _mm_movemask_epi8(match);
+
+        if (stop)
+            return position + __builtin_ctz(stop);
+    }
+
+    return scalarUntilAny(data, position, end, chr1, chr2);
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Returns mask of identifier characters in 32 bytes.
+ */
+__attribute__((target("avx2"))) inline __m256i
+avx2IdentifierMask(__m256i value) noexcept
+{
+    const __m256i lower = _mm256_or_si256(value, _mm256_set1_epi8(0x20));
+
+    const __m256i letter = _mm256_and_si256(
+        _mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)),
+        _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), lower));
+
+    const __m256i digit = _mm256_and_si256(
+        _mm256_cmpgt_epi8(value, _mm256_set1_epi8('0' - 1)),
+        _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), value));
+
+    const __m256i underscore =
+        _mm256_cmpeq_epi8(value, _mm256_set1_epi8('_'));
+
+    return _mm256_or_si256(letter, _mm256_or_si256(digit, underscore));
+}
+
+/* ************************************************************************* */
+
+__attribute__((target("avx2"))) std::size_t avx2Whitespace(
+    const char* data,
+    std::size_t position,
+    std::size_t end) noexcept
+{
+    const __m256i space = _mm256_set1_epi8(' ');
+    const __m256i tab   = _mm256_set1_epi8('\t');
+
+    for (; position + 32 <= end; position += 32)
+    {
+        const __m256i value = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(data + position));
+
+        const __m256i match = _mm256_or_si256(
+            _mm256_cmpeq_epi8(value, space), _mm256_cmpeq_epi8(value, tab));
+
+        const unsigned stop = ~unsigned(_mm256_movemask_epi8(match));
+
+        if (stop)
+            return position + __builtin_ctz(stop);
+    }
+
+    return sse2Whitespace(data, position, end);
+}
+
+/* ************************************************************************* */
+
+__attribute__((target("avx2"))) std::size_t avx2Identifier(
+    const char* data,
+    std::size_t position,
+    std::size_t end) noexcept
+{
+    for (; position + 32 <= end; position += 32)
+    {
+        const __m256i value = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(data + position));
+
+        const unsigned stop =
+            ~unsigned(_mm256_movemask_epi8(avx2IdentifierMask(value)));
+
+        if (stop)
+            return position + __builtin_ctz(stop);
+    }
+
+    return sse2Identifier(data, position, end);
+}
+
+/* ************************************************************************* */
+
+__attribute__((target("avx2"))) std::size_t avx2Until(
+    const char* data,
+    std::size_t position,
+    std::size_t end,
+    char chr) noexcept
+{
+    const __m256i needle = _mm256_set1_epi8(chr);
+
+    for (; position + 32 <= end; position += 32)
+    {
+        const __m256i value = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(data + position));
+
+        const unsigned stop =
+            _mm256_movemask_epi8(_mm256_cmpeq_epi8(value, needle));
+
+        if (stop)
+            return position + __builtin_ctz(stop);
+    }
+
+    return sse2Until(data, position, end, chr);
+}
+
+/* ************************************************************************* */
+
+__attribute__((target("avx2"))) std::size_t avx2UntilAny(
+    const char* data,
+    std::size_t position,
+    std::size_t end,
+    char chr1,
+    char chr2) noexcept
+{
+    const __m256i needle1 = _mm256_set1_epi8(chr1);
+    const __m256i needle2 = _mm256_set1_epi8(chr2);
+
+    for (; position + 32 <= end; position += 32)
+    {
+        const __m256i value = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(data + position));
+
+        const __m256i match = _mm256_or_si256(
+            _mm256_cmpeq_epi8(value, needle1),
+            _mm256_cmpeq_epi8(value, needle2));
+
+        const unsigned stop = _mm256_movemask_epi8(match);
+
+        if (stop)
+            return position + __builtin_ctz(stop);
+    }
+
+    return sse2UntilAny(data, position, end, chr1, chr2);
+}
+
+/* ************************************************************************* */
+
+#endif
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Selects the best implementation supported by the host.
+ *
+ * @return     The implementation.
+ */
+Implementation select() noexcept
+{
+#ifdef SHARD_TOKENIZER_SIMD
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2"))
+        return {avx2Whitespace, avx2Identifier, avx2Until, avx2UntilAny};
+
+    // SSE2 is part of x86-64 baseline
+    return {sse2Whitespace, sse2Identifier, sse2Until, sse2UntilAny};
+#else
+    return {scalarWhitespace, scalarIdentifier, scalarUntil, scalarUntilAny};
+#endif
+}
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Returns selected implementation.
+ *
+ * @return     The implementation.
+ */
+const Implementation& implementation() noexcept
+{
+    static const Implementation s_implementation = select();
+    return s_implementation;
+}
+
+/* ************************************************************************* */
+
+} // namespace
+
+/* ************************************************************************* */
+
+std::size_t scanWhitespace(
+    const char* data,
+    std::size_t position,
+    std::size_t end) noexcept
+{
+    return implementation().whitespace(data, position, end);
+}
+
+/* ************************************************************************* */
+
+std::size_t scanIdentifier(
+    const char* data,
+    std::size_t position,
+    std::size_t end) noexcept
+{
+    return implementation().identifier(data, position, end);
+}
+
+/* ************************************************************************* */
+
+std::size_t scanUntil(
+    const char* data,
+    std::size_t position,
+    std::size_t end,
+    char chr) noexcept
+{
+    return implementation().until(data, position, end, chr);
+}
+
+/* ************************************************************************* */
+
+std::size_t scanUntilAny(
+    const char* data,
+    std::size_t position,
+    std::size_t end,
+    char chr1,
+    char chr2) noexcept
+{
+    return implementation().untilAny(data, position, end, chr1, chr2);
+}
+
+/* ************************************************************************* */
+
+} // namespace shard::tokenizer
+
+/* ************************************************************************* */
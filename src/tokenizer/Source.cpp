@@ -16,10 +16,22 @@
 
 #include "shard/tokenizer/Source.hpp"
 
-/* ************************************************************************* */
-
 // C++
 #include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#    define SHARD_SOURCE_MMAP 1
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+// Shard
+#include "shard/Assert.hpp"
+#include "shard/File.hpp"
 
 /* ************************************************************************* */
 
@@ -27,52 +39,189 @@ namespace shard::tokenizer {
 
 /* ************************************************************************* */
 
-void Source::process(const String& source)
+Source::Source(const char* mapping, std::size_t size, FilePath filename)
+    : m_data(mapping)
+    , m_size(size)
+    , m_gap(size)
+    , m_mapping(mapping)
+    , m_filename(std::move(filename))
+    , m_lines(StringView(mapping, size))
 {
-    // Result size will be same or smaller than source
-    m_source.reserve(source.size());
+    SHARD_ASSERT(size <= MaxSize);
+}
 
-    // First line starts at position 0
-    m_lines.push_back(0);
+/* ************************************************************************* */
+
+Source::~Source()
+{
+#ifdef SHARD_SOURCE_MMAP
+    if (m_mapping)
+        ::munmap(const_cast<char*>(m_mapping), m_size);
+#endif
+}
 
-    // Foreach characters
-    for (std::size_t i = 0; i < source.size(); ++i)
+/* ************************************************************************* */
+
+UniquePtr<Source> Source::fromFile(const FilePath& path)
+{
+#ifdef SHARD_SOURCE_MMAP
+    const int fd = ::open(path.c_str(), O_RDONLY);
+
+    if (fd < 0)
+        return nullptr;
+
+    struct stat info;
+
+    // Only non-empty regular files can be mapped
+    if (::fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0)
     {
-        // NOTE: Is safe when `i` is last character, the standard specifies the
-        // following character will be `\0`.
-        if (source[i] == '\r' && source[i + 1] == '\n')
+        // Oversize file is rejected before it's mapped
+        if (static_cast<std::uintmax_t>(info.st_size) > MaxSize)
         {
-            // Store new line and advance
-            m_source.push_back('\n');
-            ++i;
-            m_lines.push_back(m_source.size());
+            ::close(fd);
+            checkSize(info.st_size, path);
         }
-        else if (source[i] == '\n')
+
+        void* mapping =
+            ::mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        ::close(fd);
+
+        if (mapping != MAP_FAILED)
+        {
+            return UniquePtr<Source>(new Source(
+                static_cast<const char*>(mapping), info.st_size, path));
+        }
+    }
+    else
+    {
+        ::close(fd);
+    }
+#endif
+
+    auto content = readFile(path);
+
+    if (!content)
+        return nullptr;
+
+    return makeUnique<Source>(std::move(*content), path);
+}
+
+/* ************************************************************************* */
+
+void Source::replace(std::size_t offset, std::size_t length, StringView text)
+{
+    SHARD_ASSERT(offset + length <= m_size);
+    checkSize(m_size - length + text.size(), m_filename);
+
+    if (m_mapping)
+    {
+        m_buffer = String(m_mapping, m_size);
+
+#ifdef SHARD_SOURCE_MMAP
+        ::munmap(const_cast<char*>(m_mapping), m_size);
+#endif
+        m_mapping = nullptr;
+        m_data    = m_buffer.data();
+    }
+
+    // Replaced text becomes part of the gap
+    moveGap(offset + length);
+    m_gap = offset;
+    m_gapSize += length;
+    m_size -= length;
+
+    if (m_gapSize < text.size())
+        grow(text.size());
+
+    std::memcpy(m_buffer.data() + m_gap, text.data(), text.size());
+    m_gap += text.size();
+    m_gapSize -= text.size();
+    m_size += text.size();
+
+    m_lines.replace(offset, length, text);
+}
+
+/* ************************************************************************* */
+
+void Source::moveGap(std::size_t position) const noexcept
+{
+    SHARD_ASSERT(position <= m_size);
+
+    if (m_gapSize > 0)
+    {
+        const auto data = m_buffer.data();
+
+        if (position < m_gap)
         {
-            m_source.push_back(source[i]);
-            m_lines.push_back(m_source.size());
+            std::memmove(
+                data + position + m_gapSize, data + position, m_gap - position);
         }
         else
         {
-            m_source.push_back(source[i]);
+            std::memmove(
+                data + m_gap, data + m_gap + m_gapSize, position - m_gap);
         }
     }
+
+    m_gap = position;
 }
 
 /* ************************************************************************* */
 
-SourceLocation Source::location(std::size_t position) const noexcept
+void Source::checkSize(std::size_t size, const FilePath& filename)
 {
-    // The array contains sorted positions. At first it will find first element
-    // which is greater than position so we need to get the previous one.
-    auto it =
-        std::prev(std::upper_bound(m_lines.begin(), m_lines.end(), position));
+    if (size > MaxSize)
+    {
+        throw std::length_error(
+            filename.string() + ": source larger than 4 GiB is not supported");
+    }
+}
+
+/* ************************************************************************* */
+
+void Source::process()
+{
+    // CRLF is replaced by LF in place, the result is never longer than input
+    auto out = m_buffer.find('\r');
+
+    if (out != String::npos)
+    {
+        for (std::size_t i = out; i < m_buffer.size(); ++i)
+        {
+            // NOTE: Is safe when `i` is last character, the standard specifies
+            // the following character will be `\0`.
+            if (m_buffer[i] == '\r' && m_buffer[i + 1] == '\n')
+                continue;
 
-    // Line is index in the array + 1
-    const int line   = std::distance(m_lines.begin(), it) + 1;
-    const int column = position - *it + 1;
+            m_buffer[out++] = m_buffer[i];
+        }
+
+        m_buffer.resize(out);
+    }
+
+    m_data  = m_buffer.data();
+    m_size  = m_buffer.size();
+    m_gap   = m_size;
+    m_lines = LineTable(StringView(m_data, m_size));
+}
+
+/* ************************************************************************* */
 
-    return SourceLocation{line, column};
+void Source::grow(std::size_t count)
+{
+    // The gap grows with the source so repeated insertion is amortized
+    const auto gap  = std::max(count, m_size / 2 + 8);
+    const auto tail = m_size - m_gap;
+
+    String buffer(m_size + gap, '\0');
+    std::memcpy(buffer.data(), m_data, m_gap);
+    std::memcpy(
+        buffer.data() + m_gap + gap, m_data + m_gap + m_gapSize, tail);
+
+    m_buffer  = std::move(buffer);
+    m_data    = m_buffer.data();
+    m_gapSize = gap;
 }
 
 /* ************************************************************************* */
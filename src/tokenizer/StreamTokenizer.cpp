@@ -0,0 +1,119 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// Declaration
+#include "shard/tokenizer/StreamTokenizer.hpp"
+
+// C++
+#include <cstdint>
+#include <stdexcept>
+
+// Shard
+#include "shard/Assert.hpp"
+#include "shard/tokenizer/Tokenizer.hpp"
+#include "shard/tokenizer/exceptions.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::tokenizer {
+
+/* ************************************************************************* */
+
+Optional<Token> StreamTokenizer::tokenize()
+{
+    while (true)
+    {
+        const auto size = m_window ? m_window->size() : 0;
+
+        if (m_position == size)
+        {
+            if (!fill())
+                return std::nullopt;
+
+            continue;
+        }
+
+        Tokenizer tokenizer(
+            SourceIterator(*m_window, m_position), m_window->end());
+
+        try
+        {
+            auto token = tokenizer.tokenize();
+            SHARD_ASSERT(token);
+
+            // Token touching the window end may continue in the next chunk
+            if (tokenizer.position() < size || m_reader->isEmpty())
+            {
+                m_position = tokenizer.position();
+
+                return Token(
+                    token->type(),
+                    token->value(),
+                    m_base + token->offset(),
+                    token->keyword(),
+                    token->op());
+            }
+        }
+        catch (const TokenizerError& err)
+        {
+            // Unterminated tokens are retried with more input
+            if (m_reader->isEmpty())
+            {
+                const auto& loc    = err.location();
+                const auto& window = m_window->lines();
+                const auto offset =
+                    window.lineStart(loc.line() - 1) + loc.column() - 1;
+
+                throw TokenizerError(err.message(), location(m_base + offset));
+            }
+        }
+
+        fill();
+    }
+}
+
+/* ************************************************************************* */
+
+bool StreamTokenizer::fill()
+{
+    // Keep only the unfinished token
+    String window;
+
+    if (m_window)
+        window = String(m_window->view(m_position, m_window->size()));
+
+    // The state is kept when reading fails
+    const auto size = window.size();
+    const auto read = m_reader->read(window);
+
+    // Offsets in the whole input are 32-bit
+    if (std::uint64_t(m_base) + m_position + window.size() > Source::MaxSize)
+        throw std::length_error("input larger than 4 GiB is not supported");
+
+    m_base += m_position;
+    m_position = 0;
+
+    m_lines.append(StringView(window).substr(size), m_base + size);
+    m_window = makeUnique<Source>(std::move(window));
+
+    return read != 0;
+}
+
+/* ************************************************************************* */
+
+} // namespace shard::tokenizer
+
+/* ************************************************************************* */
@@ -0,0 +1,73 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// Declaration
+#include "shard/tokenizer/Token.hpp"
+
+// Shard
+#include "shard/Assert.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::tokenizer {
+
+/* ************************************************************************* */
+
+String Token::decodedValue() const
+{
+    String result;
+    result.reserve(m_value.size());
+
+    for (std::size_t i = 0; i < m_value.size(); ++i)
+    {
+        if (m_value[i] == '\\' && i + 1 < m_value.size())
+        {
+            const auto chr = escape(m_value[++i]);
+            SHARD_ASSERT(chr);
+            result.push_back(*chr);
+        }
+        else
+        {
+            result.push_back(m_value[i]);
+        }
+    }
+
+    return result;
+}
+
+/* ************************************************************************* */
+
+Optional<char> Token::escape(char chr) noexcept
+{
+    switch (chr)
+    {
+    case '\'': return '\'';
+    case '"': return '"';
+    case '\\': return '\\';
+    case '0': return '\0';
+    case 'n': return '\n';
+    case 'r': return '\r';
+    case 't': return '\t';
+    }
+
+    return std::nullopt;
+}
+
+/* ************************************************************************* */
+
+} // namespace shard::tokenizer
+
+/* ************************************************************************* */
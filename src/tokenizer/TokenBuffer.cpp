@@ -0,0 +1,151 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// Declaration
+#include "shard/tokenizer/TokenBuffer.hpp"
+
+// Shard
+#include "shard/Assert.hpp"
+
+/* ************************************************************************* */
+
+namespace shard::tokenizer {
+
+/* ************************************************************************* */
+
+void TokenBuffer::reserve(std::size_t size)
+{
+    m_types.reserve(size);
+    m_keywords.reserve(size);
+    m_operators.reserve(size);
+    m_symbols.reserve(size);
+    m_offsets.reserve(size);
+    m_lengths.reserve(size);
+}
+
+/* ************************************************************************* */
+
+void TokenBuffer::push(const Token& token)
+{
+    switch (token.type())
+    {
+    case TokenType::Comment:
+    case TokenType::WhiteSpace:
+    case TokenType::EndOfLine: return;
+    default: break;
+    }
+
+    moveGap(size());
+
+    m_types.insert(token.type());
+    m_keywords.insert(token.keyword());
+    m_operators.insert(token.op());
+    m_symbols.insert(
+        token.type() == TokenType::Identifier ? Symbol(token.value())
+                                              : Symbol());
+    m_offsets.insert(token.offset());
+    m_lengths.insert(token.value().size());
+}
+
+/* ************************************************************************* */
+
+std::size_t TokenBuffer::lowerBound(std::uint32_t offset) const noexcept
+{
+    std::size_t first = 0;
+    std::size_t count = size();
+
+    while (count > 0)
+    {
+        const auto step = count / 2;
+
+        if (this->offset(first + step) < offset)
+        {
+            first += step + 1;
+            count -= step + 1;
+        }
+        else
+        {
+            count = step;
+        }
+    }
+
+    return first;
+}
+
+/* ************************************************************************* */
+
+void TokenBuffer::replace(
+    std::size_t first,
+    std::size_t last,
+    const TokenBuffer& tokens,
+    std::int64_t delta)
+{
+    SHARD_ASSERT(first <= last && last <= size());
+    SHARD_ASSERT(tokens.m_offsets.gap() == tokens.size());
+
+    moveGap(first);
+
+    const auto count = last - first;
+    m_types.erase(count);
+    m_keywords.erase(count);
+    m_operators.erase(count);
+    m_symbols.erase(count);
+    m_offsets.erase(count);
+    m_lengths.erase(count);
+
+    for (std::size_t i = 0; i < tokens.size(); ++i)
+    {
+        m_types.insert(tokens.m_types[i]);
+        m_keywords.insert(tokens.m_keywords[i]);
+        m_operators.insert(tokens.m_operators[i]);
+        m_symbols.insert(tokens.m_symbols[i]);
+        m_offsets.insert(tokens.m_offsets[i]);
+        m_lengths.insert(tokens.m_lengths[i]);
+    }
+
+    // Shift all following tokens at once
+    if (m_offsets.gap() < size())
+        m_end = static_cast<std::uint32_t>(m_end + delta);
+}
+
+/* ************************************************************************* */
+
+void TokenBuffer::moveGap(std::size_t position)
+{
+    if (m_offsets.gap() == position)
+        return;
+
+    // Nothing after the gap depends on the end, choose one covering all tokens
+    if (m_offsets.gap() == size())
+        m_end = end(size() - 1);
+
+    const auto reference = m_end;
+
+    m_types.moveGap(position);
+    m_keywords.moveGap(position);
+    m_operators.moveGap(position);
+    m_symbols.moveGap(position);
+    m_offsets.moveGap(
+        position,
+        [reference](std::uint32_t offset) { return reference - offset; });
+    m_lengths.moveGap(position);
+}
+
+/* ************************************************************************* */
+
+} // namespace shard::tokenizer
+
+/* ************************************************************************* */
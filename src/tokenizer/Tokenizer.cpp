@@ -18,6 +18,11 @@
 
 /* ************************************************************************* */
 
+// C++
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
 // Shard
 #include "shard/Assert.hpp"
 #include "shard/tokenizer/exceptions.hpp"
@@ -28,32 +33,33 @@ namespace shard::tokenizer {
 
 /* ************************************************************************* */
 
+// Token offsets are source positions narrowed to 32 bits
+static_assert(Source::MaxSize <= std::numeric_limits<std::uint32_t>::max());
+
+/* ************************************************************************* */
+
 namespace {
 
 /* ************************************************************************* */
 
+/// Distance from the window end a retokenized token must end before.
+constexpr std::size_t Lookahead = 16;
+
+/* ************************************************************************* */
+
 /**
- * @brief      Return escaped character.
+ * @brief      Check if escape sequence is supported.
  *
- * @param      chr       The character.
- * @param      location  The location.
- *
- * @return     The character.
+ * @param      it      The iterator pointing to character after backslash.
+ * @param      offset  The token offset used for error reporting.
  */
-char escape(char chr, const SourceLocation& location)
+void checkEscape(const SourceIterator& it, std::size_t offset)
 {
-    switch (chr)
+    if (!Token::escape(*it))
     {
-    case '\'': return '\'';
-    case '"': return '"';
-    case '\\': return '\\';
-    case '0': return '\0';
-    case 'n': return '\n';
-    case 'r': return '\r';
-    case 't': return '\t';
+        throw TokenizerError(
+            "Unsupported escape sequence", it.source().location(offset));
     }
-
-    throw TokenizerError("Unsupported escape sequence", location);
 }
 
 /* ************************************************************************* */
@@ -68,7 +74,7 @@ Optional<Token> Tokenizer::tokenize()
         return std::nullopt;
 
     // Identifier start
-    if (isLetter() || is('_'))
+    if (isIdentifierStart())
     {
         return tokenizeIdentifier();
     }
@@ -100,198 +106,336 @@ Optional<Token> Tokenizer::tokenize()
 
 /* ************************************************************************* */
 
+TokenBuffer Tokenizer::tokenizeAll()
+{
+    TokenBuffer tokens(source());
+
+    // Rough estimate, trivia and multi-character tokens are common
+    tokens.reserve((m_end.position() - m_current.position()) / 4);
+
+    while (auto token = tokenize())
+        tokens.push(*token);
+
+    return tokens;
+}
+
+/* ************************************************************************* */
+
 Token Tokenizer::tokenizeIdentifier()
 {
-    String value;
-    SourceLocation location = m_current.location();
+    const auto start  = m_current;
+    const auto offset = m_current.position();
 
-    SHARD_ASSERT(isIdentifier());
+    SHARD_ASSERT(isIdentifierStart());
 
-    while (isIdentifier())
-    {
-        value.push_back(*m_current);
-        ++m_current;
-    }
+    scan(scanIdentifier);
+
+    const auto value = text(start);
 
-    return Token(TokenType::Identifier, std::move(value), std::move(location));
+    return Token(TokenType::Identifier, value, offset, findKeyword(value));
 }
 
 /* ************************************************************************* */
 
 Token Tokenizer::tokenizeNumber()
 {
-    String value;
-    SourceLocation location = m_current.location();
+    const auto start  = m_current;
+    const auto offset = m_current.position();
 
     SHARD_ASSERT(isDigit());
-    value.push_back(*m_current);
     ++m_current;
 
-    while (isIdentifier())
-    {
-        value.push_back(*m_current);
-        ++m_current;
-    }
+    scan(scanIdentifier);
 
-    return Token(
-        TokenType::NumberLiteral, std::move(value), std::move(location));
+    return Token(TokenType::NumberLiteral, text(start), offset);
 }
 
 /* ************************************************************************* */
 
 Token Tokenizer::tokenizeString()
 {
-    String value;
-    SourceLocation location = m_current.location();
+    const auto offset = m_current.position();
 
     SHARD_ASSERT(is('"'));
     ++m_current;
 
-    while (!is('"'))
+    const auto start = m_current;
+
+    // Escape sequences are only validated, decoding is done on demand
+    while (true)
     {
-        if (isEmpty())
-            throw TokenizerError("missing terminating \" character", location);
+        scan(scanUntilAny, '"', '\\');
 
-        if (*m_current == '\\')
-        {
-            ++m_current;
-            value.push_back(escape(*m_current, location));
-        }
-        else
+        if (isEmpty())
         {
-            value.push_back(*m_current);
+            throw TokenizerError(
+                "missing terminating \" character", location(offset));
         }
 
+        if (is('"'))
+            break;
+
+        ++m_current;
+        checkEscape(m_current, offset);
         ++m_current;
     }
 
+    const auto value = text(start);
+
     SHARD_ASSERT(is('"'));
     ++m_current;
 
-    return Token(
-        TokenType::StringLiteral, std::move(value), std::move(location));
+    return Token(TokenType::StringLiteral, value, offset);
 }
 
 /* ************************************************************************* */
 
 Token Tokenizer::tokenizeChar()
 {
-    String value;
-    SourceLocation location = m_current.location();
+    const auto offset = m_current.position();
 
     SHARD_ASSERT(is('\''));
     ++m_current;
 
+    const auto start = m_current;
+
     if (isEmpty())
-        throw TokenizerError("missing terminating ' character", location);
+    {
+        throw TokenizerError(
+            "missing terminating ' character", location(offset));
+    }
 
     if (*m_current == '\\')
     {
         ++m_current;
-        value.push_back(escape(*m_current, location));
+        checkEscape(m_current, offset);
     }
     else if (is('\''))
     {
-        throw TokenizerError("empty character constant", location);
-    }
-    else
-    {
-        value.push_back(*m_current);
+        throw TokenizerError("empty character constant", location(offset));
     }
 
     ++m_current;
 
     if (!is('\''))
-        throw TokenizerError("missing terminating ' character", location);
+    {
+        throw TokenizerError(
+            "missing terminating ' character", location(offset));
+    }
 
+    const auto value = text(start);
     ++m_current;
 
-    return Token(TokenType::CharLiteral, std::move(value), std::move(location));
+    return Token(TokenType::CharLiteral, value, offset);
 }
 
 /* ************************************************************************* */
 
 Token Tokenizer::tokenizeWhiteSpace()
 {
-    String value;
-    SourceLocation location = m_current.location();
+    const auto start  = m_current;
+    const auto offset = m_current.position();
 
     SHARD_ASSERT(isWhitespace());
 
-    while (isWhitespace())
-    {
-        value.push_back(*m_current);
-        ++m_current;
-    }
+    scan(scanWhitespace);
 
-    return Token(TokenType::WhiteSpace, std::move(value), std::move(location));
+    return Token(TokenType::WhiteSpace, text(start), offset);
 }
 
 /* ************************************************************************* */
 
 Token Tokenizer::tokenizeEndOfLine()
 {
-    String value;
-    SourceLocation location = m_current.location();
+    const auto start  = m_current;
+    const auto offset = m_current.position();
 
     SHARD_ASSERT(isEndOfLine());
-
-    value.push_back(*m_current);
+    match('\r');
     ++m_current;
 
-    return Token(TokenType::EndOfLine, std::move(value), std::move(location));
+    return Token(TokenType::EndOfLine, text(start), offset);
 }
 
 /* ************************************************************************* */
 
 Token Tokenizer::tokenizeOther()
 {
-    String value;
-    SourceLocation location = m_current.location();
+    const auto start  = m_current;
+    const auto offset = m_current.position();
 
     // Comment
-    if (match('/'))
+    if (is('/') && (next() == '/' || next() == '*'))
     {
+        ++m_current;
+
         if (match('/'))
         {
-            while (!is('\n') && !isEmpty())
-            {
-                value.push_back(*m_current);
-                ++m_current;
-            }
+            const auto begin = m_current;
+
+            scan(scanUntil, '\n');
+
+            auto value = text(begin);
+
+            // CR of CRLF is part of the new line
+            if (is('\n') && !value.empty() && value.back() == '\r')
+                value.remove_suffix(1);
 
             // Remove new line
             match('\n');
 
-            return Token(TokenType::Comment, std::move(value), std::move(location));
+            return Token(TokenType::Comment, value, offset);
         }
         else if (match('*'))
         {
-            while (!isEmpty())
+            const auto begin = m_current;
+
+            while (true)
             {
-                if (match('*'))
-                {
-                    if (match('/'))
-                        return Token(TokenType::Comment, std::move(value), std::move(location));
-                }
-                else
+                scan(scanUntil, '*');
+
+                if (isEmpty())
+                    break;
+
+                const auto end = m_current;
+                ++m_current;
+
+                if (match('/'))
                 {
-                    value.push_back(*m_current);
-                    ++m_current;
+                    return Token(
+                        TokenType::Comment,
+                        begin.source().view(
+                            begin.position(),
+                            end.position() - begin.position()),
+                        offset);
                 }
             }
 
-            if (isEmpty())
-                throw TokenizerError("unterminated /* comment", location);
+            throw TokenizerError(
+                "unterminated /* comment", location(offset));
         }
     }
-    else
+
+    // Longest operator
+    const auto found = matchOperator(m_current.source().view(
+        m_current.position(), m_end.position() - m_current.position()));
+
+    if (found.op == Operator::None)
     {
-        value.push_back(*m_current);
         ++m_current;
+        return Token(TokenType::Other, text(start), offset);
     }
 
-    return Token(TokenType::Other, std::move(value), std::move(location));
+    m_current = SourceIterator(m_current.source(), offset + found.length);
+
+    return Token(TokenType::Other, text(start), offset, found.op);
+}
+
+/* ************************************************************************* */
+
+void retokenize(
+    TokenBuffer& tokens,
+    Source& source,
+    std::uint32_t offset,
+    std::uint32_t length,
+    StringView text)
+{
+    SHARD_ASSERT(&tokens.source() == &source);
+
+    // Only the token overlapping edit start can start before it
+    auto first = tokens.lowerBound(offset);
+
+    if (first > 0 && tokens.end(first - 1) >= offset)
+        --first;
+
+    const std::uint32_t restart = first > 0 ? tokens.end(first - 1) : 0;
+
+    // Old tokens after the removed text are resynchronization candidates
+    auto last = tokens.lowerBound(offset + length);
+
+    const std::int64_t delta = std::int64_t(text.size()) - length;
+
+    // Removed text is kept to restore the source when tokenizing fails
+    const String removed(source.view(offset, length));
+
+    source.replace(offset, length, text);
+
+    // Tokens are scanned in a window ending shortly after the new text so the
+    // source is not moved past it. Token ending close to the window end may
+    // continue after it, such token is scanned again in a larger window.
+    std::size_t position = restart;
+    std::size_t window   = std::min(
+        source.size(), std::size_t(offset) + text.size() + Lookahead);
+
+    TokenBuffer result(source);
+    Tokenizer tokenizer(
+        SourceIterator(source, position), SourceIterator(source, window));
+
+    try
+    {
+        while (true)
+        {
+            const bool complete = window == source.size();
+            Optional<Token> token;
+
+            try
+            {
+                token = tokenizer.tokenize();
+            }
+            catch (const TokenizerError&)
+            {
+                if (complete)
+                    throw;
+            }
+
+            if (token)
+            {
+                const std::int64_t old = token->offset() - delta;
+
+                while (last < tokens.size() && tokens.offset(last) < old)
+                    ++last;
+
+                if (last < tokens.size() && tokens.offset(last) == old)
+                    break;
+            }
+
+            const bool finished =
+                token && tokenizer.position() + Lookahead <= window;
+
+            if (!complete && !finished)
+            {
+                window = std::min(
+                    source.size(),
+                    window + std::max(window - position, Lookahead));
+
+                tokenizer = Tokenizer(
+                    SourceIterator(source, position),
+                    SourceIterator(source, window));
+
+                continue;
+            }
+
+            // End of source, no following old token is valid
+            if (!token)
+            {
+                last = tokens.size();
+                break;
+            }
+
+            result.push(*token);
+            position = tokenizer.position();
+        }
+    }
+    catch (...)
+    {
+        source.replace(offset, text.size(), removed);
+        throw;
+    }
+
+    // Token values must not span the gap, it's moved to a token start
+    source.moveGap(position);
+
+    tokens.replace(first, last, result, delta);
 }
 
 /* ************************************************************************* */
@@ -0,0 +1,114 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// GTest
+#include "gtest/gtest.h"
+
+// C++
+#include <cstdint>
+
+// Shard
+#include "shard/Arena.hpp"
+
+/* ************************************************************************ */
+
+using namespace shard;
+
+/* ************************************************************************ */
+
+TEST(Arena, allocate)
+{
+    Arena arena(64);
+
+    EXPECT_EQ(arena.blockCount(), 0);
+
+    auto* a = static_cast<char*>(arena.allocate(1, 1));
+    auto* b = static_cast<char*>(arena.allocate(1, 1));
+
+    EXPECT_EQ(arena.blockCount(), 1);
+    EXPECT_EQ(a + 1, b);
+
+    auto* c = arena.allocate(8, 8);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(c) % 8, 0);
+    EXPECT_EQ(arena.blockCount(), 1);
+
+    // Doesn't fit into the current block
+    arena.allocate(60, 1);
+    EXPECT_EQ(arena.blockCount(), 2);
+}
+
+/* ************************************************************************ */
+
+TEST(Arena, oversized)
+{
+    Arena arena(64);
+
+    auto* a = static_cast<char*>(arena.allocate(1, 1));
+    arena.allocate(1000, 1);
+
+    EXPECT_EQ(arena.blockCount(), 2);
+
+    // Current block is kept
+    auto* b = static_cast<char*>(arena.allocate(1, 1));
+    EXPECT_EQ(arena.blockCount(), 2);
+    EXPECT_EQ(a + 1, b);
+}
+
+/* ************************************************************************ */
+
+TEST(Arena, create)
+{
+    struct Pair
+    {
+        int first;
+        double second;
+    };
+
+    Arena arena;
+
+    Pair* pair = arena.create<Pair>(Pair{1, 2.5});
+    ASSERT_NE(pair, nullptr);
+    EXPECT_EQ(pair->first, 1);
+    EXPECT_EQ(pair->second, 2.5);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(pair) % alignof(Pair), 0);
+}
+
+/* ************************************************************************ */
+
+TEST(Arena, move)
+{
+    Arena arena(256);
+    int* value = arena.create<int>(5);
+
+    Arena other(std::move(arena));
+    EXPECT_EQ(other.blockCount(), 1);
+    EXPECT_EQ(*value, 5);
+
+    // Moved-from arena doesn't use blocks it no longer owns
+    EXPECT_EQ(arena.blockCount(), 0);
+    EXPECT_NE(arena.create<int>(1), value + 1);
+    EXPECT_EQ(arena.blockCount(), 1);
+
+    Arena third;
+    third = std::move(other);
+    EXPECT_EQ(third.blockCount(), 1);
+    EXPECT_EQ(other.blockCount(), 0);
+
+    other.create<int>(2);
+    EXPECT_EQ(other.blockCount(), 1);
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,161 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// GTest
+#include "gtest/gtest.h"
+
+// Shard
+#include "shard/String.hpp"
+#include "shard/LineTable.hpp"
+
+/* ************************************************************************ */
+
+using namespace shard;
+
+/* ************************************************************************ */
+
+TEST(LineTable, empty)
+{
+    LineTable lines;
+
+    EXPECT_EQ(lines.size(), 1);
+    EXPECT_EQ(lines.location(0), (SourceLocation{1, 1}));
+}
+
+/* ************************************************************************ */
+
+TEST(LineTable, location)
+{
+    LineTable lines("ab\ncde\n\nf");
+
+    ASSERT_EQ(lines.size(), 4);
+    EXPECT_EQ(lines.lineStart(0), 0);
+    EXPECT_EQ(lines.lineStart(1), 3);
+    EXPECT_EQ(lines.lineStart(2), 7);
+    EXPECT_EQ(lines.lineStart(3), 8);
+
+    EXPECT_EQ(lines.location(0), (SourceLocation{1, 1}));
+    EXPECT_EQ(lines.location(2), (SourceLocation{1, 3}));
+    EXPECT_EQ(lines.location(3), (SourceLocation{2, 1}));
+    EXPECT_EQ(lines.location(6), (SourceLocation{2, 4}));
+    EXPECT_EQ(lines.location(7), (SourceLocation{3, 1}));
+    EXPECT_EQ(lines.location(8), (SourceLocation{4, 1}));
+    EXPECT_EQ(lines.location(9), (SourceLocation{4, 2}));
+}
+
+/* ************************************************************************ */
+
+TEST(LineTable, append)
+{
+    LineTable lines("ab\nc");
+    lines.append("d\ne\n", 4);
+
+    ASSERT_EQ(lines.size(), 4);
+    EXPECT_EQ(lines.location(4), (SourceLocation{2, 2}));
+    EXPECT_EQ(lines.location(6), (SourceLocation{3, 1}));
+    EXPECT_EQ(lines.location(8), (SourceLocation{4, 1}));
+}
+
+/* ************************************************************************ */
+
+TEST(LineTable, replace)
+{
+    LineTable lines("ab\ncd\nef\ngh");
+
+    // "b\ncd\nef" -> "X\nY\nZ\nW"
+    lines.replace(1, 7, "X\nY\nZ\nW");
+
+    ASSERT_EQ(lines.size(), 5);
+    EXPECT_EQ(lines.lineStart(1), 3);
+    EXPECT_EQ(lines.lineStart(2), 5);
+    EXPECT_EQ(lines.lineStart(3), 7);
+    EXPECT_EQ(lines.lineStart(4), 9);
+
+    // Remove new lines
+    lines.replace(2, 6, "");
+
+    ASSERT_EQ(lines.size(), 2);
+    EXPECT_EQ(lines.lineStart(1), 3);
+}
+
+/* ************************************************************************ */
+
+TEST(LineTable, replaceMany)
+{
+    String text = "a\nb\nc\nd\ne\nf\ng\nh\n";
+    LineTable lines(text);
+
+    struct Edit
+    {
+        std::uint32_t offset;
+        std::uint32_t length;
+        const char* text;
+    };
+
+    // Edits move back and forth
+    const Edit edits[] = {
+        {8, 1, "x\ny\n"},
+        {2, 2, ""},
+        {14, 0, "\n\n"},
+        {0, 1, "z\n"},
+        {12, 3, "w"},
+    };
+
+    for (const auto& edit : edits)
+    {
+        text.replace(edit.offset, edit.length, edit.text);
+        lines.replace(edit.offset, edit.length, edit.text);
+
+        const LineTable expected(text);
+
+        SCOPED_TRACE(text);
+        ASSERT_EQ(lines.size(), expected.size());
+
+        for (std::size_t i = 0; i < lines.size(); ++i)
+            EXPECT_EQ(lines.lineStart(i), expected.lineStart(i));
+
+        for (std::uint32_t i = 0; i < text.size(); ++i)
+            EXPECT_EQ(lines.location(i), expected.location(i));
+    }
+}
+
+/* ************************************************************************ */
+
+TEST(LineTable, large)
+{
+    // Large enough to be split between threads
+    String text;
+
+    for (std::size_t i = 0; text.size() < 20 * 1024 * 1024; ++i)
+        text.append(i % 7, 'x').push_back('\n');
+
+    LineTable lines(text);
+
+    std::size_t line = 0;
+    ASSERT_EQ(lines.lineStart(line++), 0);
+
+    for (std::size_t i = 0; i < text.size(); ++i)
+    {
+        if (text[i] == '\n')
+        {
+            ASSERT_EQ(lines.lineStart(line++), i + 1);
+        }
+    }
+
+    EXPECT_EQ(lines.size(), line);
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,94 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// GTest
+#include "gtest/gtest.h"
+
+// C++
+#include <string>
+#include <utility>
+
+// Shard
+#include "shard/SymbolMap.hpp"
+
+/* ************************************************************************ */
+
+using namespace shard;
+
+/* ************************************************************************ */
+
+TEST(SymbolMap, empty)
+{
+    const SymbolMap<int> map;
+
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.size(), 0);
+    EXPECT_EQ(map.find("symbol_map_a"), nullptr);
+}
+
+/* ************************************************************************ */
+
+TEST(SymbolMap, insert)
+{
+    SymbolMap<int> map;
+
+    auto [value, inserted] = map.insert("symbol_map_a", 1);
+    ASSERT_TRUE(inserted);
+    EXPECT_EQ(*value, 1);
+
+    // Existing value is kept
+    std::tie(value, inserted) = map.insert("symbol_map_a", 2);
+    EXPECT_FALSE(inserted);
+    EXPECT_EQ(*value, 1);
+
+    map.insert("symbol_map_b", 3);
+
+    EXPECT_EQ(map.size(), 2);
+    ASSERT_NE(map.find("symbol_map_b"), nullptr);
+    EXPECT_EQ(*map.find("symbol_map_b"), 3);
+    EXPECT_EQ(map.find("symbol_map_c"), nullptr);
+
+    // Empty symbol doesn't match free slots
+    EXPECT_EQ(map.find(Symbol{}), nullptr);
+    EXPECT_EQ(std::as_const(map).find(Symbol{}), nullptr);
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.find("symbol_map_a"), nullptr);
+}
+
+/* ************************************************************************ */
+
+TEST(SymbolMap, rehash)
+{
+    constexpr int COUNT = 1000;
+
+    SymbolMap<int> map;
+
+    for (int i = 0; i < COUNT; ++i)
+        map.insert("symbol_map_" + std::to_string(i), i);
+
+    ASSERT_EQ(map.size(), COUNT);
+
+    for (int i = 0; i < COUNT; ++i)
+    {
+        auto value = map.find("symbol_map_" + std::to_string(i));
+        ASSERT_NE(value, nullptr);
+        EXPECT_EQ(*value, i);
+    }
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,102 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// GTest
+#include "gtest/gtest.h"
+
+// C++
+#include <sstream>
+#include <string>
+#include <thread>
+
+// Shard
+#include "shard/String.hpp"
+#include "shard/Symbol.hpp"
+#include "shard/Vector.hpp"
+
+/* ************************************************************************ */
+
+using namespace shard;
+
+/* ************************************************************************ */
+
+TEST(Symbol, empty)
+{
+    Symbol symbol;
+
+    EXPECT_TRUE(symbol.empty());
+    EXPECT_EQ(symbol.id(), 0);
+    EXPECT_EQ(symbol.str(), "");
+    EXPECT_EQ(symbol, Symbol(""));
+}
+
+/* ************************************************************************ */
+
+TEST(Symbol, intern)
+{
+    const Symbol a("symbol_test_a");
+    const Symbol b(String("symbol_test_b"));
+    const Symbol c(StringView("symbol_test_a_long").substr(0, 13));
+
+    EXPECT_FALSE(a.empty());
+    EXPECT_NE(a.id(), 0);
+    EXPECT_NE(a, b);
+    EXPECT_NE(a.id(), b.id());
+    EXPECT_EQ(a, c);
+    EXPECT_EQ(a.id(), c.id());
+    EXPECT_EQ(&a.str(), &c.str());
+    EXPECT_LE(a.id(), Symbol::count());
+
+    EXPECT_EQ(a, "symbol_test_a");
+    EXPECT_EQ("symbol_test_a", a);
+    EXPECT_EQ(a, String("symbol_test_a"));
+    EXPECT_NE(a, "symbol_test_b");
+
+    std::ostringstream os;
+    os << b;
+    EXPECT_EQ(os.str(), "symbol_test_b");
+}
+
+/* ************************************************************************ */
+
+TEST(Symbol, threads)
+{
+    constexpr int COUNT = 1000;
+
+    Vector<Vector<Symbol>> symbols(4);
+    Vector<std::thread> threads;
+
+    for (auto& result : symbols)
+    {
+        threads.emplace_back([&result] {
+            for (int i = 0; i < COUNT; ++i)
+                result.push_back(Symbol("symbol_thread_" + std::to_string(i)));
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    for (int i = 0; i < COUNT; ++i)
+    {
+        EXPECT_EQ(symbols[0][i], "symbol_thread_" + std::to_string(i));
+
+        for (const auto& result : symbols)
+            EXPECT_EQ(result[i], symbols[0][i]);
+    }
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,80 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// GTest
+#include "gtest/gtest.h"
+
+// C++
+#include <atomic>
+#include <cstddef>
+
+// Shard
+#include "shard/ThreadPool.hpp"
+#include "shard/Vector.hpp"
+
+/* ************************************************************************ */
+
+using namespace shard;
+
+/* ************************************************************************ */
+
+TEST(ThreadPool, size)
+{
+    EXPECT_EQ(ThreadPool(3).size(), 3);
+    EXPECT_GE(ThreadPool().size(), 1);
+}
+
+/* ************************************************************************ */
+
+TEST(ThreadPool, parallelFor)
+{
+    ThreadPool pool(4);
+
+    // Workers are reused by following batches
+    for (std::size_t count : {0, 1, 2, 100, 1000})
+    {
+        Vector<int> hits(count);
+        Vector<std::size_t> workers(count);
+
+        pool.parallelFor(count, [&](unsigned worker, std::size_t i) {
+            ++hits[i];
+            workers[i] = worker;
+        });
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            EXPECT_EQ(hits[i], 1);
+            EXPECT_LT(workers[i], pool.size());
+        }
+    }
+}
+
+/* ************************************************************************ */
+
+TEST(ThreadPool, single)
+{
+    ThreadPool pool(1);
+    std::atomic<std::size_t> sum{0};
+
+    pool.parallelFor(10, [&](unsigned worker, std::size_t i) {
+        EXPECT_EQ(worker, 0);
+        sum += i;
+    });
+
+    EXPECT_EQ(sum, 45);
+}
+
+/* ************************************************************************ */
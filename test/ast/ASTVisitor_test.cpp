@@ -0,0 +1,140 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// GTest
+#include "gtest/gtest.h"
+
+// Shard
+#include "shard/ast/ASTVisitor.hpp"
+
+/* ************************************************************************ */
+
+using namespace shard;
+using namespace shard::ast;
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+/// Evaluates integer expressions.
+struct Evaluator : public ConstASTVisitor<Evaluator, int>
+{
+    int visitIntLiteralExpr(const IntLiteralExpr& expr)
+    {
+        return expr.value();
+    }
+
+    int visitParenExpr(const ParenExpr& expr)
+    {
+        return visit(*expr.expr());
+    }
+
+    int visitBinaryExpr(const BinaryExpr& expr)
+    {
+        const int lhs = visit(*expr.lhs());
+        const int rhs = visit(*expr.rhs());
+
+        return expr.op() == "+" ? lhs + rhs : lhs * rhs;
+    }
+
+    int visitExpr(const Expr&)
+    {
+        return -1;
+    }
+};
+
+/* ************************************************************************ */
+
+/// Names node categories.
+struct Categories : public ConstASTVisitor<Categories, String>
+{
+    String visitUnaryExpr(const UnaryExpr&)
+    {
+        return "unary";
+    }
+
+    String visitExpr(const Expr&)
+    {
+        return "expr";
+    }
+
+    String visitCompoundDecl(const CompoundDecl&)
+    {
+        return "compound";
+    }
+
+    String visitStmt(const Stmt&)
+    {
+        return "stmt";
+    }
+};
+
+/* ************************************************************************ */
+
+} // namespace
+
+/* ************************************************************************ */
+
+TEST(ASTVisitor, result)
+{
+    // (1 + 2) * 4
+    auto sum = BinaryExpr::make(
+        "+", IntLiteralExpr::make(1), IntLiteralExpr::make(2));
+    const auto expr = BinaryExpr::make(
+        "*", ParenExpr::make(std::move(sum)), IntLiteralExpr::make(4));
+
+    Evaluator evaluator;
+    EXPECT_EQ(evaluator.visit(*expr), 12);
+    EXPECT_EQ(evaluator.visit(BoolLiteralExpr(true)), -1);
+}
+
+/* ************************************************************************ */
+
+TEST(ASTVisitor, fallback)
+{
+    Categories categories;
+
+    EXPECT_EQ(categories.visit(PrefixUnaryExpr("-", IntLiteralExpr::make(1))),
+        "unary");
+    EXPECT_EQ(categories.visit(NullLiteralExpr()), "expr");
+    EXPECT_EQ(categories.visit(ClassDecl("A")), "compound");
+    EXPECT_EQ(categories.visit(BreakStmt()), "stmt");
+
+    // Default result
+    EXPECT_EQ(categories.visit(VariableDecl("int", "a")), "");
+}
+
+/* ************************************************************************ */
+
+TEST(ASTVisitor, mutable)
+{
+    struct Negate : public ASTVisitor<Negate>
+    {
+        void visitIntLiteralExpr(IntLiteralExpr& expr)
+        {
+            expr.setValue(-expr.value());
+        }
+    };
+
+    IntLiteralExpr expr(5);
+    Negate().visit(expr);
+
+    EXPECT_EQ(expr.value(), -5);
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,142 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// GTest
+#include "gtest/gtest.h"
+
+// Shard
+#include "shard/ast/AnalysisContext.hpp"
+#include "shard/ast/decl/FunctionDecl.hpp"
+#include "shard/ast/decl/VariableDecl.hpp"
+
+/* ************************************************************************ */
+
+using namespace shard;
+using namespace shard::ast;
+
+/* ************************************************************************ */
+
+TEST(AnalysisContext, find)
+{
+    AnalysisContext context;
+    VariableDecl foo("int", "foo");
+    VariableDecl bar("float", "bar");
+
+    EXPECT_EQ(context.depth(), 0);
+    EXPECT_EQ(context.findDecl("foo"), nullptr);
+
+    context.addDecl(&foo);
+    context.addDecl(&bar);
+
+    EXPECT_EQ(context.findDecl("foo"), &foo);
+    EXPECT_EQ(context.findDecl("bar"), &bar);
+    EXPECT_EQ(context.findDecl("baz"), nullptr);
+}
+
+/* ************************************************************************ */
+
+TEST(AnalysisContext, scope)
+{
+    AnalysisContext context;
+    VariableDecl foo("int", "foo");
+    VariableDecl bar("float", "bar");
+
+    context.addDecl(&foo);
+
+    {
+        auto scope = context.push();
+        EXPECT_EQ(context.depth(), 1);
+
+        context.addDecl(&bar);
+        EXPECT_EQ(context.findDecl("foo"), &foo);
+        EXPECT_EQ(context.findDecl("bar"), &bar);
+    }
+
+    EXPECT_EQ(context.depth(), 0);
+    EXPECT_EQ(context.findDecl("foo"), &foo);
+    EXPECT_EQ(context.findDecl("bar"), nullptr);
+}
+
+/* ************************************************************************ */
+
+TEST(AnalysisContext, shadow)
+{
+    AnalysisContext context;
+    VariableDecl outer("int", "foo");
+    VariableDecl middle("float", "foo");
+    VariableDecl inner("char", "foo");
+
+    context.addDecl(&outer);
+    context.enterScope();
+    context.addDecl(&middle);
+    context.enterScope();
+    context.addDecl(&inner);
+
+    EXPECT_EQ(context.depth(), 2);
+    EXPECT_EQ(context.findDecl("foo"), &inner);
+
+    context.leaveScope();
+    EXPECT_EQ(context.findDecl("foo"), &middle);
+
+    context.leaveScope();
+    EXPECT_EQ(context.findDecl("foo"), &outer);
+    EXPECT_EQ(context.depth(), 0);
+}
+
+/* ************************************************************************ */
+
+TEST(AnalysisContext, globals)
+{
+    AnalysisContext globals;
+    VariableDecl foo("int", "foo");
+    VariableDecl bar("float", "bar");
+    VariableDecl local("char", "foo");
+
+    globals.addDecl(&foo);
+    globals.addDecl(&bar);
+
+    AnalysisContext context(&globals);
+    EXPECT_EQ(context.globals(), &globals);
+    EXPECT_EQ(context.findDecl("foo"), &foo);
+
+    {
+        auto scope = context.push();
+        context.addDecl(&local);
+
+        // Locals shadow globals
+        EXPECT_EQ(context.findDecl("foo"), &local);
+        EXPECT_EQ(context.findDecl("bar"), &bar);
+    }
+
+    EXPECT_EQ(context.findDecl("foo"), &foo);
+    EXPECT_EQ(globals.findDecl("foo"), &foo);
+    EXPECT_EQ(context.findDecl("baz"), nullptr);
+}
+
+/* ************************************************************************ */
+
+TEST(AnalysisContext, builtins)
+{
+    const auto& builtins = AnalysisContext::builtins();
+    ASSERT_NE(builtins.findDecl("print"), nullptr);
+    EXPECT_TRUE(builtins.findDecl("print")->is<FunctionDecl>());
+    EXPECT_EQ(builtins.findDecl("foo"), nullptr);
+
+    AnalysisContext globals(&builtins);
+    EXPECT_EQ(globals.findDecl("print"), builtins.findDecl("print"));
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,151 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// GTest
+#include "gtest/gtest.h"
+
+// Shard
+#include "shard/ast/Context.hpp"
+#include "shard/ast/Source.hpp"
+#include "shard/ast/expr/IntLiteralExpr.hpp"
+#include "shard/ast/stmt/ExprStmt.hpp"
+
+/* ************************************************************************ */
+
+using namespace shard;
+using namespace shard::ast;
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+struct CountedExpr : public Expr
+{
+    static constexpr NodeKind typeKind = NodeKind::IdentifierExpr;
+
+    explicit CountedExpr(int& counter) noexcept
+        : Expr(typeKind, SourceRange{})
+        , m_counter(counter)
+    {
+        // Nothing
+    }
+
+    ~CountedExpr()
+    {
+        ++m_counter;
+    }
+
+    int& m_counter;
+};
+
+/* ************************************************************************ */
+
+} // namespace
+
+/* ************************************************************************ */
+
+TEST(Context, make)
+{
+    Context context;
+
+    auto expr = context.make<IntLiteralExpr>(5);
+    ASSERT_NE(expr, nullptr);
+    EXPECT_TRUE(expr->isArenaAllocated());
+    EXPECT_EQ(expr->value(), 5);
+    EXPECT_EQ(context.size(), 1);
+    EXPECT_GE(context.arena().blockCount(), 1);
+
+    auto stmt = context.make<ExprStmt>(std::move(expr));
+    EXPECT_TRUE(stmt->isArenaAllocated());
+    EXPECT_EQ(context.size(), 2);
+
+    // Heap nodes are not affected
+    auto heap = IntLiteralExpr::make(1);
+    EXPECT_FALSE(heap->isArenaAllocated());
+
+    // Ownership is known without the node
+    ExprPtr owned = std::move(heap);
+    EXPECT_TRUE(stmt.get_deleter().isArena());
+    EXPECT_FALSE(owned.get_deleter().isArena());
+
+    ExprPtr base = context.make<IntLiteralExpr>(2);
+    EXPECT_TRUE(base.get_deleter().isArena());
+}
+
+/* ************************************************************************ */
+
+TEST(Context, destroy)
+{
+    int counter = 0;
+
+    {
+        Context context;
+
+        {
+            // Pointer doesn't destroy arena node
+            auto expr = context.make<CountedExpr>(counter);
+        }
+
+        EXPECT_EQ(counter, 0);
+
+        context.make<CountedExpr>(counter);
+        context.make<CountedExpr>(counter);
+    }
+
+    EXPECT_EQ(counter, 3);
+}
+
+/* ************************************************************************ */
+
+TEST(Context, order)
+{
+    int counter = 0;
+
+    {
+        Context context;
+
+        // Child created after its parent is destroyed before it
+        auto stmt = context.make<ExprStmt>(context.make<CountedExpr>(counter));
+        stmt->setExpr(context.make<CountedExpr>(counter));
+
+        // Heap child of arena parent is deleted with the parent
+        auto heap = context.make<ExprStmt>(makeUnique<CountedExpr>(counter));
+        EXPECT_EQ(counter, 0);
+    }
+
+    EXPECT_EQ(counter, 3);
+}
+
+/* ************************************************************************ */
+
+TEST(Context, source)
+{
+    auto context = makeUnique<Context>();
+
+    StmtPtrVector stmts;
+    stmts.push_back(context->make<ExprStmt>(context->make<IntLiteralExpr>(1)));
+    stmts.push_back(context->make<ExprStmt>(context->make<IntLiteralExpr>(2)));
+
+    Source source(std::move(stmts), std::move(context));
+
+    ASSERT_EQ(source.stmts().size(), 2);
+    EXPECT_TRUE(source.stmts()[0]->isArenaAllocated());
+    EXPECT_TRUE(source.stmts()[1]->is<ExprStmt>());
+}
+
+/* ************************************************************************ */
@@ -34,15 +34,17 @@ namespace {
 
 struct TestExpr : public Expr, public PtrBuilder<TestExpr>
 {
+    static constexpr NodeKind typeKind = NodeKind::IdentifierExpr;
+
     explicit TestExpr(SourceRange range = {}) noexcept
-        : Expr(range) {}
+        : Expr(typeKind, range) {}
 };
 
 /* ************************************************************************ */
 
 struct TestExpr2 : public Expr
 {
-
+    static constexpr NodeKind typeKind = NodeKind::ParenExpr;
 };
 
 /* ************************************************************************ */
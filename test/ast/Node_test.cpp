@@ -17,8 +17,13 @@
 // GTest
 #include "gtest/gtest.h"
 
+// C++
+#include <string>
+#include <type_traits>
+
 // Shard
 #include "shard/ast/Node.hpp"
+#include "shard/ast/visit.hpp"
 
 /* ************************************************************************ */
 
@@ -34,7 +39,7 @@ namespace {
 struct TestNode : public Node
 {
     constexpr TestNode(SourceRange range) noexcept
-        : Node(range) {}
+        : Node(NodeKind::NullLiteralExpr, range) {}
 };
 
 /* ************************************************************************ */
@@ -45,10 +50,88 @@ struct TestNode : public Node
 
 TEST(Node, basic)
 {
-    TestNode node{{SourceLocation{0, 0}, SourceLocation{10, 0}}};
+    TestNode node{{0, 10}};
+
+    EXPECT_EQ(node.sourceRange().start(), 0);
+    EXPECT_EQ(node.sourceRange().end(), 10);
+}
+
+/* ************************************************************************ */
+TEST(Node, is)
+{
+    const IntLiteralExpr expr(1);
+    const BreakStmt stmt;
+    const ClassDecl decl("A");
+    const PrefixUnaryExpr unary("-", IntLiteralExpr::make(1));
+
+    EXPECT_EQ(expr.kind(), NodeKind::IntLiteralExpr);
+    EXPECT_TRUE(expr.is<Node>());
+    EXPECT_TRUE(expr.is<Expr>());
+    EXPECT_TRUE(expr.is<IntLiteralExpr>());
+    EXPECT_FALSE(expr.is<BoolLiteralExpr>());
+    EXPECT_FALSE(expr.is<UnaryExpr>());
+    EXPECT_FALSE(expr.is<Stmt>());
+    EXPECT_FALSE(expr.is<Decl>());
+
+    EXPECT_TRUE(stmt.is<Node>());
+    EXPECT_TRUE(stmt.is<Stmt>());
+    EXPECT_TRUE(stmt.is<BreakStmt>());
+    EXPECT_FALSE(stmt.is<Expr>());
+    EXPECT_FALSE(stmt.is<Decl>());
+
+    EXPECT_TRUE(decl.is<Node>());
+    EXPECT_TRUE(decl.is<Decl>());
+    EXPECT_TRUE(decl.is<CompoundDecl>());
+    EXPECT_TRUE(decl.is<ClassDecl>());
+    EXPECT_FALSE(decl.is<NamespaceDecl>());
+    EXPECT_FALSE(decl.is<Stmt>());
+
+    EXPECT_TRUE(unary.is<Expr>());
+    EXPECT_TRUE(unary.is<UnaryExpr>());
+    EXPECT_TRUE(unary.is<PrefixUnaryExpr>());
+    EXPECT_FALSE(unary.is<PostfixUnaryExpr>());
+}
+
+/* ************************************************************************ */
+
+TEST(Node, visit)
+{
+    struct Visitor
+    {
+        String operator()(const IntLiteralExpr& expr) const
+        {
+            return "int " + std::to_string(expr.value());
+        }
+
+        String operator()(const ReturnStmt&) const
+        {
+            return "return";
+        }
+
+        String operator()(const Node&) const
+        {
+            return "other";
+        }
+    };
 
-    EXPECT_EQ(node.sourceRange().start(), (SourceLocation{0, 0}));
-    EXPECT_EQ(node.sourceRange().end(), (SourceLocation{10, 0}));
+    const IntLiteralExpr expr(5);
+    const ReturnStmt stmt;
+    const VariableDecl decl("int", "a");
+
+    EXPECT_EQ(visit(static_cast<const Node&>(expr), Visitor{}), "int 5");
+    EXPECT_EQ(visit(static_cast<const Node&>(stmt), Visitor{}), "return");
+    EXPECT_EQ(visit(static_cast<const Node&>(decl), Visitor{}), "other");
+
+    // Mutable nodes
+    IntLiteralExpr value(1);
+    visit(static_cast<Node&>(value), [](auto& node) {
+        using Type = std::decay_t<decltype(node)>;
+
+        if constexpr (std::is_same_v<Type, IntLiteralExpr>)
+            node.setValue(2);
+    });
+
+    EXPECT_EQ(value.value(), 2);
 }
 
-/* ************************************************************************ */
\ No newline at end of file
+/* ************************************************************************ */
@@ -0,0 +1,179 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// GTest
+#include "gtest/gtest.h"
+
+// Shard
+#include "shard/ast/RecursiveASTVisitor.hpp"
+#include "shard/ast/Source.hpp"
+
+/* ************************************************************************ */
+
+using namespace shard;
+using namespace shard::ast;
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+/// Records kinds of visited nodes.
+template<bool PostOrder>
+struct Recorder : public ConstRecursiveASTVisitor<Recorder<PostOrder>>
+{
+    bool shouldTraversePostOrder() const noexcept
+    {
+        return PostOrder;
+    }
+
+    bool visitNode(const Node& node)
+    {
+        kinds.push_back(node.kind());
+        return true;
+    }
+
+    Vector<NodeKind> kinds;
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief      Creates `if (a) return 1 + 2;`.
+ */
+StmtPtr makeTree()
+{
+    return IfStmt::make(
+        IdentifierExpr::make("a"),
+        ReturnStmt::make(BinaryExpr::make(
+            "+", IntLiteralExpr::make(1), IntLiteralExpr::make(2))),
+        nullptr);
+}
+
+/* ************************************************************************ */
+
+} // namespace
+
+/* ************************************************************************ */
+
+TEST(RecursiveASTVisitor, preOrder)
+{
+    const auto tree = makeTree();
+
+    Recorder<false> recorder;
+    EXPECT_TRUE(recorder.traverse(*tree));
+
+    const Vector<NodeKind> expected{
+        NodeKind::IfStmt,
+        NodeKind::IdentifierExpr,
+        NodeKind::ReturnStmt,
+        NodeKind::BinaryExpr,
+        NodeKind::IntLiteralExpr,
+        NodeKind::IntLiteralExpr,
+    };
+
+    EXPECT_EQ(recorder.kinds, expected);
+}
+
+/* ************************************************************************ */
+
+TEST(RecursiveASTVisitor, postOrder)
+{
+    const auto tree = makeTree();
+
+    Recorder<true> recorder;
+    EXPECT_TRUE(recorder.traverse(*tree));
+
+    const Vector<NodeKind> expected{
+        NodeKind::IdentifierExpr,
+        NodeKind::IntLiteralExpr,
+        NodeKind::IntLiteralExpr,
+        NodeKind::BinaryExpr,
+        NodeKind::ReturnStmt,
+        NodeKind::IfStmt,
+    };
+
+    EXPECT_EQ(recorder.kinds, expected);
+}
+
+/* ************************************************************************ */
+
+TEST(RecursiveASTVisitor, earlyExit)
+{
+    struct FindReturn : public ConstRecursiveASTVisitor<FindReturn>
+    {
+        bool visitReturnStmt(const ReturnStmt&)
+        {
+            found = true;
+            return false;
+        }
+
+        bool visitExpr(const Expr&)
+        {
+            ++exprs;
+            return true;
+        }
+
+        bool found = false;
+        int exprs  = 0;
+    };
+
+    const auto tree = makeTree();
+
+    FindReturn visitor;
+    EXPECT_FALSE(visitor.traverse(*tree));
+    EXPECT_TRUE(visitor.found);
+
+    // Only condition was visited
+    EXPECT_EQ(visitor.exprs, 1);
+}
+
+/* ************************************************************************ */
+
+TEST(RecursiveASTVisitor, skipChildren)
+{
+    struct Counter : public RecursiveASTVisitor<Counter>
+    {
+        bool traverseBinaryExpr(BinaryExpr& expr)
+        {
+            return visitBinaryExpr(expr);
+        }
+
+        bool visitIntLiteralExpr(IntLiteralExpr& expr)
+        {
+            expr.setValue(0);
+            ++literals;
+            return true;
+        }
+
+        int literals = 0;
+    };
+
+    StmtPtrVector stmts;
+    stmts.push_back(ExprStmt::make(IntLiteralExpr::make(1)));
+    stmts.push_back(makeTree());
+
+    Source source(std::move(stmts));
+
+    Counter counter;
+    EXPECT_TRUE(counter.traverse(source.stmts()));
+    EXPECT_EQ(counter.literals, 1);
+    const auto& stmt = source.stmts()[0]->cast<ExprStmt>();
+    EXPECT_EQ(stmt.expr<IntLiteralExpr>().value(), 0);
+}
+
+/* ************************************************************************ */
@@ -19,6 +19,10 @@
 
 // Shard
 #include "shard/ast/Source.hpp"
+#include "shard/ast/Decls.hpp"
+#include "shard/ast/Exprs.hpp"
+#include "shard/ast/Stmts.hpp"
+#include "shard/ast/exceptions.hpp"
 #include "shard/ast/utility.hpp"
 
 /* ************************************************************************ */
@@ -34,8 +38,10 @@ namespace {
 
 struct TestStmt : public Stmt, public PtrBuilder<TestStmt>
 {
+    static constexpr NodeKind typeKind = NodeKind::ExprStmt;
+
     TestStmt(SourceRange range = {}) noexcept
-        : Stmt(range)
+        : Stmt(typeKind, range)
     {
         // Nothing
     }
@@ -45,8 +51,10 @@ struct TestStmt : public Stmt, public PtrBuilder<TestStmt>
 
 struct TestStmt2 : public Stmt, public PtrBuilder<TestStmt2>
 {
+    static constexpr NodeKind typeKind = NodeKind::IfStmt;
+
     TestStmt2(SourceRange range = {}) noexcept
-        : Stmt(range)
+        : Stmt(typeKind, range)
     {
         // Nothing
     }
@@ -54,6 +62,57 @@ struct TestStmt2 : public Stmt, public PtrBuilder<TestStmt2>
 
 /* ************************************************************************ */
 
+StmtPtr function(Symbol name, Symbol callee, std::uint32_t offset = 0)
+{
+    StmtPtrVector body;
+    body.push_back(makeUnique<ReturnStmt>(makeUnique<FunctionCallExpr>(
+        makeUnique<IdentifierExpr>(callee, SourceRange{offset, offset}))));
+
+    return makeUnique<DeclStmt>(makeUnique<FunctionDecl>(
+        "int",
+        name,
+        makeUnique<CompoundStmt>(std::move(body)),
+        Vector<VariableDeclPtr>{},
+        SourceRange{offset, offset}));
+}
+
+/* ************************************************************************ */
+
+StmtPtr variable(Symbol name, std::uint32_t offset = 0)
+{
+    return makeUnique<DeclStmt>(makeUnique<VariableDecl>(
+        "var", name, nullptr, SourceRange{offset, offset}));
+}
+
+/* ************************************************************************ */
+
+StmtPtr assign(Symbol name, std::uint32_t offset = 0)
+{
+    return makeUnique<ExprStmt>(makeUnique<BinaryExpr>(
+        "=",
+        makeUnique<IdentifierExpr>(name, SourceRange{offset, offset}),
+        makeUnique<IntLiteralExpr>(1)));
+}
+
+/* ************************************************************************ */
+
+const IdentifierExpr& callee(const Source& source, std::size_t pos)
+{
+    const auto& decl = source.stmts()[pos]
+                           ->cast<DeclStmt>()
+                           .decl()
+                           ->cast<FunctionDecl>();
+
+    const auto& ret = decl.bodyStmt()->stmts()[0]->cast<ReturnStmt>();
+
+    return ret.resExpr()
+        ->cast<FunctionCallExpr>()
+        .expr()
+        ->cast<IdentifierExpr>();
+}
+
+/* ************************************************************************ */
+
 } // namespace
 
 /* ************************************************************************ */
@@ -85,4 +144,130 @@ TEST(Source, basic)
     EXPECT_TRUE(source.stmts()[0]->is<TestStmt>());
 }
 
-/* ************************************************************************ */
\ No newline at end of file
+/* ************************************************************************ */
+TEST(Source, analyse)
+{
+    constexpr std::size_t count = 64;
+
+    for (unsigned threads : {1u, 4u})
+    {
+        Source source;
+
+        // Each function calls the next one, declared later
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            source.addStmt(function(
+                "f" + toString(i), "f" + toString((i + 1) % count)));
+        }
+
+        source.analyse(threads);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const auto& next = source.stmts()[(i + 1) % count]
+                                   ->cast<DeclStmt>()
+                                   .decl();
+
+            EXPECT_EQ(callee(source, i).decl(), next.get());
+        }
+    }
+}
+
+/* ************************************************************************ */
+
+TEST(Source, analyseError)
+{
+    {
+        Source source;
+        source.addStmt(function("foo", "foo", 0));
+        source.addStmt(function("bar", "foo", 10));
+        source.addStmt(function("foo", "bar", 20));
+
+        try
+        {
+            source.analyse(4);
+            FAIL();
+        }
+        catch (const SemanticError& err)
+        {
+            EXPECT_EQ(err.offset(), 20);
+            EXPECT_STREQ(err.what(), "redefinition of 'foo'");
+        }
+    }
+
+    {
+        Source source;
+        source.addStmt(function("foo", "foo", 0));
+        source.addStmt(function("bar", "baz", 10));
+        source.addStmt(function("baz", "qux", 20));
+        source.addStmt(function("qux", "none", 30));
+
+        try
+        {
+            source.analyse(4);
+            FAIL();
+        }
+        catch (const SemanticError& err)
+        {
+            // First error in statement order
+            EXPECT_EQ(err.offset(), 30);
+            EXPECT_STREQ(err.what(), "Symbol 'none' not found");
+        }
+    }
+}
+
+/* ************************************************************************ */
+
+TEST(Source, analyseGlobals)
+{
+    {
+        Source source;
+        source.addStmt(function("f", "x"));
+        source.addStmt(variable("x", 10));
+        source.addStmt(assign("x", 20));
+
+        // Functions see all globals
+        source.analyse(4);
+
+        EXPECT_EQ(
+            callee(source, 0).decl(),
+            source.stmts()[1]->cast<DeclStmt>().decl().get());
+    }
+
+    {
+        Source source;
+        source.addStmt(assign("x", 0));
+        source.addStmt(variable("x", 10));
+
+        try
+        {
+            source.analyse(4);
+            FAIL();
+        }
+        catch (const SemanticError& err)
+        {
+            // Variable is used before its declaration
+            EXPECT_EQ(err.offset(), 0);
+            EXPECT_STREQ(err.what(), "Symbol 'x' not found");
+        }
+    }
+
+    {
+        Source source;
+        source.addStmt(variable("f", 0));
+        source.addStmt(function("f", "f", 10));
+
+        try
+        {
+            source.analyse(4);
+            FAIL();
+        }
+        catch (const SemanticError& err)
+        {
+            EXPECT_EQ(err.offset(), 0);
+            EXPECT_STREQ(err.what(), "redefinition of 'f'");
+        }
+    }
+}
+
+/* ************************************************************************ */
@@ -34,8 +34,10 @@ namespace {
 
 struct TestStmt : public Stmt, public PtrBuilder<TestStmt>
 {
+    static constexpr NodeKind typeKind = NodeKind::ExprStmt;
+
     TestStmt(SourceRange range = {}) noexcept
-        : Stmt(range)
+        : Stmt(typeKind, range)
     {
         // Nothing
     }
@@ -45,7 +47,7 @@ struct TestStmt : public Stmt, public PtrBuilder<TestStmt>
 
 struct TestStmt2 : public Stmt
 {
-    // Nothing
+    static constexpr NodeKind typeKind = NodeKind::IfStmt;
 };
 
 /* ************************************************************************ */
@@ -72,7 +72,7 @@ TEST(FunctionDecl, base)
         EXPECT_TRUE(decl.bodyStmt()->is<CompoundStmt>());
 
         // void bar(int x, int y) {}
-        PtrVector<VariableDecl> params;
+        Vector<VariableDeclPtr> params;
         params.push_back(VariableDecl::make("int", "x", nullptr));
         params.push_back(VariableDecl::make("int", "y", nullptr));
         decl.setParameters(std::move(params));
@@ -36,7 +36,7 @@ namespace {
 
 struct TestExpr : public Expr
 {
-
+    static constexpr NodeKind typeKind = NodeKind::IdentifierExpr;
 };
 
 /* ************************************************************************ */
@@ -33,7 +33,7 @@ namespace {
 
 struct TestExpr : public Expr
 {
-
+    static constexpr NodeKind typeKind = NodeKind::IdentifierExpr;
 };
 
 /* ************************************************************************ */
@@ -49,17 +49,17 @@ TEST(NullLiteralExpr, base)
 
         EXPECT_TRUE(expr.is<NullLiteralExpr>());
         EXPECT_FALSE(expr.is<TestExpr>());
-        EXPECT_EQ(SourceLocation{}, expr.sourceRange().start());
-        EXPECT_EQ(SourceLocation{}, expr.sourceRange().end());
+        EXPECT_EQ(0, expr.sourceRange().start());
+        EXPECT_EQ(0, expr.sourceRange().end());
     }
 
     {
-        const NullLiteralExpr expr({{123, 456}, {123, 458}});
+        const NullLiteralExpr expr({123, 125});
 
         EXPECT_TRUE(expr.is<NullLiteralExpr>());
         EXPECT_FALSE(expr.is<TestExpr>());
-        EXPECT_EQ((SourceLocation{123, 456}), expr.sourceRange().start());
-        EXPECT_EQ((SourceLocation{123, 458}), expr.sourceRange().end());
+        EXPECT_EQ(123, expr.sourceRange().start());
+        EXPECT_EQ(125, expr.sourceRange().end());
     }
 
     {
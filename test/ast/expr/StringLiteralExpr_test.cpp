@@ -33,7 +33,7 @@ namespace {
 
 struct TestExpr : public Expr
 {
-
+    static constexpr NodeKind typeKind = NodeKind::IdentifierExpr;
 };
 
 /* ************************************************************************ */
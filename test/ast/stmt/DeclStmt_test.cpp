@@ -34,14 +34,17 @@ namespace {
 
 struct TestDecl : Decl, public PtrBuilder<TestDecl, String>
 {
-    TestDecl(String name, SourceRange range) : Decl(std::move(name), range) {}
+    static constexpr NodeKind typeKind = NodeKind::VariableDecl;
+
+    TestDecl(String name, SourceRange range)
+        : Decl(typeKind, std::move(name), range) {}
 };
 
 /* ************************************************************************ */
 
 struct TestDecl2 : Decl
 {
-
+    static constexpr NodeKind typeKind = NodeKind::FunctionDecl;
 };
 
 /* ************************************************************************ */
@@ -0,0 +1,408 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// GTest
+#include "gtest/gtest.h"
+
+// Shard
+#include "shard/ast/Decls.hpp"
+#include "shard/ast/Exprs.hpp"
+#include "shard/ast/Source.hpp"
+#include "shard/ast/Stmts.hpp"
+#include "shard/ast/exceptions.hpp"
+#include "shard/builtin/Parser.hpp"
+#include "shard/codegen/Codegen.hpp"
+#include "shard/interpreter/Interpreter.hpp"
+#include "shard/tokenizer/Source.hpp"
+#include "shard/tokenizer/Tokenizer.hpp"
+
+/* ************************************************************************ */
+
+using namespace shard;
+using namespace shard::ast;
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+ir::Module compile(String code)
+{
+    tokenizer::Source source(std::move(code));
+    tokenizer::Tokenizer tokenizer(source);
+    builtin::Parser parser(tokenizer);
+
+    auto ast = parser.parseSource();
+
+    return codegen::generate(ast);
+}
+
+/* ************************************************************************ */
+
+template<typename T, typename... Args>
+Vector<T> list(Args&&... args)
+{
+    Vector<T> result;
+    (result.push_back(std::forward<Args>(args)), ...);
+    return result;
+}
+
+/* ************************************************************************ */
+
+ExprPtr id(const char* name)
+{
+    return IdentifierExpr::make(name);
+}
+
+/* ************************************************************************ */
+
+ExprPtr num(int value)
+{
+    return makeUnique<IntLiteralExpr>(value);
+}
+
+/* ************************************************************************ */
+
+ExprPtr bin(const char* op, ExprPtr lhs, ExprPtr rhs)
+{
+    return BinaryExpr::make(op, std::move(lhs), std::move(rhs));
+}
+
+/* ************************************************************************ */
+
+VariableDeclPtr param(const char* name)
+{
+    return VariableDecl::make("Any", name, nullptr);
+}
+
+/* ************************************************************************ */
+
+StmtPtr func(
+    String retType,
+    const char* name,
+    Vector<VariableDeclPtr> params,
+    StmtPtrVector body)
+{
+    return DeclStmt::make(FunctionDecl::make(
+        std::move(retType),
+        name,
+        CompoundStmt::make(std::move(body)),
+        std::move(params)));
+}
+
+/* ************************************************************************ */
+
+interpreter::Value call(
+    const ir::Module& module,
+    StringView name,
+    const Vector<interpreter::Value>& args)
+{
+    interpreter::Interpreter intpr;
+    intpr.load(module);
+
+    return intpr.call(name, args);
+}
+
+/* ************************************************************************ */
+
+} // namespace
+
+/* ************************************************************************ */
+
+TEST(Codegen, function)
+{
+    const auto module = compile(R"(
+        func add(a, b) {
+            return a + b;
+        }
+
+        func main() {
+            return add(2, 3) * 4;
+        }
+
+        func nothing() {
+            add(1, 2);
+        }
+    )");
+
+    ASSERT_EQ(module.functions().size(), 3);
+
+    const auto& add = *module.functions()[0];
+    EXPECT_EQ(add.name(), "add");
+    EXPECT_EQ(add.returnType(), ir::TypeInt32::instance());
+    ASSERT_EQ(add.parameterTypes().size(), 2);
+    EXPECT_EQ(add.parameterTypes()[0], ir::TypeInt32::instance());
+    EXPECT_EQ(add.parameterTypes()[1], ir::TypeInt32::instance());
+
+    const auto& nothing = *module.functions()[2];
+    EXPECT_EQ(nothing.returnType(), nullptr);
+
+    const auto res = call(module, "main", {});
+    ASSERT_TRUE(res.is<std::int32_t>());
+    EXPECT_EQ(res.get<std::int32_t>(), 20);
+
+    EXPECT_TRUE(call(module, "nothing", {}).is<std::monostate>());
+}
+
+/* ************************************************************************ */
+
+TEST(Codegen, variable)
+{
+    const auto module = compile(R"(
+        func calc(a) {
+            var b = a * 2;
+            var c;
+            c = b = b + 1;
+            return c - a;
+        }
+    )");
+
+    const auto res = call(module, "calc", {std::int32_t{5}});
+    ASSERT_TRUE(res.is<std::int32_t>());
+    EXPECT_EQ(res.get<std::int32_t>(), 6);
+}
+
+/* ************************************************************************ */
+
+TEST(Codegen, ifStmt)
+{
+    Source source(list<StmtPtr>(
+        // func max(a, b) { if (a > b) return a; else return b; }
+        func(
+            "Any",
+            "max",
+            list<VariableDeclPtr>(param("a"), param("b")),
+            list<StmtPtr>(IfStmt::make(
+                bin(">", id("a"), id("b")),
+                ReturnStmt::make(id("a")),
+                ReturnStmt::make(id("b"))))),
+        // func abs(a) { if (a < 0) a = -a; return a; }
+        func(
+            "Any",
+            "abs",
+            list<VariableDeclPtr>(param("a")),
+            list<StmtPtr>(
+                IfStmt::make(
+                    bin("<", id("a"), num(0)),
+                    ExprStmt::make(bin(
+                        "=", id("a"), PrefixUnaryExpr::make("-", id("a")))),
+                    nullptr),
+                ReturnStmt::make(id("a"))))));
+
+    const auto module = codegen::generate(source);
+
+    for (auto [a, b] : {std::pair{3, 7}, {9, 2}, {4, 4}})
+    {
+        const auto res = call(module, "max", {a, b});
+        ASSERT_TRUE(res.is<std::int32_t>());
+        EXPECT_EQ(res.get<std::int32_t>(), std::max(a, b));
+    }
+
+    for (auto a : {-5, 0, 8})
+    {
+        const auto res = call(module, "abs", {a});
+        ASSERT_TRUE(res.is<std::int32_t>());
+        EXPECT_EQ(res.get<std::int32_t>(), std::abs(a));
+    }
+}
+
+/* ************************************************************************ */
+
+TEST(Codegen, whileStmt)
+{
+    // func sum(n) {
+    //     var res = 0;
+    //     var i = 0;
+    //     while (1) {
+    //         i = i + 1;
+    //         if (i > n) break;
+    //         if (i % 2) continue;
+    //         res += i;
+    //     }
+    //     return res;
+    // }
+    Source source(list<StmtPtr>(func(
+        "Any",
+        "sum",
+        list<VariableDeclPtr>(param("n")),
+        list<StmtPtr>(
+            DeclStmt::make(VariableDecl::make("Any", "res", num(0))),
+            DeclStmt::make(VariableDecl::make("Any", "i", num(0))),
+            WhileStmt::make(
+                num(1),
+                CompoundStmt::make(list<StmtPtr>(
+                    ExprStmt::make(
+                        bin("=", id("i"), bin("+", id("i"), num(1)))),
+                    IfStmt::make(
+                        bin(">", id("i"), id("n")),
+                        BreakStmt::make(),
+                        nullptr),
+                    IfStmt::make(
+                        bin("%", id("i"), num(2)),
+                        ContinueStmt::make(),
+                        nullptr),
+                    ExprStmt::make(bin("+=", id("res"), id("i")))))),
+            ReturnStmt::make(id("res"))))));
+
+    const auto module = codegen::generate(source);
+
+    for (auto n : {0, 1, 6, 11})
+    {
+        const auto res = call(module, "sum", {n});
+        ASSERT_TRUE(res.is<std::int32_t>());
+        EXPECT_EQ(res.get<std::int32_t>(), (n / 2) * (n / 2 + 1));
+    }
+
+    // Optimized and compiled code gives the same results
+    interpreter::Interpreter intpr;
+    intpr.setTierUpThreshold(2);
+    intpr.setOsrThreshold(3);
+    intpr.load(module);
+
+    for (auto n : {0, 1, 6, 11, 100})
+    {
+        const auto res = intpr.call("sum", {n});
+        ASSERT_TRUE(res.is<std::int32_t>());
+        EXPECT_EQ(res.get<std::int32_t>(), (n / 2) * (n / 2 + 1));
+    }
+}
+
+/* ************************************************************************ */
+
+TEST(Codegen, logical)
+{
+    // bool both(a, b) { return a > 0 && !(b > 0) || a == b; }
+    Source source(list<StmtPtr>(func(
+        "bool",
+        "both",
+        list<VariableDeclPtr>(param("a"), param("b")),
+        list<StmtPtr>(ReturnStmt::make(bin(
+            "||",
+            bin("&&",
+                bin(">", id("a"), num(0)),
+                PrefixUnaryExpr::make(
+                    "!", ParenExpr::make(bin(">", id("b"), num(0))))),
+            bin("==", id("a"), id("b"))))))));
+
+    const auto module = codegen::generate(source);
+
+    for (auto [a, b] : {std::pair{1, 0}, {1, 1}, {0, 0}, {0, 1}, {-1, 2}})
+    {
+        const auto res = call(module, "both", {a, b});
+        ASSERT_TRUE(res.is<bool>());
+        EXPECT_EQ(res.get<bool>(), (a > 0 && !(b > 0)) || a == b);
+    }
+}
+
+/* ************************************************************************ */
+
+TEST(Codegen, longChain)
+{
+    // func sum() { return 1 + 1 + ... + 1; }
+    constexpr int terms = 200000;
+
+    String code = "func sum() { return 1";
+
+    for (int i = 1; i < terms; ++i)
+        code += " + 1";
+
+    code += "; }";
+
+    const auto module = compile(std::move(code));
+
+    const auto res = call(module, "sum", {});
+    ASSERT_TRUE(res.is<std::int32_t>());
+    EXPECT_EQ(res.get<std::int32_t>(), terms);
+}
+
+/* ************************************************************************ */
+
+TEST(Codegen, scope)
+{
+    // func f(a) { { var a = 10; a += 1; } return a; }
+    Source source(list<StmtPtr>(func(
+        "Any",
+        "f",
+        list<VariableDeclPtr>(param("a")),
+        list<StmtPtr>(
+            CompoundStmt::make(list<StmtPtr>(
+                DeclStmt::make(VariableDecl::make("Any", "a", num(10))),
+                ExprStmt::make(bin("+=", id("a"), num(1))))),
+            ReturnStmt::make(id("a"))))));
+
+    const auto module = codegen::generate(source);
+
+    const auto res = call(module, "f", {3});
+    ASSERT_TRUE(res.is<std::int32_t>());
+    EXPECT_EQ(res.get<std::int32_t>(), 3);
+}
+
+/* ************************************************************************ */
+
+TEST(Codegen, errors)
+{
+    // Top level statement
+    EXPECT_THROW(compile("var a = 5;"), SemanticError);
+
+    // Unknown symbol
+    try
+    {
+        compile("func f() { return a; }");
+        FAIL();
+    }
+    catch (const SemanticError& err)
+    {
+        EXPECT_STREQ(err.what(), "Symbol 'a' not found");
+        EXPECT_EQ(err.offset(), 18);
+    }
+
+    // Redefinition
+    EXPECT_THROW(
+        compile("func f() { return 1; } func f() { return 2; }"),
+        SemanticError);
+
+    // Wrong number of arguments
+    EXPECT_THROW(
+        compile("func f(a) { return a; } func g() { return f(1, 2); }"),
+        SemanticError);
+
+    // Void value
+    EXPECT_THROW(
+        compile("func f() { } func g() { return f(); }"), SemanticError);
+
+    // Break outside of loop
+    {
+        Source source(list<StmtPtr>(
+            func("Any", "f", {}, list<StmtPtr>(BreakStmt::make()))));
+
+        EXPECT_THROW(codegen::generate(source), SemanticError);
+    }
+
+    // Missing return
+    {
+        Source source(list<StmtPtr>(func(
+            "Any",
+            "f",
+            list<VariableDeclPtr>(param("a")),
+            list<StmtPtr>(IfStmt::make(
+                id("a"), ReturnStmt::make(num(1)), nullptr)))));
+
+        EXPECT_THROW(codegen::generate(source), SemanticError);
+    }
+}
+
+/* ************************************************************************ */
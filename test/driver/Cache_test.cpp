@@ -0,0 +1,238 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// C++
+#include <fstream>
+#include <iterator>
+
+// GTest
+#include "gtest/gtest.h"
+
+// Shard
+#include "shard/exceptions.hpp"
+#include "shard/driver/Cache.hpp"
+#include "shard/ir/Function.hpp"
+
+/* ************************************************************************ */
+
+using namespace shard;
+using namespace shard::driver;
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+#if __has_include(<filesystem>)
+namespace fs = std::filesystem;
+#else
+namespace fs = std::experimental::filesystem;
+#endif
+
+/* ************************************************************************ */
+
+/**
+ * @brief      Cache in temporary directory removed at the end of test.
+ */
+struct TestCache : public Cache
+{
+    TestCache()
+        : Cache(
+              fs::temp_directory_path() /
+              ("shard-cache-test-" +
+               toString(::testing::UnitTest::GetInstance()->random_seed()) +
+               "-" +
+               ::testing::UnitTest::GetInstance()
+                   ->current_test_info()
+                   ->name()))
+    {
+        fs::remove_all(directory());
+    }
+
+    ~TestCache()
+    {
+        fs::remove_all(directory());
+    }
+};
+
+/* ************************************************************************ */
+
+bool hasFunction(const ir::Module& module, StringView name)
+{
+    for (const auto& fn : module.functions())
+    {
+        if (fn->name() == name)
+            return true;
+    }
+
+    return false;
+}
+
+/* ************************************************************************ */
+
+} // namespace
+
+/* ************************************************************************ */
+
+TEST(Cache, hash)
+{
+    EXPECT_EQ(Cache::hash(""), 0xcbf29ce484222325);
+    EXPECT_EQ(Cache::hash("a"), 0xaf63dc4c8601ec8c);
+    EXPECT_EQ(Cache::hash("foobar"), 0x85944171f73967e8);
+}
+
+/* ************************************************************************ */
+
+TEST(Cache, path)
+{
+    Cache cache("cache");
+
+    tokenizer::Source source1("func main() {}", "a.shard");
+    tokenizer::Source source2("func main() {}", "b.shard");
+    tokenizer::Source source3("func main() { }", "a.shard");
+
+    // Only content matters
+    EXPECT_EQ(cache.path(source1), cache.path(source2));
+    EXPECT_NE(cache.path(source1), cache.path(source3));
+    EXPECT_EQ(
+        cache.path(source1).parent_path(), FilePath("cache") / Cache::tag());
+
+    // Entries of other compiler versions are separated
+    EXPECT_EQ(Cache::tag().rfind("shard-", 0), 0);
+    EXPECT_EQ(
+        Cache::tag().substr(Cache::tag().rfind('-') + 1),
+        toString(Cache::Version));
+    EXPECT_EQ(cache.path(source1).extension(), ".ir");
+}
+
+/* ************************************************************************ */
+
+TEST(Cache, compile)
+{
+    TestCache cache;
+
+    tokenizer::Source source(
+        "func add(a, b) { return a + b; }\n"
+        "func main() { return add(1, 2); }\n");
+
+    EXPECT_FALSE(cache.load(source));
+
+    {
+        auto module = cache.compile(source);
+        EXPECT_TRUE(hasFunction(module, "add"));
+        EXPECT_TRUE(hasFunction(module, "main"));
+    }
+
+    EXPECT_TRUE(fs::exists(cache.path(source)));
+
+    {
+        auto module = cache.load(source);
+        ASSERT_TRUE(module);
+        ASSERT_EQ(module->functions().size(), 2);
+        EXPECT_TRUE(hasFunction(*module, "add"));
+        EXPECT_TRUE(hasFunction(*module, "main"));
+    }
+
+    // Stored module is used without compiling the source
+    {
+        ir::Module module;
+        module.createFunction("other", {})->createBlock();
+        EXPECT_TRUE(cache.store(source, module));
+    }
+
+    {
+        auto module = cache.compile(source);
+        ASSERT_EQ(module.functions().size(), 1);
+        EXPECT_TRUE(hasFunction(module, "other"));
+    }
+}
+
+/* ************************************************************************ */
+
+TEST(Cache, invalid)
+{
+    TestCache cache;
+
+    tokenizer::Source source("func main() { return 1; }");
+    cache.compile(source);
+
+    // Truncated entry
+    const auto size = fs::file_size(cache.path(source));
+    fs::resize_file(cache.path(source), size / 2);
+    EXPECT_FALSE(cache.load(source));
+
+    // Foreign file
+    {
+        std::ofstream file(cache.path(source));
+        file << "not a module";
+    }
+
+    EXPECT_FALSE(cache.load(source));
+
+    // Entry of other source with the same name
+    {
+        tokenizer::Source other("func main() { return 2; }");
+        EXPECT_TRUE(cache.store(other, cache.compile(other)));
+
+        fs::rename(cache.path(other), cache.path(source));
+        EXPECT_FALSE(cache.load(source));
+    }
+
+    // Entry of other source with the same hash and length
+    {
+        tokenizer::Source other("func main() { return 3; }");
+        ASSERT_EQ(other.source().size(), source.source().size());
+        EXPECT_TRUE(cache.store(other, cache.compile(other)));
+
+        // Force collision by rewriting the header hash
+        String entry;
+        {
+            std::ifstream file(cache.path(other), std::ios::binary);
+            entry.assign(std::istreambuf_iterator<char>(file), {});
+        }
+
+        const auto hash = Cache::hash(source.source());
+
+        for (std::size_t i = 0; i < 8; ++i)
+            entry[4 + i] = static_cast<char>((hash >> (8 * i)) & 0xFF);
+
+        {
+            std::ofstream file(cache.path(source), std::ios::binary);
+            file << entry;
+        }
+
+        EXPECT_FALSE(cache.load(source));
+    }
+
+    // Entry is replaced by compilation
+    cache.compile(source);
+    EXPECT_TRUE(cache.load(source));
+
+    // Invalid source is not stored
+    tokenizer::Source invalid("func main() { return x; }");
+
+    EXPECT_THROW(cache.compile(invalid), LocationError);
+    EXPECT_FALSE(fs::exists(cache.path(invalid)));
+
+    // Source rejected only by analysis is not stored either
+    tokenizer::Source unknown("func main() { foo(1); }");
+
+    EXPECT_THROW(cache.compile(unknown), LocationError);
+    EXPECT_FALSE(fs::exists(cache.path(unknown)));
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,217 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// GTest
+#include "gtest/gtest.h"
+
+// Shard
+#include "shard/ast/AnalysisContext.hpp"
+#include "shard/ast/Decls.hpp"
+#include "shard/ast/Exprs.hpp"
+#include "shard/ast/Stmts.hpp"
+#include "shard/driver/Session.hpp"
+#include "shard/driver/exceptions.hpp"
+
+/* ************************************************************************ */
+
+using namespace shard;
+using namespace shard::driver;
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+void addSource(Session& session, String code, FilePath filename)
+{
+    session.addSource(makeUnique<tokenizer::Source>(
+        std::move(code), std::move(filename)));
+}
+
+/* ************************************************************************ */
+
+const ast::FunctionDecl& function(const ast::Source& source, std::size_t pos)
+{
+    return source.stmts()[pos]
+        ->cast<ast::DeclStmt>()
+        .decl()
+        ->cast<ast::FunctionDecl>();
+}
+
+/* ************************************************************************ */
+
+} // namespace
+
+/* ************************************************************************ */
+
+TEST(Session, parse)
+{
+    Session session;
+    session.setThreadCount(4);
+    EXPECT_EQ(session.threadCount(), 4);
+
+    constexpr std::size_t count = 32;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        String code;
+
+        // Sources of different sizes
+        for (std::size_t j = 0; j <= i; ++j)
+        {
+            code += "func f" + toString(i) + "_" + toString(j) +
+                    "(a, b) { var c = a * b; return c + " + toString(j) +
+                    "; }\n";
+        }
+
+        addSource(session, code, "f" + toString(i) + ".shard");
+    }
+
+    session.parse();
+
+    ASSERT_EQ(session.asts().size(), count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto& ast = session.asts()[i];
+        ASSERT_EQ(ast.stmts().size(), i + 1);
+
+        for (std::size_t j = 0; j <= i; ++j)
+        {
+            const auto& decl = function(ast, j);
+            EXPECT_EQ(decl.name(), "f" + toString(i) + "_" + toString(j));
+            EXPECT_EQ(decl.parameters().size(), 2);
+            EXPECT_TRUE(decl.isArenaAllocated());
+        }
+    }
+
+    // Sources can be reparsed
+    session.setThreadCount(1);
+    session.parse();
+    EXPECT_EQ(session.asts().size(), count);
+}
+
+/* ************************************************************************ */
+
+TEST(Session, parseError)
+{
+    Session session;
+    addSource(session, "func f() { return 1; }", "good.shard");
+    addSource(session, "func g() { return ); }", "bad1.shard");
+    addSource(session, "func (", "bad2.shard");
+
+    try
+    {
+        session.parse();
+        FAIL();
+    }
+    catch (const SourceError& err)
+    {
+        // First failing source is reported
+        EXPECT_EQ(err.filename(), "bad1.shard");
+        EXPECT_EQ(err.location(), (SourceLocation{1, 19}));
+        EXPECT_EQ(String(err.what()).rfind("bad1.shard:1:19: ", 0), 0);
+    }
+}
+
+/* ************************************************************************ */
+
+TEST(Session, analyse)
+{
+    Session session;
+    addSource(session, "func main() { return helper(1); }", "main.shard");
+    addSource(session, "func helper(x) { return x; }", "helper.shard");
+
+    session.parse();
+    session.analyse();
+
+    const auto& main   = function(session.asts()[0], 0);
+    const auto& helper = function(session.asts()[1], 0);
+
+    // Call in main refers to declaration in other source
+    const auto& ret  = main.bodyStmt()->stmts()[0]->cast<ast::ReturnStmt>();
+    const auto& call = ret.resExpr()->cast<ast::FunctionCallExpr>();
+    const auto& name = call.expr()->cast<ast::IdentifierExpr>();
+
+    EXPECT_EQ(name.decl(), &helper);
+}
+
+/* ************************************************************************ */
+
+TEST(Session, analyseBuiltin)
+{
+    Session session;
+    addSource(session, "func main() { print(1); }", "main.shard");
+
+    session.parse();
+    session.analyse();
+
+    const auto& main = function(session.asts()[0], 0);
+
+    const auto& stmt = main.bodyStmt()->stmts()[0]->cast<ast::ExprStmt>();
+    const auto& call = stmt.expr()->cast<ast::FunctionCallExpr>();
+    const auto& name = call.expr()->cast<ast::IdentifierExpr>();
+
+    EXPECT_EQ(name.decl(), ast::AnalysisContext::builtins().findDecl("print"));
+}
+
+/* ************************************************************************ */
+
+TEST(Session, analyseError)
+{
+    {
+        Session session;
+        addSource(session, "func f() { return 1; }", "a.shard");
+        addSource(session, "\nfunc f() { return 2; }", "b.shard");
+
+        session.parse();
+
+        try
+        {
+            session.analyse();
+            FAIL();
+        }
+        catch (const SourceError& err)
+        {
+            EXPECT_EQ(err.filename(), "b.shard");
+            EXPECT_EQ(err.location(), (SourceLocation{2, 1}));
+            EXPECT_EQ(err.message(), "redefinition of 'f'");
+        }
+    }
+
+    {
+        Session session;
+        addSource(session, "func f() { return 1; }", "a.shard");
+        addSource(session, "func g() { return h; }", "b.shard");
+
+        session.parse();
+
+        try
+        {
+            session.analyse();
+            FAIL();
+        }
+        catch (const SourceError& err)
+        {
+            EXPECT_EQ(err.filename(), "b.shard");
+            EXPECT_EQ(err.location(), (SourceLocation{1, 19}));
+            EXPECT_EQ(err.message(), "Symbol 'h' not found");
+        }
+    }
+}
+
+/* ************************************************************************ */
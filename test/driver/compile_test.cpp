@@ -0,0 +1,84 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// GTest
+#include "gtest/gtest.h"
+
+// Shard
+#include "shard/exceptions.hpp"
+#include "shard/driver/compile.hpp"
+#include "shard/ir/Function.hpp"
+
+/* ************************************************************************ */
+
+using namespace shard;
+using namespace shard::driver;
+
+/* ************************************************************************ */
+
+TEST(compile, module)
+{
+    tokenizer::Source source(
+        "func add(a, b) { return a + b; }\n"
+        "func main() { return add(1, 2); }\n");
+
+    const auto module = compile(source);
+    ASSERT_EQ(module.functions().size(), 2);
+    EXPECT_EQ(module.functions()[0]->name(), "add");
+    EXPECT_EQ(module.functions()[1]->name(), "main");
+}
+
+/* ************************************************************************ */
+
+TEST(compile, builtin)
+{
+    tokenizer::Source source("func main() { print(1); }");
+
+    const auto module = compile(source);
+    ASSERT_EQ(module.functions().size(), 1);
+}
+
+/* ************************************************************************ */
+
+TEST(compile, error)
+{
+    tokenizer::Source source("func main() {\n    return x;\n}\n");
+
+    try
+    {
+        compile(source);
+        FAIL();
+    }
+    catch (const LocationError& err)
+    {
+        EXPECT_EQ(err.location(), (SourceLocation{2, 12}));
+    }
+
+    // Unknown function is rejected by analysis
+    tokenizer::Source unknown("func main() {\n    foo(1);\n}\n");
+
+    try
+    {
+        compile(unknown);
+        FAIL();
+    }
+    catch (const LocationError& err)
+    {
+        EXPECT_EQ(err.location(), (SourceLocation{2, 5}));
+    }
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,435 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// GTest
+#include "gtest/gtest.h"
+
+// Shard
+#include "shard/interpreter/Interpreter.hpp"
+#include "shard/interpreter/Jit.hpp"
+#include "shard/ir/Constant.hpp"
+#include "shard/ir/Instruction.hpp"
+#include "shard/ir/Module.hpp"
+
+/* ************************************************************************ */
+
+using namespace shard;
+using namespace shard::interpreter;
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+/**
+ * @brief      Create function computing sum of numbers less than argument.
+ *
+ * @param      module  The module.
+ */
+void createSum(ir::Module& module)
+{
+    auto zero = module.createConstant<ir::ConstInt64>(0);
+    auto one  = module.createConstant<ir::ConstInt64>(1);
+
+    // int64 sum(int64 n)
+    auto sum = module.createFunction(
+        "sum",
+        ir::TypeInt64::instance(),
+        Vector<ViewPtr<ir::Type>>{ir::TypeInt64::instance()});
+
+    auto entry  = sum->createBlock();
+    auto header = sum->createBlock();
+    auto body   = sum->createBlock();
+    auto exit   = sum->createBlock();
+
+    auto i = entry->createInstruction<ir::InstructionAlloc>(
+        ir::TypeInt64::instance());
+    auto s = entry->createInstruction<ir::InstructionAlloc>(
+        ir::TypeInt64::instance());
+    entry->createInstruction<ir::InstructionStore>(i->result(), zero);
+    entry->createInstruction<ir::InstructionStore>(s->result(), zero);
+    entry->createInstruction<ir::InstructionBranch>(header);
+
+    auto value = header->createInstruction<ir::InstructionLoad>(i->result());
+    auto cmp   = header->createInstruction<ir::InstructionCmp>(
+        ir::InstructionCmp::Operation::LessThan,
+        ir::TypeInt64::instance(),
+        value->result(),
+        sum->arg(0));
+    header->createInstruction<ir::InstructionBranchCondition>(
+        cmp->result(), body, exit);
+
+    auto total = body->createInstruction<ir::InstructionLoad>(s->result());
+    auto add   = body->createInstruction<ir::InstructionAdd>(
+        ir::TypeInt64::instance(), total->result(), value->result());
+    body->createInstruction<ir::InstructionStore>(s->result(), add->result());
+    auto next = body->createInstruction<ir::InstructionAdd>(
+        ir::TypeInt64::instance(), value->result(), one);
+    body->createInstruction<ir::InstructionStore>(i->result(), next->result());
+    body->createInstruction<ir::InstructionBranch>(header);
+
+    auto result = exit->createInstruction<ir::InstructionLoad>(s->result());
+    exit->createInstruction<ir::InstructionReturn>(
+        ir::TypeInt64::instance(), result->result());
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief      Create recursive fibonacci function.
+ *
+ * @param      module  The module.
+ */
+void createFib(ir::Module& module)
+{
+    auto one = module.createConstant<ir::ConstInt32>(1);
+    auto two = module.createConstant<ir::ConstInt32>(2);
+
+    // int32 fib(int32 n)
+    auto fib = module.createFunction(
+        "fib",
+        ir::TypeInt32::instance(),
+        Vector<ViewPtr<ir::Type>>{ir::TypeInt32::instance()});
+
+    auto entry   = fib->createBlock();
+    auto small   = fib->createBlock();
+    auto recurse = fib->createBlock();
+
+    auto cmp = entry->createInstruction<ir::InstructionCmp>(
+        ir::InstructionCmp::Operation::LessThan,
+        ir::TypeInt32::instance(),
+        fib->arg(0),
+        two);
+    entry->createInstruction<ir::InstructionBranchCondition>(
+        cmp->result(), small, recurse);
+
+    small->createInstruction<ir::InstructionReturn>(
+        ir::TypeInt32::instance(), fib->arg(0));
+
+    auto n1 = recurse->createInstruction<ir::InstructionSub>(
+        ir::TypeInt32::instance(), fib->arg(0), one);
+    auto n2 = recurse->createInstruction<ir::InstructionSub>(
+        ir::TypeInt32::instance(), fib->arg(0), two);
+    auto f1 = recurse->createInstruction<ir::InstructionCall>(
+        "fib", ir::TypeInt32::instance(), Vector<ViewPtr<ir::Value>>{
+            n1->result()});
+    auto f2 = recurse->createInstruction<ir::InstructionCall>(
+        "fib", ir::TypeInt32::instance(), Vector<ViewPtr<ir::Value>>{
+            n2->result()});
+    auto add = recurse->createInstruction<ir::InstructionAdd>(
+        ir::TypeInt32::instance(), f1->result(), f2->result());
+    recurse->createInstruction<ir::InstructionReturn>(
+        ir::TypeInt32::instance(), add->result());
+}
+
+/* ************************************************************************ */
+
+} // namespace
+
+/* ************************************************************************ */
+
+TEST(Jit, Integer)
+{
+    ir::Module module;
+
+    // int8 mul(int8 a, int8 b)
+    auto mul = module.createFunction(
+        "mul",
+        ir::TypeInt8::instance(),
+        Vector<ViewPtr<ir::Type>>{
+            ir::TypeInt8::instance(), ir::TypeInt8::instance()});
+
+    auto block  = mul->createBlock();
+    auto result = block->createInstruction<ir::InstructionMul>(
+        ir::TypeInt8::instance(), mul->arg(0), mul->arg(1));
+    block->createInstruction<ir::InstructionReturn>(
+        ir::TypeInt8::instance(), result->result());
+
+    Interpreter interpreter;
+    interpreter.setTierUpThreshold(1);
+    interpreter.load(module);
+
+    EXPECT_EQ(
+        interpreter.call("mul", {int8_t(5), int8_t(-3)}).get<int8_t>(), -15);
+
+    // Overflow wraps as in the interpreter
+    EXPECT_EQ(
+        interpreter.call("mul", {int8_t(16), int8_t(16)}).get<int8_t>(), 0);
+
+    EXPECT_EQ(
+        interpreter.compiled(*mul) != nullptr, JitFunction::isAvailable());
+}
+
+/* ************************************************************************ */
+
+TEST(Jit, Float)
+{
+    ir::Module module;
+
+    auto half = module.createConstant<ir::ConstFloat64>(0.5);
+
+    // float64 avg(float64 a, float64 b)
+    auto avg = module.createFunction(
+        "avg",
+        ir::TypeFloat64::instance(),
+        Vector<ViewPtr<ir::Type>>{
+            ir::TypeFloat64::instance(), ir::TypeFloat64::instance()});
+
+    auto block = avg->createBlock();
+    auto add   = block->createInstruction<ir::InstructionAdd>(
+        ir::TypeFloat64::instance(), avg->arg(0), avg->arg(1));
+    auto mul = block->createInstruction<ir::InstructionMul>(
+        ir::TypeFloat64::instance(), add->result(), half);
+    block->createInstruction<ir::InstructionReturn>(
+        ir::TypeFloat64::instance(), mul->result());
+
+    Interpreter interpreter;
+    interpreter.setTierUpThreshold(1);
+    interpreter.load(module);
+
+    EXPECT_DOUBLE_EQ(interpreter.call("avg", {1.0, 4.0}).get<double>(), 2.5);
+    EXPECT_DOUBLE_EQ(interpreter.call("avg", {-3.0, 1.0}).get<double>(), -1.0);
+    EXPECT_EQ(
+        interpreter.compiled(*avg) != nullptr, JitFunction::isAvailable());
+}
+
+/* ************************************************************************ */
+
+TEST(Jit, FloatCompare)
+{
+    ir::Module module;
+
+    // float32 min(float32 a, float32 b)
+    auto min = module.createFunction(
+        "min",
+        ir::TypeFloat32::instance(),
+        Vector<ViewPtr<ir::Type>>{
+            ir::TypeFloat32::instance(), ir::TypeFloat32::instance()});
+
+    auto entry  = min->createBlock();
+    auto first  = min->createBlock();
+    auto second = min->createBlock();
+
+    auto cmp = entry->createInstruction<ir::InstructionCmp>(
+        ir::InstructionCmp::Operation::LessThan,
+        ir::TypeFloat32::instance(),
+        min->arg(0),
+        min->arg(1));
+    entry->createInstruction<ir::InstructionBranchCondition>(
+        cmp->result(), first, second);
+    first->createInstruction<ir::InstructionReturn>(
+        ir::TypeFloat32::instance(), min->arg(0));
+    second->createInstruction<ir::InstructionReturn>(
+        ir::TypeFloat32::instance(), min->arg(1));
+
+    Interpreter interpreter;
+    interpreter.setTierUpThreshold(1);
+    interpreter.load(module);
+
+    EXPECT_FLOAT_EQ(interpreter.call("min", {1.5f, 2.5f}).get<float>(), 1.5f);
+    EXPECT_FLOAT_EQ(interpreter.call("min", {3.5f, -2.f}).get<float>(), -2.f);
+    EXPECT_FLOAT_EQ(interpreter.call("min", {4.f, 4.f}).get<float>(), 4.f);
+}
+
+/* ************************************************************************ */
+
+TEST(Jit, Loop)
+{
+    ir::Module module;
+    createSum(module);
+
+    Interpreter interpreter;
+    interpreter.setTierUpThreshold(1);
+    interpreter.load(module);
+
+    EXPECT_EQ(interpreter.call("sum", {int64_t(0)}).get<int64_t>(), 0);
+    EXPECT_EQ(interpreter.call("sum", {int64_t(10)}).get<int64_t>(), 45);
+    EXPECT_EQ(
+        interpreter.call("sum", {int64_t(100000)}).get<int64_t>(),
+        4999950000);
+}
+
+/* ************************************************************************ */
+
+TEST(Jit, Call)
+{
+    ir::Module module;
+    createFib(module);
+
+    Interpreter interpreter;
+    interpreter.setTierUpThreshold(5);
+    interpreter.load(module);
+
+    // Compiled in the middle of recursion
+    EXPECT_EQ(interpreter.call("fib", {int32_t(20)}).get<int32_t>(), 6765);
+    EXPECT_EQ(interpreter.call("fib", {int32_t(10)}).get<int32_t>(), 55);
+}
+
+/* ************************************************************************ */
+
+TEST(Jit, Exception)
+{
+    ir::Module module;
+
+    // void fail()
+    auto fail = module.createFunction("fail", Vector<ViewPtr<ir::Type>>{});
+    auto block = fail->createBlock();
+    block->createInstruction<ir::InstructionCall>(
+        "missing", Vector<ViewPtr<ir::Value>>{});
+    block->createInstruction<ir::InstructionReturnVoid>();
+
+    Interpreter interpreter;
+    interpreter.setTierUpThreshold(1);
+    interpreter.load(module);
+
+    EXPECT_THROW(interpreter.call("fail", {}), interpreter::Exception);
+    EXPECT_THROW(interpreter.call("fail", {}), interpreter::Exception);
+}
+
+/* ************************************************************************ */
+
+TEST(Jit, Threshold)
+{
+    ir::Module module;
+    createSum(module);
+
+    auto sum = module.functions().front().get();
+
+    Interpreter interpreter;
+    interpreter.setTierUpThreshold(3);
+    interpreter.load(module);
+
+    EXPECT_EQ(interpreter.call("sum", {int64_t(4)}).get<int64_t>(), 6);
+    EXPECT_EQ(interpreter.call("sum", {int64_t(4)}).get<int64_t>(), 6);
+    EXPECT_EQ(interpreter.compiled(*sum), nullptr);
+
+    EXPECT_EQ(interpreter.call("sum", {int64_t(4)}).get<int64_t>(), 6);
+    EXPECT_EQ(
+        interpreter.compiled(*sum) != nullptr, JitFunction::isAvailable());
+
+    // Disabled
+    Interpreter disabled;
+    disabled.setTierUpThreshold(0);
+    disabled.setOsrThreshold(0);
+    disabled.load(module);
+
+    for (int i = 0; i < 5; ++i)
+        EXPECT_EQ(disabled.call("sum", {int64_t(4)}).get<int64_t>(), 6);
+
+    EXPECT_EQ(disabled.compiled(*sum), nullptr);
+}
+
+/* ************************************************************************ */
+
+TEST(Jit, Osr)
+{
+    ir::Module module;
+    createSum(module);
+
+    auto sum = module.functions().front().get();
+
+    Interpreter interpreter;
+    interpreter.setTierUpThreshold(0);
+    interpreter.setOsrThreshold(100);
+    interpreter.load(module);
+
+    // Loop is too short
+    EXPECT_EQ(interpreter.call("sum", {int64_t(50)}).get<int64_t>(), 1225);
+    EXPECT_EQ(interpreter.osrCode(*sum), nullptr);
+
+    // Switch to native code in the middle of the loop
+    EXPECT_EQ(
+        interpreter.call("sum", {int64_t(100000)}).get<int64_t>(),
+        4999950000);
+    EXPECT_EQ(interpreter.osrCode(*sum) != nullptr, JitFunction::isAvailable());
+
+    // Hot loop promotes function for following calls
+    EXPECT_EQ(interpreter.call("sum", {int64_t(10)}).get<int64_t>(), 45);
+    EXPECT_NE(interpreter.optimized(*sum), nullptr);
+    EXPECT_EQ(
+        interpreter.compiled(*sum) != nullptr, JitFunction::isAvailable());
+}
+
+/* ************************************************************************ */
+
+TEST(Jit, Optimized)
+{
+    ir::Module module;
+
+    auto two = module.createConstant<ir::ConstInt32>(2);
+
+    // int32 twice(int32 a), struct allocation prevents native compilation
+    auto pair = module.createType<ir::TypeStruct>(
+        Vector<ViewPtr<ir::Type>>{ir::TypeInt32::instance()});
+
+    auto twice = module.createFunction(
+        "twice",
+        ir::TypeInt32::instance(),
+        Vector<ViewPtr<ir::Type>>{ir::TypeInt32::instance()});
+
+    auto block = twice->createBlock();
+    block->createInstruction<ir::InstructionAlloc>(pair);
+    auto mul1 = block->createInstruction<ir::InstructionMul>(
+        ir::TypeInt32::instance(), twice->arg(0), two);
+    auto mul2 = block->createInstruction<ir::InstructionMul>(
+        ir::TypeInt32::instance(), twice->arg(0), two);
+    auto add = block->createInstruction<ir::InstructionAdd>(
+        ir::TypeInt32::instance(), mul1->result(), mul2->result());
+    block->createInstruction<ir::InstructionReturn>(
+        ir::TypeInt32::instance(), add->result());
+
+    Interpreter interpreter;
+    interpreter.setTierUpThreshold(2);
+    interpreter.load(module);
+
+    EXPECT_EQ(interpreter.call("twice", {int32_t(3)}).get<int32_t>(), 12);
+    EXPECT_EQ(interpreter.optimized(*twice), nullptr);
+
+    // Optimized copy is interpreted
+    EXPECT_EQ(interpreter.call("twice", {int32_t(4)}).get<int32_t>(), 16);
+    EXPECT_EQ(interpreter.call("twice", {int32_t(5)}).get<int32_t>(), 20);
+    ASSERT_NE(interpreter.optimized(*twice), nullptr);
+    EXPECT_EQ(interpreter.compiled(*twice), nullptr);
+    EXPECT_EQ(interpreter.optimized(*twice)->blocks().front()->size(), 4);
+
+    // Original function is untouched
+    EXPECT_EQ(twice->blocks().front()->size(), 5);
+}
+
+/* ************************************************************************ */
+
+TEST(Jit, Unsupported)
+{
+    ir::Module module;
+
+    // int32 first(int32* ptr)
+    auto first = module.createFunction(
+        "first",
+        ir::TypeInt32::instance(),
+        Vector<ViewPtr<ir::Type>>{
+            module.createType<ir::TypePointer>(ir::TypeInt32::instance())});
+
+    auto block = first->createBlock();
+    auto load  = block->createInstruction<ir::InstructionLoad>(first->arg(0));
+    block->createInstruction<ir::InstructionReturn>(
+        ir::TypeInt32::instance(), load->result());
+
+    EXPECT_FALSE(JitFunction::isCompilable(*first));
+    EXPECT_EQ(JitFunction::compile(*first), nullptr);
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,120 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// GTest
+#include "gtest/gtest.h"
+
+// Shard
+#include "shard/ir/Block.hpp"
+#include "shard/ir/Clone.hpp"
+#include "shard/ir/Constant.hpp"
+#include "shard/ir/Function.hpp"
+#include "shard/ir/Instruction.hpp"
+#include "shard/ir/Type.hpp"
+
+/* ************************************************************************ */
+
+using namespace shard;
+using namespace shard::ir;
+
+/* ************************************************************************ */
+
+TEST(Clone, Function)
+{
+    ConstInt32 one(1);
+
+    // int32 count(int32 n)
+    Function function("count", TypeInt32::instance(), {TypeInt32::instance()});
+
+    auto entry  = function.createBlock();
+    auto header = function.createBlock();
+    auto body   = function.createBlock();
+    auto exit   = function.createBlock();
+
+    auto x = entry->createInstruction<InstructionAlloc>(TypeInt32::instance());
+    entry->createInstruction<InstructionStore>(x->result(), function.arg(0));
+    entry->createInstruction<InstructionBranch>(header);
+
+    auto value = header->createInstruction<InstructionLoad>(x->result());
+    auto cmp   = header->createInstruction<InstructionCmp>(
+        InstructionCmp::Operation::GreaterThan,
+        TypeInt32::instance(),
+        value->result(),
+        &one);
+    header->createInstruction<InstructionBranchCondition>(
+        cmp->result(), body, exit);
+
+    auto sub = body->createInstruction<InstructionSub>(
+        TypeInt32::instance(), value->result(), &one);
+    body->createInstruction<InstructionStore>(x->result(), sub->result());
+    body->createInstruction<InstructionCall>(
+        "print", Vector<ViewPtr<Value>>{sub->result()});
+    body->createInstruction<InstructionBranch>(header);
+
+    exit->createInstruction<InstructionReturn>(
+        TypeInt32::instance(), value->result());
+
+    auto copy = clone(function);
+
+    ASSERT_NE(copy, nullptr);
+    EXPECT_EQ(copy->name(), "count");
+    EXPECT_EQ(copy->returnType(), TypeInt32::instance());
+    ASSERT_EQ(copy->blocks().size(), 4);
+
+    auto copyEntry  = copy->blocks()[0].get();
+    auto copyHeader = copy->blocks()[1].get();
+    auto copyBody   = copy->blocks()[2].get();
+    auto copyExit   = copy->blocks()[3].get();
+
+    // Operands refer to the copied values
+    ASSERT_EQ(copyEntry->size(), 3);
+    auto copyX = copyEntry->instructions()[0]->as<InstructionAlloc>().result();
+    EXPECT_NE(copyX, x->result());
+    const auto& store = copyEntry->instructions()[1]->as<InstructionStore>();
+    EXPECT_EQ(store.pointer(), copyX);
+    EXPECT_EQ(store.value(), copy->arg(0));
+
+    ASSERT_EQ(copyHeader->size(), 3);
+    const auto& branch =
+        copyHeader->instructions()[2]->as<InstructionBranchCondition>();
+    EXPECT_EQ(branch.condition(), copyHeader->instructions()[1]->result());
+    EXPECT_EQ(branch.blockTrue(), copyBody);
+    EXPECT_EQ(branch.blockFalse(), copyExit);
+
+    // Constants are shared
+    ASSERT_EQ(copyBody->size(), 4);
+    const auto& copySub = copyBody->instructions()[0]->as<InstructionSub>();
+    EXPECT_EQ(copySub.value1(), copyHeader->instructions()[0]->result());
+    EXPECT_EQ(copySub.value2(), &one);
+    EXPECT_EQ(
+        copyBody->instructions()[3]->as<InstructionBranch>().block(),
+        copyHeader);
+
+    const auto& call = copyBody->instructions()[2]->as<InstructionCall>();
+    EXPECT_EQ(call.name(), "print");
+    ASSERT_EQ(call.arguments().size(), 1);
+    EXPECT_EQ(call.arguments()[0], copySub.result());
+
+    ASSERT_EQ(copyExit->size(), 1);
+    EXPECT_EQ(
+        copyExit->instructions()[0]->as<InstructionReturn>().value(),
+        copyHeader->instructions()[0]->result());
+
+    // Original is untouched
+    EXPECT_EQ(sub->value1(), value->result());
+}
+
+/* ************************************************************************ */
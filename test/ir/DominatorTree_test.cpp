@@ -0,0 +1,119 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// GTest
+#include "gtest/gtest.h"
+
+// Shard
+#include "shard/ir/DominatorTree.hpp"
+#include "shard/ir/Function.hpp"
+#include "shard/ir/Instruction.hpp"
+#include "shard/ir/Type.hpp"
+
+/* ************************************************************************ */
+
+using namespace shard;
+using namespace shard::ir;
+
+/* ************************************************************************ */
+
+TEST(DominatorTree, Diamond)
+{
+    // int32 max(int32, int32)
+    Function function(
+        "max",
+        TypeInt32::instance(),
+        {TypeInt32::instance(), TypeInt32::instance()});
+
+    auto entry  = function.createBlock();
+    auto first  = function.createBlock();
+    auto second = function.createBlock();
+    auto exit   = function.createBlock();
+    auto dead   = function.createBlock();
+
+    auto cmp = entry->createInstruction<InstructionCmp>(
+        InstructionCmp::Operation::GreaterThan,
+        TypeInt32::instance(),
+        function.arg(0),
+        function.arg(1));
+    entry->createInstruction<InstructionBranchCondition>(
+        cmp->result(), first, second);
+    first->createInstruction<InstructionBranch>(exit);
+    second->createInstruction<InstructionBranch>(exit);
+    exit->createInstruction<InstructionReturn>(
+        TypeInt32::instance(), function.arg(0));
+    dead->createInstruction<InstructionBranch>(exit);
+
+    DominatorTree tree(function);
+
+    ASSERT_EQ(tree.blocks().size(), 4);
+    EXPECT_EQ(tree.blocks().front(), entry);
+
+    EXPECT_TRUE(tree.isReachable(exit));
+    EXPECT_FALSE(tree.isReachable(dead));
+
+    EXPECT_EQ(tree.idom(entry), nullptr);
+    EXPECT_EQ(tree.idom(first), entry);
+    EXPECT_EQ(tree.idom(second), entry);
+    EXPECT_EQ(tree.idom(exit), entry);
+    EXPECT_EQ(tree.idom(dead), nullptr);
+    EXPECT_EQ(tree.children(entry).size(), 3);
+
+    EXPECT_TRUE(tree.dominates(entry, entry));
+    EXPECT_TRUE(tree.dominates(entry, exit));
+    EXPECT_FALSE(tree.dominates(first, exit));
+    EXPECT_FALSE(tree.dominates(exit, first));
+    EXPECT_FALSE(tree.dominates(entry, dead));
+}
+
+/* ************************************************************************ */
+
+TEST(DominatorTree, Loop)
+{
+    // void loop(int32)
+    Function function("loop", {TypeInt32::instance()});
+
+    auto entry  = function.createBlock();
+    auto header = function.createBlock();
+    auto body   = function.createBlock();
+    auto latch  = function.createBlock();
+    auto exit   = function.createBlock();
+
+    entry->createInstruction<InstructionBranch>(header);
+    auto cmp = header->createInstruction<InstructionCmp>(
+        InstructionCmp::Operation::LessThan,
+        TypeInt32::instance(),
+        function.arg(0),
+        function.arg(0));
+    header->createInstruction<InstructionBranchCondition>(
+        cmp->result(), body, exit);
+    body->createInstruction<InstructionBranch>(latch);
+    latch->createInstruction<InstructionBranch>(header);
+    exit->createInstruction<InstructionReturnVoid>();
+
+    DominatorTree tree(function);
+
+    EXPECT_EQ(tree.idom(header), entry);
+    EXPECT_EQ(tree.idom(body), header);
+    EXPECT_EQ(tree.idom(latch), body);
+    EXPECT_EQ(tree.idom(exit), header);
+
+    EXPECT_TRUE(tree.dominates(header, latch));
+    EXPECT_FALSE(tree.dominates(latch, header));
+    EXPECT_FALSE(tree.dominates(body, exit));
+}
+
+/* ************************************************************************ */
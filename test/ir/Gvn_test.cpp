@@ -0,0 +1,148 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// GTest
+#include "gtest/gtest.h"
+
+// Shard
+#include "shard/ir/Constant.hpp"
+#include "shard/ir/Function.hpp"
+#include "shard/ir/Gvn.hpp"
+#include "shard/ir/Instruction.hpp"
+#include "shard/ir/Type.hpp"
+
+/* ************************************************************************ */
+
+using namespace shard;
+using namespace shard::ir;
+
+/* ************************************************************************ */
+
+TEST(Gvn, Block)
+{
+    ConstInt32 five1(5);
+    ConstInt32 five2(5);
+
+    // int32 calc(int32, int32)
+    Function function(
+        "calc",
+        TypeInt32::instance(),
+        {TypeInt32::instance(), TypeInt32::instance()});
+
+    auto x = function.arg(0);
+    auto y = function.arg(1);
+
+    auto block = function.createBlock();
+    auto add1 =
+        block->createInstruction<InstructionAdd>(TypeInt32::instance(), x, y);
+    auto add2 =
+        block->createInstruction<InstructionAdd>(TypeInt32::instance(), y, x);
+    auto sub1 =
+        block->createInstruction<InstructionSub>(TypeInt32::instance(), x, y);
+    auto sub2 =
+        block->createInstruction<InstructionSub>(TypeInt32::instance(), y, x);
+    auto mul1 = block->createInstruction<InstructionMul>(
+        TypeInt32::instance(), add1->result(), &five1);
+    auto mul2 = block->createInstruction<InstructionMul>(
+        TypeInt32::instance(), add2->result(), &five2);
+    auto cmp1 = block->createInstruction<InstructionCmp>(
+        InstructionCmp::Operation::LessThan,
+        TypeInt32::instance(),
+        mul1->result(),
+        mul2->result());
+    auto cmp2 = block->createInstruction<InstructionCmp>(
+        InstructionCmp::Operation::GreaterThan,
+        TypeInt32::instance(),
+        mul1->result(),
+        mul2->result());
+    auto call = block->createInstruction<InstructionCall>(
+        "print",
+        Vector<ViewPtr<Value>>{sub1->result(),
+                               sub2->result(),
+                               cmp1->result(),
+                               cmp2->result()});
+    auto ret = block->createInstruction<InstructionReturn>(
+        TypeInt32::instance(), mul2->result());
+
+    EXPECT_TRUE(gvn(function));
+
+    // add2 and mul2 are redundant
+    ASSERT_EQ(block->size(), 8);
+    EXPECT_EQ(block->instructions()[0].get(), add1);
+    EXPECT_EQ(block->instructions()[1].get(), sub1);
+    EXPECT_EQ(block->instructions()[2].get(), sub2);
+    EXPECT_EQ(block->instructions()[3].get(), mul1);
+    EXPECT_EQ(block->instructions()[4].get(), cmp1);
+    EXPECT_EQ(block->instructions()[5].get(), cmp2);
+
+    EXPECT_EQ(cmp1->value1(), mul1->result());
+    EXPECT_EQ(cmp1->value2(), mul1->result());
+    EXPECT_EQ(call->arguments()[0], sub1->result());
+    EXPECT_EQ(call->arguments()[1], sub2->result());
+    EXPECT_EQ(ret->value(), mul1->result());
+
+    EXPECT_FALSE(gvn(function));
+}
+
+/* ************************************************************************ */
+
+TEST(Gvn, Dominance)
+{
+    // int32 calc(int32, int32)
+    Function function(
+        "calc",
+        TypeInt32::instance(),
+        {TypeInt32::instance(), TypeInt32::instance()});
+
+    auto x = function.arg(0);
+    auto y = function.arg(1);
+
+    auto entry  = function.createBlock();
+    auto first  = function.createBlock();
+    auto second = function.createBlock();
+    auto exit   = function.createBlock();
+
+    auto cmp = entry->createInstruction<InstructionCmp>(
+        InstructionCmp::Operation::Equal, TypeInt32::instance(), x, y);
+    entry->createInstruction<InstructionBranchCondition>(
+        cmp->result(), first, second);
+
+    auto div1 =
+        first->createInstruction<InstructionDiv>(TypeInt32::instance(), x, y);
+    first->createInstruction<InstructionBranch>(exit);
+
+    auto cmp2 = second->createInstruction<InstructionCmp>(
+        InstructionCmp::Operation::Equal, TypeInt32::instance(), y, x);
+    auto branch = second->createInstruction<InstructionBranchCondition>(
+        cmp2->result(), exit, exit);
+
+    auto div2 =
+        exit->createInstruction<InstructionDiv>(TypeInt32::instance(), x, y);
+    exit->createInstruction<InstructionReturn>(
+        TypeInt32::instance(), div2->result());
+
+    EXPECT_TRUE(gvn(function));
+
+    // Comparison in dominating block is reused
+    EXPECT_EQ(second->size(), 1);
+    EXPECT_EQ(branch->condition(), cmp->result());
+
+    // Division in sibling block doesn't dominate the exit
+    EXPECT_EQ(first->instructions()[0].get(), div1);
+    EXPECT_EQ(exit->size(), 2);
+}
+
+/* ************************************************************************ */
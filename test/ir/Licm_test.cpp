@@ -0,0 +1,139 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// GTest
+#include "gtest/gtest.h"
+
+// Shard
+#include "shard/ir/Constant.hpp"
+#include "shard/ir/Function.hpp"
+#include "shard/ir/Instruction.hpp"
+#include "shard/ir/Licm.hpp"
+#include "shard/ir/Type.hpp"
+
+/* ************************************************************************ */
+
+using namespace shard;
+using namespace shard::ir;
+
+/* ************************************************************************ */
+
+TEST(Licm, Arithmetic)
+{
+    ConstInt32 zero(0);
+
+    // int32 sum(int32 n, int32 k)
+    Function function(
+        "sum",
+        TypeInt32::instance(),
+        {TypeInt32::instance(), TypeInt32::instance()});
+
+    auto entry  = function.createBlock();
+    auto header = function.createBlock();
+    auto body   = function.createBlock();
+    auto exit   = function.createBlock();
+
+    auto x = entry->createInstruction<InstructionAlloc>(TypeInt32::instance());
+    entry->createInstruction<InstructionStore>(x->result(), &zero);
+    entry->createInstruction<InstructionBranch>(header);
+
+    auto value = header->createInstruction<InstructionLoad>(x->result());
+    auto cmp   = header->createInstruction<InstructionCmp>(
+        InstructionCmp::Operation::LessThan,
+        TypeInt32::instance(),
+        value->result(),
+        function.arg(0));
+    header->createInstruction<InstructionBranchCondition>(
+        cmp->result(), body, exit);
+
+    auto mul = body->createInstruction<InstructionMul>(
+        TypeInt32::instance(), function.arg(1), function.arg(1));
+    auto add = body->createInstruction<InstructionAdd>(
+        TypeInt32::instance(), mul->result(), &zero);
+    auto sum = body->createInstruction<InstructionAdd>(
+        TypeInt32::instance(), value->result(), add->result());
+    body->createInstruction<InstructionStore>(x->result(), sum->result());
+    body->createInstruction<InstructionBranch>(header);
+
+    auto result = exit->createInstruction<InstructionLoad>(x->result());
+    exit->createInstruction<InstructionReturn>(
+        TypeInt32::instance(), result->result());
+
+    EXPECT_TRUE(licm(function));
+
+    // Entry block is the preheader
+    ASSERT_EQ(function.blocks().size(), 4);
+    ASSERT_EQ(entry->size(), 5);
+    EXPECT_EQ(entry->instructions()[2].get(), mul);
+    EXPECT_EQ(entry->instructions()[3].get(), add);
+    EXPECT_TRUE(entry->instructions()[4]->is<InstructionBranch>());
+
+    // Stored variable stays in the loop
+    ASSERT_EQ(header->size(), 3);
+    EXPECT_EQ(header->instructions()[0].get(), value);
+    ASSERT_EQ(body->size(), 3);
+    EXPECT_EQ(body->instructions()[0].get(), sum);
+
+    EXPECT_FALSE(licm(function));
+}
+
+/* ************************************************************************ */
+
+TEST(Licm, Preheader)
+{
+    ConstInt32 one(1);
+
+    // int32 loop(int32 n)
+    Function function("loop", TypeInt32::instance(), {TypeInt32::instance()});
+
+    auto header = function.createBlock();
+    auto body   = function.createBlock();
+    auto exit   = function.createBlock();
+
+    auto y = header->createInstruction<InstructionAlloc>(TypeInt32::instance());
+    auto cmp = header->createInstruction<InstructionCmp>(
+        InstructionCmp::Operation::LessThan,
+        TypeInt32::instance(),
+        function.arg(0),
+        &one);
+    header->createInstruction<InstructionBranchCondition>(
+        cmp->result(), body, exit);
+
+    auto div = body->createInstruction<InstructionDiv>(
+        TypeInt32::instance(), function.arg(0), &one);
+    auto load = body->createInstruction<InstructionLoad>(y->result());
+    body->createInstruction<InstructionCall>(
+        "print", Vector<ViewPtr<Value>>{div->result(), load->result()});
+    body->createInstruction<InstructionBranch>(header);
+
+    exit->createInstruction<InstructionReturn>(
+        TypeInt32::instance(), function.arg(0));
+
+    EXPECT_TRUE(licm(function));
+
+    // New entry block
+    ASSERT_EQ(function.blocks().size(), 4);
+    auto preheader = function.entryBlock();
+    EXPECT_NE(preheader, header);
+
+    // Conditional division and loads of escaped memory are not hoisted
+    ASSERT_EQ(preheader->size(), 2);
+    EXPECT_EQ(preheader->instructions()[0].get(), cmp);
+    EXPECT_TRUE(preheader->instructions()[1]->is<InstructionBranch>());
+    EXPECT_EQ(body->size(), 4);
+}
+
+/* ************************************************************************ */
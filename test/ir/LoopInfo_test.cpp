@@ -0,0 +1,117 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// GTest
+#include "gtest/gtest.h"
+
+// Shard
+#include "shard/ir/DominatorTree.hpp"
+#include "shard/ir/Function.hpp"
+#include "shard/ir/Instruction.hpp"
+#include "shard/ir/LoopInfo.hpp"
+#include "shard/ir/Type.hpp"
+
+/* ************************************************************************ */
+
+using namespace shard;
+using namespace shard::ir;
+
+/* ************************************************************************ */
+
+TEST(LoopInfo, NoLoop)
+{
+    Function function("main", {});
+
+    auto entry = function.createBlock();
+    entry->createInstruction<InstructionReturnVoid>();
+
+    DominatorTree tree(function);
+    LoopInfo info(function, tree);
+
+    EXPECT_TRUE(info.loops().empty());
+    EXPECT_TRUE(info.allLoops().empty());
+    EXPECT_EQ(info.loopFor(entry), nullptr);
+    EXPECT_FALSE(info.isHeader(entry));
+}
+
+/* ************************************************************************ */
+
+TEST(LoopInfo, Nested)
+{
+    // void loop(int32)
+    Function function("loop", {TypeInt32::instance()});
+
+    auto entry      = function.createBlock();
+    auto outer      = function.createBlock();
+    auto inner      = function.createBlock();
+    auto innerBody  = function.createBlock();
+    auto outerLatch = function.createBlock();
+    auto exit       = function.createBlock();
+
+    auto cmp = entry->createInstruction<InstructionCmp>(
+        InstructionCmp::Operation::LessThan,
+        TypeInt32::instance(),
+        function.arg(0),
+        function.arg(0));
+    entry->createInstruction<InstructionBranch>(outer);
+    outer->createInstruction<InstructionBranchCondition>(
+        cmp->result(), inner, exit);
+    inner->createInstruction<InstructionBranchCondition>(
+        cmp->result(), innerBody, outerLatch);
+    innerBody->createInstruction<InstructionBranch>(inner);
+    outerLatch->createInstruction<InstructionBranch>(outer);
+    exit->createInstruction<InstructionReturnVoid>();
+
+    DominatorTree tree(function);
+    LoopInfo info(function, tree);
+
+    ASSERT_EQ(info.allLoops().size(), 2);
+    ASSERT_EQ(info.loops().size(), 1);
+
+    auto outerLoop = info.loops().front();
+    EXPECT_EQ(outerLoop->header(), outer);
+    EXPECT_EQ(outerLoop->parent(), nullptr);
+    EXPECT_EQ(outerLoop->depth(), 1);
+    EXPECT_EQ(outerLoop->blocks().size(), 4);
+    EXPECT_EQ(outerLoop->blocks().front(), outer);
+    ASSERT_EQ(outerLoop->latches().size(), 1);
+    EXPECT_EQ(outerLoop->latches().front(), outerLatch);
+    EXPECT_TRUE(outerLoop->contains(innerBody));
+    EXPECT_FALSE(outerLoop->contains(exit));
+
+    auto exiting = outerLoop->exitingBlocks();
+    ASSERT_EQ(exiting.size(), 1);
+    EXPECT_EQ(exiting.front(), outer);
+
+    ASSERT_EQ(outerLoop->subLoops().size(), 1);
+    auto innerLoop = outerLoop->subLoops().front();
+    EXPECT_EQ(info.allLoops().front().get(), innerLoop);
+    EXPECT_EQ(innerLoop->header(), inner);
+    EXPECT_EQ(innerLoop->parent(), outerLoop);
+    EXPECT_EQ(innerLoop->depth(), 2);
+    EXPECT_EQ(innerLoop->blocks().size(), 2);
+    EXPECT_FALSE(innerLoop->contains(outerLatch));
+
+    EXPECT_EQ(info.loopFor(entry), nullptr);
+    EXPECT_EQ(info.loopFor(outer), outerLoop);
+    EXPECT_EQ(info.loopFor(outerLatch), outerLoop);
+    EXPECT_EQ(info.loopFor(innerBody), innerLoop);
+    EXPECT_TRUE(info.isHeader(inner));
+    EXPECT_TRUE(info.isHeader(outer));
+    EXPECT_FALSE(info.isHeader(innerBody));
+}
+
+/* ************************************************************************ */
@@ -325,4 +325,147 @@ TEST(Serializer, test1)
     }
 }
 
-/* ************************************************************************ */
\ No newline at end of file
+/* ************************************************************************ */
+TEST(Serializer, operands)
+{
+    std::stringstream ss;
+
+    {
+        Module module;
+
+        auto fn = module.createFunction(
+            "max",
+            TypeInt32::instance(),
+            {TypeInt32::instance(), TypeInt32::instance()});
+
+        auto entry  = fn->createBlock();
+        auto first  = fn->createBlock();
+        auto second = fn->createBlock();
+
+        // Arguments and blocks are referenced out of order
+        auto cmp = entry->createInstruction<InstructionCmp>(
+            InstructionCmp::Operation::GreaterThan,
+            TypeInt32::instance(),
+            fn->arg(1),
+            fn->arg(0));
+        entry->createInstruction<InstructionBranchCondition>(
+            cmp->result(), second, first);
+        first->createInstruction<InstructionReturn>(
+            TypeInt32::instance(), module.createConstant<ConstInt32>(7));
+        second->createInstruction<InstructionReturn>(
+            TypeInt32::instance(), fn->arg(1));
+
+        serialize(ss, module);
+    }
+
+    const auto module = deserialize(ss);
+    ASSERT_EQ(1, module.functions().size());
+
+    const auto& fn     = *module.functions()[0];
+    const auto& blocks = fn.blocks();
+    ASSERT_EQ(3, blocks.size());
+
+    const auto& instrs = blocks[0]->instructions();
+    ASSERT_EQ(2, instrs.size());
+
+    const auto& cmp = instrs[0]->as<InstructionCmp>();
+    EXPECT_EQ(fn.arg(1), cmp.value1());
+    EXPECT_EQ(fn.arg(0), cmp.value2());
+
+    const auto& branch = instrs[1]->as<InstructionBranchCondition>();
+    EXPECT_EQ(cmp.result(), branch.condition());
+    EXPECT_EQ(blocks[2].get(), branch.blockTrue());
+    EXPECT_EQ(blocks[1].get(), branch.blockFalse());
+
+    const auto& ret1 = blocks[1]->instructions()[0]->as<InstructionReturn>();
+    ASSERT_TRUE(ret1.value()->isConst());
+    EXPECT_EQ(7, static_cast<const ConstInt32&>(*ret1.value()).value());
+
+    const auto& ret2 = blocks[2]->instructions()[0]->as<InstructionReturn>();
+    EXPECT_EQ(fn.arg(1), ret2.value());
+}
+
+/* ************************************************************************ */
+
+TEST(Serializer, constants)
+{
+    std::stringstream ss;
+
+    {
+        Module module;
+
+        auto fn = module.createFunction(
+            "fn", TypeInt32::instance(), {TypeInt32::instance()});
+
+        auto entry = fn->createBlock();
+        auto exit  = fn->createBlock();
+
+        auto one   = module.createConstant<ConstInt32>(1);
+        auto two   = module.createConstant<ConstInt32>(2);
+        auto truth = module.createConstant<ConstInt1>(true);
+
+        // Constants in every operand position
+        auto add = entry->createInstruction<InstructionAdd>(
+            TypeInt32::instance(), one, fn->arg(0));
+        auto sub = entry->createInstruction<InstructionSub>(
+            TypeInt32::instance(), one, two);
+        auto cmp = entry->createInstruction<InstructionCmp>(
+            InstructionCmp::Operation::LessThan,
+            TypeInt32::instance(),
+            two,
+            add->result());
+        entry->createInstruction<InstructionAnd>(
+            TypeInt32::instance(), sub->result(), add->result());
+        entry->createInstruction<InstructionBranchCondition>(
+            truth, exit, exit);
+        exit->createInstruction<InstructionReturn>(
+            TypeInt32::instance(), sub->result());
+
+        ASSERT_NE(cmp, nullptr);
+        serialize(ss, module);
+    }
+
+    const auto module = deserialize(ss);
+    ASSERT_EQ(1, module.functions().size());
+
+    const auto& fn     = *module.functions()[0];
+    const auto& instrs = fn.blocks()[0]->instructions();
+    ASSERT_EQ(5, instrs.size());
+
+    const auto value = [](ViewPtr<Value> value) {
+        return static_cast<const ConstInt32&>(*value).value();
+    };
+
+    const auto& add = instrs[0]->as<InstructionAdd>();
+    ASSERT_TRUE(add.value1()->isConst());
+    EXPECT_EQ(1, value(add.value1()));
+    EXPECT_EQ(fn.arg(0), add.value2());
+
+    const auto& sub = instrs[1]->as<InstructionSub>();
+    ASSERT_TRUE(sub.value1()->isConst());
+    ASSERT_TRUE(sub.value2()->isConst());
+    EXPECT_EQ(1, value(sub.value1()));
+    EXPECT_EQ(2, value(sub.value2()));
+
+    const auto& cmp = instrs[2]->as<InstructionCmp>();
+    EXPECT_EQ(InstructionCmp::Operation::LessThan, cmp.operation());
+    ASSERT_TRUE(cmp.value1()->isConst());
+    EXPECT_EQ(2, value(cmp.value1()));
+    EXPECT_EQ(add.result(), cmp.value2());
+
+    const auto& bitAnd = instrs[3]->as<InstructionAnd>();
+    EXPECT_EQ(sub.result(), bitAnd.value1());
+    EXPECT_EQ(add.result(), bitAnd.value2());
+
+    const auto& branch = instrs[4]->as<InstructionBranchCondition>();
+    ASSERT_TRUE(branch.condition()->isConst());
+    EXPECT_TRUE(
+        static_cast<const ConstInt1&>(*branch.condition()).value());
+    EXPECT_EQ(fn.blocks()[1].get(), branch.blockTrue());
+
+    const auto& exit = *fn.blocks()[1];
+    EXPECT_EQ(
+        sub.result(), exit.instructions()[0]->as<InstructionReturn>().value());
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,167 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// GTest
+#include "gtest/gtest.h"
+
+// Shard
+#include "shard/ir/Constant.hpp"
+#include "shard/ir/Function.hpp"
+#include "shard/ir/Instruction.hpp"
+#include "shard/ir/SimplifyCfg.hpp"
+#include "shard/ir/Type.hpp"
+
+/* ************************************************************************ */
+
+using namespace shard;
+using namespace shard::ir;
+
+/* ************************************************************************ */
+
+TEST(SimplifyCfg, Merge)
+{
+    // int32 add(int32, int32)
+    Function function(
+        "add",
+        TypeInt32::instance(),
+        {TypeInt32::instance(), TypeInt32::instance()});
+
+    auto l1 = function.createBlock();
+    auto l2 = function.createBlock();
+    auto l3 = function.createBlock();
+
+    l1->createInstruction<InstructionBranch>(l2);
+    auto add = l2->createInstruction<InstructionAdd>(
+        TypeInt32::instance(), function.arg(0), function.arg(1));
+    l2->createInstruction<InstructionBranch>(l3);
+    l3->createInstruction<InstructionReturn>(
+        TypeInt32::instance(), add->result());
+
+    EXPECT_TRUE(simplifyCfg(function));
+
+    ASSERT_EQ(function.blocks().size(), 1);
+    ASSERT_EQ(function.entryBlock(), l1);
+    ASSERT_EQ(l1->size(), 2);
+    EXPECT_EQ(l1->instructions()[0].get(), add);
+    EXPECT_TRUE(l1->instructions()[1]->is<InstructionReturn>());
+
+    EXPECT_FALSE(simplifyCfg(function));
+}
+
+/* ************************************************************************ */
+
+TEST(SimplifyCfg, Thread)
+{
+    // int32 max(int32, int32)
+    Function function(
+        "max",
+        TypeInt32::instance(),
+        {TypeInt32::instance(), TypeInt32::instance()});
+
+    auto entry  = function.createBlock();
+    auto empty1 = function.createBlock();
+    auto empty2 = function.createBlock();
+    auto first  = function.createBlock();
+    auto second = function.createBlock();
+
+    auto cmp = entry->createInstruction<InstructionCmp>(
+        InstructionCmp::Operation::GreaterThan,
+        TypeInt32::instance(),
+        function.arg(0),
+        function.arg(1));
+    auto branch = entry->createInstruction<InstructionBranchCondition>(
+        cmp->result(), empty1, second);
+    empty1->createInstruction<InstructionBranch>(empty2);
+    empty2->createInstruction<InstructionBranch>(first);
+    first->createInstruction<InstructionReturn>(
+        TypeInt32::instance(), function.arg(0));
+    second->createInstruction<InstructionReturn>(
+        TypeInt32::instance(), function.arg(1));
+
+    EXPECT_TRUE(simplifyCfg(function));
+
+    ASSERT_EQ(function.blocks().size(), 3);
+    EXPECT_EQ(branch->blockTrue(), first);
+    EXPECT_EQ(branch->blockFalse(), second);
+    EXPECT_EQ(function.blocks()[1].get(), first);
+    EXPECT_EQ(function.blocks()[2].get(), second);
+}
+
+/* ************************************************************************ */
+
+TEST(SimplifyCfg, FoldCondition)
+{
+    ConstInt1 yes(true);
+
+    Function function("main", {});
+
+    auto entry  = function.createBlock();
+    auto first  = function.createBlock();
+    auto second = function.createBlock();
+
+    entry->createInstruction<InstructionBranchCondition>(&yes, first, second);
+    first->createInstruction<InstructionReturnVoid>();
+    second->createInstruction<InstructionReturnVoid>();
+
+    EXPECT_TRUE(simplifyCfg(function));
+
+    // Second block is unreachable and first is merged into entry
+    ASSERT_EQ(function.blocks().size(), 1);
+    ASSERT_EQ(entry->size(), 1);
+    EXPECT_TRUE(entry->instructions()[0]->is<InstructionReturnVoid>());
+}
+
+/* ************************************************************************ */
+
+TEST(SimplifyCfg, Loop)
+{
+    // void loop(int32)
+    Function function("loop", {TypeInt32::instance()});
+
+    auto entry  = function.createBlock();
+    auto header = function.createBlock();
+    auto body   = function.createBlock();
+    auto exit   = function.createBlock();
+
+    entry->createInstruction<InstructionBranch>(header);
+    auto cmp = header->createInstruction<InstructionCmp>(
+        InstructionCmp::Operation::LessThan,
+        TypeInt32::instance(),
+        function.arg(0),
+        function.arg(0));
+    header->createInstruction<InstructionBranchCondition>(
+        cmp->result(), body, exit);
+    body->createInstruction<InstructionBranch>(header);
+    exit->createInstruction<InstructionReturnVoid>();
+
+    EXPECT_TRUE(simplifyCfg(function));
+
+    // Empty loop body is threaded, header has two predecessors
+    ASSERT_EQ(function.blocks().size(), 3);
+    EXPECT_EQ(function.blocks()[1].get(), header);
+    EXPECT_EQ(function.blocks()[2].get(), exit);
+
+    auto successors = header->successors();
+    ASSERT_EQ(successors.size(), 2);
+    EXPECT_EQ(successors[0], header);
+    EXPECT_EQ(successors[1], exit);
+
+    auto predecessors = function.predecessors();
+    EXPECT_EQ(predecessors[header].size(), 2);
+    EXPECT_EQ(predecessors[exit].size(), 1);
+}
+
+/* ************************************************************************ */
@@ -126,4 +126,27 @@ TEST(Type, cast)
     EXPECT_EQ(type->as<TypeInt8>().kind(), TypeKind::Int8);
 }
 
-/* ************************************************************************ */
\ No newline at end of file
+/* ************************************************************************ */
+TEST(Type, equals)
+{
+    TypePointer pointer1(TypeInt32::instance());
+    TypePointer pointer2(TypeInt32::instance());
+    TypePointer pointer3(TypeInt8::instance());
+    TypeStruct struct1({TypeInt8::instance(), &pointer1});
+    TypeStruct struct2({TypeInt8::instance(), &pointer2});
+    TypeStruct struct3({TypeInt8::instance()});
+
+    EXPECT_TRUE(TypeInt32::instance()->equals(*TypeInt32::instance()));
+    EXPECT_FALSE(TypeInt32::instance()->equals(*TypeInt64::instance()));
+
+    EXPECT_TRUE(pointer1.equals(pointer2));
+    EXPECT_FALSE(pointer1.equals(pointer3));
+    EXPECT_EQ(pointer1.hash(), pointer2.hash());
+
+    EXPECT_TRUE(struct1.equals(struct2));
+    EXPECT_FALSE(struct1.equals(struct3));
+    EXPECT_FALSE(struct1.equals(pointer1));
+    EXPECT_EQ(struct1.hash(), struct2.hash());
+}
+
+/* ************************************************************************ */
@@ -53,8 +53,12 @@ TEST(Parser, intLiteral)
 
         auto literal = parser.parseIntLiteralExpr();
         EXPECT_EQ(literal.value(), 0);
-        EXPECT_EQ(literal.sourceRange().start(), (SourceLocation{1, 1}));
-        EXPECT_EQ(literal.sourceRange().end(), (SourceLocation{1, 2}));
+        EXPECT_EQ(
+            source.location(literal.sourceRange().start()),
+            (SourceLocation{1, 1}));
+        EXPECT_EQ(
+            source.location(literal.sourceRange().end()),
+            (SourceLocation{1, 2}));
 
         EXPECT_TRUE(parser.isEmpty());
     }
@@ -66,8 +70,12 @@ TEST(Parser, intLiteral)
 
         auto literal = parser.parseIntLiteralExpr();
         EXPECT_EQ(literal.value(), 1246479);
-        EXPECT_EQ(literal.sourceRange().start(), (SourceLocation{1, 1}));
-        EXPECT_EQ(literal.sourceRange().end(), (SourceLocation{1, 8}));
+        EXPECT_EQ(
+            source.location(literal.sourceRange().start()),
+            (SourceLocation{1, 1}));
+        EXPECT_EQ(
+            source.location(literal.sourceRange().end()),
+            (SourceLocation{1, 8}));
 
         EXPECT_TRUE(parser.isEmpty());
     }
@@ -102,8 +110,12 @@ TEST(Parser, identifier)
 
         auto literal = parser.parseIdentifierExpr();
         EXPECT_EQ(literal.name(), "val");
-        EXPECT_EQ(literal.sourceRange().start(), (SourceLocation{1, 1}));
-        EXPECT_EQ(literal.sourceRange().end(), (SourceLocation{1, 4}));
+        EXPECT_EQ(
+            source.location(literal.sourceRange().start()),
+            (SourceLocation{1, 1}));
+        EXPECT_EQ(
+            source.location(literal.sourceRange().end()),
+            (SourceLocation{1, 4}));
 
         EXPECT_TRUE(parser.isEmpty());
     }
@@ -115,8 +127,12 @@ TEST(Parser, identifier)
 
         auto literal = parser.parseIdentifierExpr();
         EXPECT_EQ(literal.name(), "hello");
-        EXPECT_EQ(literal.sourceRange().start(), (SourceLocation{1, 1}));
-        EXPECT_EQ(literal.sourceRange().end(), (SourceLocation{1, 6}));
+        EXPECT_EQ(
+            source.location(literal.sourceRange().start()),
+            (SourceLocation{1, 1}));
+        EXPECT_EQ(
+            source.location(literal.sourceRange().end()),
+            (SourceLocation{1, 6}));
 
         EXPECT_TRUE(parser.isEmpty());
     }
@@ -150,8 +166,11 @@ TEST(Parser, parenExpr)
         Parser parser(tokenizer);
 
         auto expr = parser.parseParenExpr();
-        EXPECT_EQ(expr.sourceRange().start(), (SourceLocation{1, 1}));
-        EXPECT_EQ(expr.sourceRange().end(), (SourceLocation{1, 4}));
+        EXPECT_EQ(
+            source.location(expr.sourceRange().start()),
+            (SourceLocation{1, 1}));
+        EXPECT_EQ(
+            source.location(expr.sourceRange().end()), (SourceLocation{1, 4}));
 
         EXPECT_TRUE(parser.isEmpty());
     }
@@ -213,8 +232,11 @@ TEST(Parser, primaryExpr)
         Parser parser(tokenizer);
 
         auto expr = parser.parsePrimaryExpr();
-        EXPECT_EQ(expr->sourceRange().start(), (SourceLocation{1, 1}));
-        EXPECT_EQ(expr->sourceRange().end(), (SourceLocation{1, 9}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().start()),
+            (SourceLocation{1, 1}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().end()), (SourceLocation{1, 9}));
 
         ASSERT_TRUE(expr->is<ast::IdentifierExpr>());
 
@@ -231,8 +253,11 @@ TEST(Parser, primaryExpr)
         Parser parser(tokenizer);
 
         auto expr = parser.parsePrimaryExpr();
-        EXPECT_EQ(expr->sourceRange().start(), (SourceLocation{1, 1}));
-        EXPECT_EQ(expr->sourceRange().end(), (SourceLocation{1, 4}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().start()),
+            (SourceLocation{1, 1}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().end()), (SourceLocation{1, 4}));
 
         ASSERT_TRUE(expr->is<ast::IntLiteralExpr>());
 
@@ -249,16 +274,23 @@ TEST(Parser, primaryExpr)
         Parser parser(tokenizer);
 
         auto expr = parser.parsePrimaryExpr();
-        EXPECT_EQ(expr->sourceRange().start(), (SourceLocation{1, 1}));
-        EXPECT_EQ(expr->sourceRange().end(), (SourceLocation{1, 4}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().start()),
+            (SourceLocation{1, 1}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().end()), (SourceLocation{1, 4}));
 
         ASSERT_TRUE(expr->is<ast::ParenExpr>());
         auto& paren = expr->cast<ast::ParenExpr>();
 
         auto& child = paren.expr();
         ASSERT_TRUE(child->is<ast::IntLiteralExpr>());
-        EXPECT_EQ(child->sourceRange().start(), (SourceLocation{1, 2}));
-        EXPECT_EQ(child->sourceRange().end(), (SourceLocation{1, 3}));
+        EXPECT_EQ(
+            source.location(child->sourceRange().start()),
+            (SourceLocation{1, 2}));
+        EXPECT_EQ(
+            source.location(child->sourceRange().end()),
+            (SourceLocation{1, 3}));
 
         auto& integer = child->cast<ast::IntLiteralExpr>();
         EXPECT_EQ(integer.value(), 0);
@@ -296,8 +328,11 @@ TEST(Parser, prefixExpr)
         Parser parser(tokenizer);
 
         auto expr = parser.parsePrefixExpr();
-        EXPECT_EQ(expr->sourceRange().start(), (SourceLocation{1, 1}));
-        EXPECT_EQ(expr->sourceRange().end(), (SourceLocation{1, 4}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().start()),
+            (SourceLocation{1, 1}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().end()), (SourceLocation{1, 4}));
 
         ASSERT_TRUE(expr->is<ast::IntLiteralExpr>());
 
@@ -317,8 +352,11 @@ TEST(Parser, prefixExpr)
         parser.addPrefixOperator("!");
 
         auto expr = parser.parsePrefixExpr();
-        EXPECT_EQ(expr->sourceRange().start(), (SourceLocation{1, 1}));
-        EXPECT_EQ(expr->sourceRange().end(), (SourceLocation{1, 3}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().start()),
+            (SourceLocation{1, 1}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().end()), (SourceLocation{1, 3}));
 
         ASSERT_TRUE(expr->is<ast::PrefixUnaryExpr>());
         auto& unary = expr->cast<ast::PrefixUnaryExpr>();
@@ -327,8 +365,12 @@ TEST(Parser, prefixExpr)
 
         ASSERT_TRUE(unary.expr()->is<ast::IntLiteralExpr>());
         auto& integer = unary.expr()->cast<ast::IntLiteralExpr>();
-        EXPECT_EQ(integer.sourceRange().start(), (SourceLocation{1, 2}));
-        EXPECT_EQ(integer.sourceRange().end(), (SourceLocation{1, 3}));
+        EXPECT_EQ(
+            source.location(integer.sourceRange().start()),
+            (SourceLocation{1, 2}));
+        EXPECT_EQ(
+            source.location(integer.sourceRange().end()),
+            (SourceLocation{1, 3}));
 
         EXPECT_EQ(integer.value(), 1);
 
@@ -346,8 +388,11 @@ TEST(Parser, prefixExpr)
         parser.addPrefixOperator("?");
 
         auto expr = parser.parsePrefixExpr();
-        EXPECT_EQ(expr->sourceRange().start(), (SourceLocation{1, 1}));
-        EXPECT_EQ(expr->sourceRange().end(), (SourceLocation{1, 4}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().start()),
+            (SourceLocation{1, 1}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().end()), (SourceLocation{1, 4}));
 
         ASSERT_TRUE(expr->is<ast::PrefixUnaryExpr>());
         auto& unary1 = expr->cast<ast::PrefixUnaryExpr>();
@@ -356,15 +401,23 @@ TEST(Parser, prefixExpr)
 
         ASSERT_TRUE(unary1.expr()->is<ast::PrefixUnaryExpr>());
         auto& unary2 = unary1.expr()->cast<ast::PrefixUnaryExpr>();
-        EXPECT_EQ(unary2.sourceRange().start(), (SourceLocation{1, 2}));
-        EXPECT_EQ(unary2.sourceRange().end(), (SourceLocation{1, 4}));
+        EXPECT_EQ(
+            source.location(unary2.sourceRange().start()),
+            (SourceLocation{1, 2}));
+        EXPECT_EQ(
+            source.location(unary2.sourceRange().end()),
+            (SourceLocation{1, 4}));
 
         EXPECT_EQ(unary2.op(), "!");
 
         ASSERT_TRUE(unary2.expr()->is<ast::IntLiteralExpr>());
         auto& integer = unary2.expr()->cast<ast::IntLiteralExpr>();
-        EXPECT_EQ(integer.sourceRange().start(), (SourceLocation{1, 3}));
-        EXPECT_EQ(integer.sourceRange().end(), (SourceLocation{1, 4}));
+        EXPECT_EQ(
+            source.location(integer.sourceRange().start()),
+            (SourceLocation{1, 3}));
+        EXPECT_EQ(
+            source.location(integer.sourceRange().end()),
+            (SourceLocation{1, 4}));
 
         EXPECT_EQ(integer.value(), 1);
 
@@ -401,8 +454,11 @@ TEST(Parser, postfixExpr)
         Parser parser(tokenizer);
 
         auto expr = parser.parsePostfixExpr();
-        EXPECT_EQ(expr->sourceRange().start(), (SourceLocation{1, 1}));
-        EXPECT_EQ(expr->sourceRange().end(), (SourceLocation{1, 4}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().start()),
+            (SourceLocation{1, 1}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().end()), (SourceLocation{1, 4}));
 
         ASSERT_TRUE(expr->is<ast::IntLiteralExpr>());
 
@@ -422,8 +478,11 @@ TEST(Parser, postfixExpr)
         parser.addPostfixOperator("?");
 
         auto expr = parser.parsePostfixExpr();
-        EXPECT_EQ(expr->sourceRange().start(), (SourceLocation{1, 1}));
-        EXPECT_EQ(expr->sourceRange().end(), (SourceLocation{1, 3}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().start()),
+            (SourceLocation{1, 1}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().end()), (SourceLocation{1, 3}));
 
         ASSERT_TRUE(expr->is<ast::PostfixUnaryExpr>());
         auto& unary = expr->cast<ast::PostfixUnaryExpr>();
@@ -432,8 +491,12 @@ TEST(Parser, postfixExpr)
 
         ASSERT_TRUE(unary.expr()->is<ast::IntLiteralExpr>());
         auto& integer = unary.expr()->cast<ast::IntLiteralExpr>();
-        EXPECT_EQ(integer.sourceRange().start(), (SourceLocation{1, 1}));
-        EXPECT_EQ(integer.sourceRange().end(), (SourceLocation{1, 2}));
+        EXPECT_EQ(
+            source.location(integer.sourceRange().start()),
+            (SourceLocation{1, 1}));
+        EXPECT_EQ(
+            source.location(integer.sourceRange().end()),
+            (SourceLocation{1, 2}));
 
         EXPECT_EQ(integer.value(), 1);
 
@@ -451,8 +514,11 @@ TEST(Parser, postfixExpr)
         parser.addPostfixOperator("!");
 
         auto expr = parser.parsePostfixExpr();
-        EXPECT_EQ(expr->sourceRange().start(), (SourceLocation{1, 1}));
-        EXPECT_EQ(expr->sourceRange().end(), (SourceLocation{1, 4}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().start()),
+            (SourceLocation{1, 1}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().end()), (SourceLocation{1, 4}));
 
         ASSERT_TRUE(expr->is<ast::PostfixUnaryExpr>());
         auto& unary1 = expr->cast<ast::PostfixUnaryExpr>();
@@ -461,15 +527,23 @@ TEST(Parser, postfixExpr)
 
         ASSERT_TRUE(unary1.expr()->is<ast::PostfixUnaryExpr>());
         auto& unary2 = unary1.expr()->cast<ast::PostfixUnaryExpr>();
-        EXPECT_EQ(unary2.sourceRange().start(), (SourceLocation{1, 1}));
-        EXPECT_EQ(unary2.sourceRange().end(), (SourceLocation{1, 3}));
+        EXPECT_EQ(
+            source.location(unary2.sourceRange().start()),
+            (SourceLocation{1, 1}));
+        EXPECT_EQ(
+            source.location(unary2.sourceRange().end()),
+            (SourceLocation{1, 3}));
 
         EXPECT_EQ(unary2.op(), "?");
 
         ASSERT_TRUE(unary2.expr()->is<ast::IntLiteralExpr>());
         auto& integer = unary2.expr()->cast<ast::IntLiteralExpr>();
-        EXPECT_EQ(integer.sourceRange().start(), (SourceLocation{1, 1}));
-        EXPECT_EQ(integer.sourceRange().end(), (SourceLocation{1, 2}));
+        EXPECT_EQ(
+            source.location(integer.sourceRange().start()),
+            (SourceLocation{1, 1}));
+        EXPECT_EQ(
+            source.location(integer.sourceRange().end()),
+            (SourceLocation{1, 2}));
 
         EXPECT_EQ(integer.value(), 1);
 
@@ -506,8 +580,11 @@ TEST(Parser, binaryExpr)
         Parser parser(tokenizer);
 
         auto expr = parser.parseBinaryExpr();
-        EXPECT_EQ(expr->sourceRange().start(), (SourceLocation{1, 1}));
-        EXPECT_EQ(expr->sourceRange().end(), (SourceLocation{1, 4}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().start()),
+            (SourceLocation{1, 1}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().end()), (SourceLocation{1, 4}));
 
         ASSERT_TRUE(expr->is<ast::IntLiteralExpr>());
 
@@ -527,8 +604,11 @@ TEST(Parser, binaryExpr)
         parser.addBinaryOperator("+");
 
         auto expr = parser.parseBinaryExpr();
-        EXPECT_EQ(expr->sourceRange().start(), (SourceLocation{1, 1}));
-        EXPECT_EQ(expr->sourceRange().end(), (SourceLocation{1, 6}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().start()),
+            (SourceLocation{1, 1}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().end()), (SourceLocation{1, 6}));
 
         ASSERT_TRUE(expr->is<ast::BinaryExpr>());
         auto& binary = expr->cast<ast::BinaryExpr>();
@@ -537,14 +617,22 @@ TEST(Parser, binaryExpr)
 
         ASSERT_TRUE(binary.lhs()->is<ast::IntLiteralExpr>());
         auto& integer1 = binary.lhs()->cast<ast::IntLiteralExpr>();
-        EXPECT_EQ(integer1.sourceRange().start(), (SourceLocation{1, 1}));
-        EXPECT_EQ(integer1.sourceRange().end(), (SourceLocation{1, 2}));
+        EXPECT_EQ(
+            source.location(integer1.sourceRange().start()),
+            (SourceLocation{1, 1}));
+        EXPECT_EQ(
+            source.location(integer1.sourceRange().end()),
+            (SourceLocation{1, 2}));
         EXPECT_EQ(integer1.value(), 1);
 
         ASSERT_TRUE(binary.rhs()->is<ast::IntLiteralExpr>());
         auto& integer2 = binary.rhs()->cast<ast::IntLiteralExpr>();
-        EXPECT_EQ(integer2.sourceRange().start(), (SourceLocation{1, 5}));
-        EXPECT_EQ(integer2.sourceRange().end(), (SourceLocation{1, 6}));
+        EXPECT_EQ(
+            source.location(integer2.sourceRange().start()),
+            (SourceLocation{1, 5}));
+        EXPECT_EQ(
+            source.location(integer2.sourceRange().end()),
+            (SourceLocation{1, 6}));
         EXPECT_EQ(integer2.value(), 2);
 
         EXPECT_TRUE(parser.isEmpty());
@@ -562,8 +650,12 @@ TEST(Parser, binaryExpr)
         parser.addBinaryOperator("=");
 
         auto expr = parser.parseBinaryExpr();
-        EXPECT_EQ(expr->sourceRange().start(), (SourceLocation{1, 1}));
-        EXPECT_EQ(expr->sourceRange().end(), (SourceLocation{1, 16}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().start()),
+            (SourceLocation{1, 1}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().end()),
+            (SourceLocation{1, 16}));
 
         ASSERT_TRUE(expr->is<ast::BinaryExpr>());
         auto& binary1 = expr->cast<ast::BinaryExpr>();
@@ -572,8 +664,10 @@ TEST(Parser, binaryExpr)
 
         ASSERT_TRUE(binary1.lhs()->is<ast::IdentifierExpr>());
         auto& id1 = binary1.lhs()->cast<ast::IdentifierExpr>();
-        EXPECT_EQ(id1.sourceRange().start(), (SourceLocation{1, 1}));
-        EXPECT_EQ(id1.sourceRange().end(), (SourceLocation{1, 4}));
+        EXPECT_EQ(
+            source.location(id1.sourceRange().start()), (SourceLocation{1, 1}));
+        EXPECT_EQ(
+            source.location(id1.sourceRange().end()), (SourceLocation{1, 4}));
         EXPECT_EQ(id1.name(), "val");
 
         ASSERT_TRUE(binary1.rhs()->is<ast::BinaryExpr>());
@@ -583,8 +677,12 @@ TEST(Parser, binaryExpr)
 
         ASSERT_TRUE(binary2.lhs()->is<ast::IntLiteralExpr>());
         auto& integer1 = binary2.lhs()->cast<ast::IntLiteralExpr>();
-        EXPECT_EQ(integer1.sourceRange().start(), (SourceLocation{1, 7}));
-        EXPECT_EQ(integer1.sourceRange().end(), (SourceLocation{1, 8}));
+        EXPECT_EQ(
+            source.location(integer1.sourceRange().start()),
+            (SourceLocation{1, 7}));
+        EXPECT_EQ(
+            source.location(integer1.sourceRange().end()),
+            (SourceLocation{1, 8}));
         EXPECT_EQ(integer1.value(), 5);
 
         ASSERT_TRUE(binary2.rhs()->is<ast::BinaryExpr>());
@@ -594,14 +692,22 @@ TEST(Parser, binaryExpr)
 
         ASSERT_TRUE(binary3.lhs()->is<ast::IntLiteralExpr>());
         auto& integer2 = binary3.lhs()->cast<ast::IntLiteralExpr>();
-        EXPECT_EQ(integer2.sourceRange().start(), (SourceLocation{1, 11}));
-        EXPECT_EQ(integer2.sourceRange().end(), (SourceLocation{1, 12}));
+        EXPECT_EQ(
+            source.location(integer2.sourceRange().start()),
+            (SourceLocation{1, 11}));
+        EXPECT_EQ(
+            source.location(integer2.sourceRange().end()),
+            (SourceLocation{1, 12}));
         EXPECT_EQ(integer2.value(), 2);
 
         ASSERT_TRUE(binary3.rhs()->is<ast::IntLiteralExpr>());
         auto& integer3 = binary3.rhs()->cast<ast::IntLiteralExpr>();
-        EXPECT_EQ(integer3.sourceRange().start(), (SourceLocation{1, 15}));
-        EXPECT_EQ(integer3.sourceRange().end(), (SourceLocation{1, 16}));
+        EXPECT_EQ(
+            source.location(integer3.sourceRange().start()),
+            (SourceLocation{1, 15}));
+        EXPECT_EQ(
+            source.location(integer3.sourceRange().end()),
+            (SourceLocation{1, 16}));
         EXPECT_EQ(integer3.value(), 3);
 
         EXPECT_TRUE(parser.isEmpty());
@@ -637,8 +743,11 @@ TEST(Parser, expr)
         Parser parser(tokenizer);
 
         auto expr = parser.parseExpr();
-        EXPECT_EQ(expr->sourceRange().start(), (SourceLocation{1, 1}));
-        EXPECT_EQ(expr->sourceRange().end(), (SourceLocation{1, 9}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().start()),
+            (SourceLocation{1, 1}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().end()), (SourceLocation{1, 9}));
 
         ASSERT_TRUE(expr->is<ast::IdentifierExpr>());
 
@@ -655,8 +764,11 @@ TEST(Parser, expr)
         Parser parser(tokenizer);
 
         auto expr = parser.parseExpr();
-        EXPECT_EQ(expr->sourceRange().start(), (SourceLocation{1, 1}));
-        EXPECT_EQ(expr->sourceRange().end(), (SourceLocation{1, 4}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().start()),
+            (SourceLocation{1, 1}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().end()), (SourceLocation{1, 4}));
 
         ASSERT_TRUE(expr->is<ast::IntLiteralExpr>());
 
@@ -673,8 +785,11 @@ TEST(Parser, expr)
         Parser parser(tokenizer);
 
         auto expr = parser.parseExpr();
-        EXPECT_EQ(expr->sourceRange().start(), (SourceLocation{1, 1}));
-        EXPECT_EQ(expr->sourceRange().end(), (SourceLocation{1, 4}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().start()),
+            (SourceLocation{1, 1}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().end()), (SourceLocation{1, 4}));
 
         EXPECT_TRUE(parser.isEmpty());
     }
@@ -689,8 +804,11 @@ TEST(Parser, expr)
         parser.addPrefixOperator("!");
 
         auto expr = parser.parseExpr();
-        EXPECT_EQ(expr->sourceRange().start(), (SourceLocation{1, 1}));
-        EXPECT_EQ(expr->sourceRange().end(), (SourceLocation{1, 3}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().start()),
+            (SourceLocation{1, 1}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().end()), (SourceLocation{1, 3}));
 
         ASSERT_TRUE(expr->is<ast::PrefixUnaryExpr>());
         auto& unary = expr->cast<ast::PrefixUnaryExpr>();
@@ -715,8 +833,11 @@ TEST(Parser, expr)
         parser.addPostfixOperator("?");
 
         auto expr = parser.parseExpr();
-        EXPECT_EQ(expr->sourceRange().start(), (SourceLocation{1, 1}));
-        EXPECT_EQ(expr->sourceRange().end(), (SourceLocation{1, 3}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().start()),
+            (SourceLocation{1, 1}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().end()), (SourceLocation{1, 3}));
 
         ASSERT_TRUE(expr->is<ast::PostfixUnaryExpr>());
         auto& unary = expr->cast<ast::PostfixUnaryExpr>();
@@ -725,8 +846,12 @@ TEST(Parser, expr)
 
         ASSERT_TRUE(unary.expr()->is<ast::IntLiteralExpr>());
         auto& integer = unary.expr()->cast<ast::IntLiteralExpr>();
-        EXPECT_EQ(integer.sourceRange().start(), (SourceLocation{1, 1}));
-        EXPECT_EQ(integer.sourceRange().end(), (SourceLocation{1, 2}));
+        EXPECT_EQ(
+            source.location(integer.sourceRange().start()),
+            (SourceLocation{1, 1}));
+        EXPECT_EQ(
+            source.location(integer.sourceRange().end()),
+            (SourceLocation{1, 2}));
 
         EXPECT_EQ(integer.value(), 1);
 
@@ -743,8 +868,11 @@ TEST(Parser, expr)
         parser.addBinaryOperator("+");
 
         auto expr = parser.parseExpr();
-        EXPECT_EQ(expr->sourceRange().start(), (SourceLocation{1, 1}));
-        EXPECT_EQ(expr->sourceRange().end(), (SourceLocation{1, 6}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().start()),
+            (SourceLocation{1, 1}));
+        EXPECT_EQ(
+            source.location(expr->sourceRange().end()), (SourceLocation{1, 6}));
 
         ASSERT_TRUE(expr->is<ast::BinaryExpr>());
         auto& binary = expr->cast<ast::BinaryExpr>();
@@ -810,7 +938,7 @@ TEST(Parser, stmt)
         Parser parser(tokenizer);
 
         parser.addStmtParser("{", [](auto& parser) {
-            auto start = parser.location();
+            auto start = parser.offset();
             parser.requireOther("{");
 
             ast::StmtPtrVector stmts;
@@ -818,7 +946,7 @@ TEST(Parser, stmt)
             while (!parser.isEmpty() && !parser.isOther("}"))
                 stmts.push_back(parser.parseStmt());
 
-            auto end = parser.location();
+            auto end = parser.offset();
             parser.requireOther("}");
 
             return makeUnique<ast::CompoundStmt>(
@@ -829,8 +957,12 @@ TEST(Parser, stmt)
 
         ASSERT_TRUE(stmt->is<ast::CompoundStmt>());
         auto& compound = stmt->cast<ast::CompoundStmt>();
-        EXPECT_EQ(compound.sourceRange().start(), (SourceLocation{1, 1}));
-        EXPECT_EQ(compound.sourceRange().end(), (SourceLocation{1, 2}));
+        EXPECT_EQ(
+            source.location(compound.sourceRange().start()),
+            (SourceLocation{1, 1}));
+        EXPECT_EQ(
+            source.location(compound.sourceRange().end()),
+            (SourceLocation{1, 2}));
 
         EXPECT_TRUE(compound.stmts().empty());
 
@@ -844,7 +976,7 @@ TEST(Parser, stmt)
         Parser parser(tokenizer);
 
         parser.addStmtParser("{", [](auto& parser) {
-            auto start = parser.location();
+            auto start = parser.offset();
             parser.requireOther("{");
 
             ast::StmtPtrVector stmts;
@@ -852,7 +984,7 @@ TEST(Parser, stmt)
             while (!parser.isEmpty() && !parser.isOther("}"))
                 stmts.push_back(parser.parseStmt());
 
-            auto end = parser.location();
+            auto end = parser.offset();
             parser.requireOther("}");
 
             return makeUnique<ast::CompoundStmt>(
@@ -864,7 +996,7 @@ TEST(Parser, stmt)
             parser.requireIdentifier("var");
             parser.checkIdentifier();
 
-            auto name = parser.token().value();
+            auto name = String(parser.token().value());
 
             parser.next();
             parser.requireOther("=");
@@ -883,8 +1015,12 @@ TEST(Parser, stmt)
 
         ASSERT_TRUE(stmt->is<ast::CompoundStmt>());
         const auto& compound = stmt->cast<ast::CompoundStmt>();
-        EXPECT_EQ(compound.sourceRange().start(), (SourceLocation{1, 1}));
-        EXPECT_EQ(compound.sourceRange().end(), (SourceLocation{1, 15}));
+        EXPECT_EQ(
+            source.location(compound.sourceRange().start()),
+            (SourceLocation{1, 1}));
+        EXPECT_EQ(
+            source.location(compound.sourceRange().end()),
+            (SourceLocation{1, 15}));
 
         ASSERT_EQ(compound.stmts().size(), 1);
         const auto& stmts = compound.stmts();
@@ -974,3 +1110,131 @@ TEST(Parser, source)
 }
 
 /* ************************************************************************* */
+
+TEST(Parser, rewind)
+{
+    tokenizer::Source source("a + (b)");
+    tokenizer::Tokenizer tokenizer(source);
+    Parser parser(tokenizer);
+
+    ASSERT_EQ(parser.tokens().size(), 5);
+    EXPECT_EQ(parser.peek().value(), "+");
+    EXPECT_EQ(parser.peek(3).value(), "b");
+
+    const auto position = parser.position();
+    auto expr           = parser.parseExpr();
+    EXPECT_TRUE(expr->is<ast::IdentifierExpr>());
+    EXPECT_EQ(parser.token().value(), "+");
+    EXPECT_EQ(parser.previousEnd(), 1);
+
+    parser.rewind(position);
+    EXPECT_FALSE(parser.isEmpty());
+    EXPECT_EQ(parser.token().value(), "a");
+    EXPECT_EQ(parser.previousEnd(), 0);
+
+    parser.addBinaryOperator("+");
+    expr = parser.parseExpr();
+    ASSERT_TRUE(expr->is<ast::BinaryExpr>());
+    EXPECT_EQ(expr->sourceRange().end(), 7);
+    EXPECT_TRUE(parser.isEmpty());
+}
+
+/* ************************************************************************* */
+
+TEST(Parser, operators)
+{
+    tokenizer::Source source("a == b");
+    tokenizer::Tokenizer tokenizer(source);
+    Parser parser(tokenizer);
+
+    EXPECT_THROW(parser.addBinaryOperator("=>"), std::invalid_argument);
+
+    parser.addBinaryOperator(tokenizer::Operator::EqualEqual);
+    const auto& operators = parser.binaryOperators();
+    const auto equalEqual =
+        operators[static_cast<std::size_t>(tokenizer::Operator::EqualEqual)];
+    const auto equal =
+        operators[static_cast<std::size_t>(tokenizer::Operator::Equal)];
+
+    EXPECT_EQ(equalEqual.precedence, 9);
+    EXPECT_EQ(equalEqual.associativity, Associativity::Left);
+    EXPECT_EQ(equal.precedence, 0);
+
+    auto expr = parser.parseExpr();
+    ASSERT_TRUE(expr->is<ast::BinaryExpr>());
+    EXPECT_EQ(expr->cast<ast::BinaryExpr>().op(), "==");
+    EXPECT_TRUE(parser.isEmpty());
+}
+
+/* ************************************************************************* */
+
+TEST(Parser, precedence)
+{
+    // Left associative chain
+    {
+        String text = "0";
+
+        for (int i = 1; i < 10000; ++i)
+            text += " + " + std::to_string(i);
+
+        tokenizer::Source source(text);
+        tokenizer::Tokenizer tokenizer(source);
+        Parser parser(tokenizer);
+        parser.addBinaryOperator("+");
+
+        auto expr = parser.parseExpr();
+        EXPECT_TRUE(parser.isEmpty());
+
+        // Left spine holds all terms
+        int value = 9999;
+        ViewPtr<const ast::Expr> current = expr.get();
+
+        while (current->is<ast::BinaryExpr>())
+        {
+            const auto& binary = current->cast<ast::BinaryExpr>();
+            ASSERT_TRUE(binary.rhs()->is<ast::IntLiteralExpr>());
+            EXPECT_EQ(binary.rhs()->cast<ast::IntLiteralExpr>().value(), value);
+
+            current = binary.lhs().get();
+            --value;
+        }
+
+        EXPECT_EQ(value, 0);
+        ASSERT_TRUE(current->is<ast::IntLiteralExpr>());
+        EXPECT_EQ(current->cast<ast::IntLiteralExpr>().value(), 0);
+    }
+
+    // Custom table: a - b * c - d = e = f
+    {
+        tokenizer::Source source("a - b * c - d = e = f");
+        tokenizer::Tokenizer tokenizer(source);
+        Parser parser(tokenizer);
+        parser.addBinaryOperator("-", {10, Associativity::Left});
+        parser.addBinaryOperator("*", {20, Associativity::Left});
+        parser.addBinaryOperator("=");
+
+        auto expr = parser.parseExpr();
+        EXPECT_TRUE(parser.isEmpty());
+
+        // (((a - (b * c)) - d) = (e = f))
+        ASSERT_TRUE(expr->is<ast::BinaryExpr>());
+        const auto& assign = expr->cast<ast::BinaryExpr>();
+        EXPECT_EQ(assign.op(), "=");
+        ASSERT_TRUE(assign.rhs()->is<ast::BinaryExpr>());
+        EXPECT_EQ(assign.rhs()->cast<ast::BinaryExpr>().op(), "=");
+
+        ASSERT_TRUE(assign.lhs()->is<ast::BinaryExpr>());
+        const auto& sub1 = assign.lhs()->cast<ast::BinaryExpr>();
+        EXPECT_EQ(sub1.op(), "-");
+        ASSERT_TRUE(sub1.rhs()->is<ast::IdentifierExpr>());
+        EXPECT_EQ(sub1.rhs()->cast<ast::IdentifierExpr>().name(), "d");
+
+        ASSERT_TRUE(sub1.lhs()->is<ast::BinaryExpr>());
+        const auto& sub2 = sub1.lhs()->cast<ast::BinaryExpr>();
+        EXPECT_EQ(sub2.op(), "-");
+        ASSERT_TRUE(sub2.rhs()->is<ast::BinaryExpr>());
+        EXPECT_EQ(sub2.rhs()->cast<ast::BinaryExpr>().op(), "*");
+    }
+}
+
+/* ************************************************************************* */
@@ -0,0 +1,46 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// GTest
+#include "gtest/gtest.h"
+
+// Shard
+#include "shard/tokenizer/CharClass.hpp"
+
+/* ************************************************************************* */
+
+using namespace shard::tokenizer;
+
+/* ************************************************************************* */
+
+TEST(CharClass, table)
+{
+    for (int i = 0; i < 256; ++i)
+    {
+        const char chr = static_cast<char>(i);
+
+        const bool letter = (i >= 'a' && i <= 'z') || (i >= 'A' && i <= 'Z');
+        const bool digit  = i >= '0' && i <= '9';
+
+        EXPECT_EQ(chars::isLetter(chr), letter) << i;
+        EXPECT_EQ(chars::isDigit(chr), digit) << i;
+        EXPECT_EQ(chars::isIdentifierStart(chr), letter || i == '_') << i;
+        EXPECT_EQ(chars::isIdentifier(chr), letter || digit || i == '_') << i;
+        EXPECT_EQ(chars::isWhitespace(chr), i == ' ' || i == '\t') << i;
+    }
+}
+
+/* ************************************************************************* */
@@ -0,0 +1,147 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// C++
+#include <sstream>
+#include <stdexcept>
+#include <streambuf>
+#include <system_error>
+#include <utility>
+
+// GTest
+#include "gtest/gtest.h"
+
+// Shard
+#include "shard/tokenizer/ChunkReader.hpp"
+
+/* ************************************************************************* */
+
+using namespace shard;
+using namespace shard::tokenizer;
+
+/* ************************************************************************* */
+
+namespace {
+
+/* ************************************************************************* */
+
+String readAll(const String& input, std::size_t chunkSize)
+{
+    std::istringstream stream(input);
+    ChunkReader reader(stream, chunkSize);
+
+    String output;
+
+    while (reader.read(output) != 0)
+        continue;
+
+    EXPECT_TRUE(reader.isEmpty());
+
+    return output;
+}
+
+/* ************************************************************************* */
+
+/// Stream buffer which fails after its data.
+class FailingBuffer : public std::streambuf
+{
+public:
+    explicit FailingBuffer(String data)
+        : m_data(std::move(data))
+    {
+        setg(m_data.data(), m_data.data(), m_data.data() + m_data.size());
+    }
+
+protected:
+    int_type underflow() override
+    {
+        throw std::runtime_error("device error");
+    }
+
+private:
+    String m_data;
+};
+
+/* ************************************************************************* */
+
+} // namespace
+
+/* ************************************************************************* */
+
+TEST(ChunkReader, read)
+{
+    for (std::size_t chunkSize = 1; chunkSize < 8; ++chunkSize)
+    {
+        EXPECT_EQ(readAll("", chunkSize), "");
+        EXPECT_EQ(readAll("hello world", chunkSize), "hello world");
+        EXPECT_EQ(readAll("a\r\nb\r\n\r\nc", chunkSize), "a\nb\n\nc");
+        EXPECT_EQ(readAll("a\rb\r\r\nc\r", chunkSize), "a\rb\r\nc\r");
+        EXPECT_EQ(readAll("\r", chunkSize), "\r");
+    }
+}
+
+/* ************************************************************************* */
+
+TEST(ChunkReader, chunks)
+{
+    std::istringstream stream("abcdefg");
+    ChunkReader reader(stream, 3);
+
+    String output;
+    EXPECT_EQ(reader.read(output), 3);
+    EXPECT_EQ(output, "abc");
+    EXPECT_EQ(reader.read(output), 3);
+    EXPECT_EQ(reader.read(output), 1);
+    EXPECT_EQ(output, "abcdefg");
+    EXPECT_FALSE(reader.isEmpty());
+    EXPECT_EQ(reader.read(output), 0);
+    EXPECT_TRUE(reader.isEmpty());
+}
+
+/* ************************************************************************* */
+
+TEST(ChunkReader, error)
+{
+    FailingBuffer buffer("abc");
+    std::istream stream(&buffer);
+    ChunkReader reader(stream, 2);
+
+    String output;
+    EXPECT_EQ(reader.read(output), 2);
+    EXPECT_THROW(reader.read(output), std::system_error);
+    EXPECT_TRUE(reader.isFailed());
+    EXPECT_FALSE(reader.isEmpty());
+
+    // Failure is not reported as end of input
+    EXPECT_THROW(reader.read(output), std::system_error);
+    EXPECT_EQ(output, "ab");
+}
+
+/* ************************************************************************* */
+
+#if defined(__unix__) || defined(__APPLE__)
+TEST(ChunkReader, errorDescriptor)
+{
+    ChunkReader reader(-1);
+
+    String output;
+    EXPECT_THROW(reader.read(output), std::system_error);
+    EXPECT_TRUE(reader.isFailed());
+    EXPECT_FALSE(reader.isEmpty());
+}
+#endif
+
+/* ************************************************************************* */
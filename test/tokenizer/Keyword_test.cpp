@@ -0,0 +1,74 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// GTest
+#include "gtest/gtest.h"
+
+// Shard
+#include "shard/tokenizer/Keyword.hpp"
+#include "shard/tokenizer/Source.hpp"
+#include "shard/tokenizer/Tokenizer.hpp"
+
+/* ************************************************************************* */
+
+using namespace shard::tokenizer;
+
+/* ************************************************************************* */
+
+TEST(Keyword, find)
+{
+    for (std::size_t i = 1; i < KeywordCount; ++i)
+    {
+        const auto keyword = Keyword(i);
+        EXPECT_EQ(findKeyword(keywordName(keyword)), keyword);
+    }
+
+    EXPECT_EQ(findKeyword(""), Keyword::None);
+    EXPECT_EQ(findKeyword("i"), Keyword::None);
+    EXPECT_EQ(findKeyword("vat"), Keyword::None);
+    EXPECT_EQ(findKeyword("Var"), Keyword::None);
+    EXPECT_EQ(findKeyword("variable"), Keyword::None);
+    EXPECT_EQ(findKeyword("namespaces"), Keyword::None);
+}
+
+/* ************************************************************************* */
+
+TEST(Keyword, token)
+{
+    Source source("var value = func;");
+    Tokenizer tokenizer(source);
+
+    auto token = tokenizer.tokenize();
+    ASSERT_TRUE(token);
+    EXPECT_EQ(token->type(), TokenType::Identifier);
+    EXPECT_EQ(token->keyword(), Keyword::Var);
+
+    tokenizer.tokenize();
+    token = tokenizer.tokenize();
+    ASSERT_TRUE(token);
+    EXPECT_EQ(token->type(), TokenType::Identifier);
+    EXPECT_EQ(token->keyword(), Keyword::None);
+
+    tokenizer.tokenize();
+    tokenizer.tokenize();
+    tokenizer.tokenize();
+    token = tokenizer.tokenize();
+    ASSERT_TRUE(token);
+    EXPECT_EQ(token->value(), "func");
+    EXPECT_EQ(token->keyword(), Keyword::Func);
+}
+
+/* ************************************************************************* */
@@ -0,0 +1,81 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// GTest
+#include "gtest/gtest.h"
+
+// Shard
+#include "shard/tokenizer/Operator.hpp"
+#include "shard/tokenizer/Source.hpp"
+#include "shard/tokenizer/Tokenizer.hpp"
+
+/* ************************************************************************* */
+
+using namespace shard::tokenizer;
+
+/* ************************************************************************* */
+
+TEST(Operator, find)
+{
+    for (std::size_t i = 1; i < OperatorCount; ++i)
+    {
+        const auto op = Operator(i);
+        EXPECT_EQ(findOperator(operatorName(op)), op);
+    }
+
+    EXPECT_EQ(findOperator(""), Operator::None);
+    EXPECT_EQ(findOperator("@"), Operator::None);
+    EXPECT_EQ(findOperator("=>"), Operator::None);
+    EXPECT_EQ(findOperator("+++"), Operator::None);
+}
+
+/* ************************************************************************* */
+
+TEST(Operator, match)
+{
+    EXPECT_EQ(matchOperator("<<=1").op, Operator::LessLessEqual);
+    EXPECT_EQ(matchOperator("<<=1").length, 3);
+    EXPECT_EQ(matchOperator("<<1").op, Operator::LessLess);
+    EXPECT_EQ(matchOperator("<<1").length, 2);
+    EXPECT_EQ(matchOperator("+++").op, Operator::PlusPlus);
+    EXPECT_EQ(matchOperator("=>").op, Operator::Equal);
+    EXPECT_EQ(matchOperator("=>").length, 1);
+    EXPECT_EQ(matchOperator("a").op, Operator::None);
+    EXPECT_EQ(matchOperator("a").length, 0);
+}
+
+/* ************************************************************************* */
+
+TEST(Operator, token)
+{
+    Source source("a>=b->c@/=");
+    Tokenizer tokenizer(source);
+
+    auto tokens = tokenizer.tokenizeAll();
+
+    ASSERT_EQ(tokens.size(), 7);
+    EXPECT_EQ(tokens.op(0), Operator::None);
+    EXPECT_EQ(tokens.op(1), Operator::GreaterEqual);
+    EXPECT_EQ(tokens.value(1), ">=");
+    EXPECT_EQ(tokens.op(3), Operator::Arrow);
+    EXPECT_EQ(tokens.value(3), "->");
+    EXPECT_EQ(tokens.type(5), TokenType::Other);
+    EXPECT_EQ(tokens.op(5), Operator::None);
+    EXPECT_EQ(tokens.value(5), "@");
+    EXPECT_EQ(tokens.op(6), Operator::SlashEqual);
+}
+
+/* ************************************************************************* */
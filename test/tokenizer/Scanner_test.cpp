@@ -0,0 +1,124 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// GTest
+#include "gtest/gtest.h"
+
+// Shard
+#include "shard/String.hpp"
+#include "shard/tokenizer/Scanner.hpp"
+
+/* ************************************************************************* */
+
+using namespace shard;
+using namespace shard::tokenizer;
+
+/* ************************************************************************* */
+
+namespace {
+
+/* ************************************************************************* */
+
+/**
+ * @brief      Creates string with `count` copies of `fill` followed by `tail`.
+ */
+String make(std::size_t count, char fill, const String& tail)
+{
+    return String(count, fill) + tail;
+}
+
+/* ************************************************************************* */
+
+} // namespace
+
+/* ************************************************************************* */
+
+TEST(Scanner, whitespace)
+{
+    // Cover scalar tail and both vector widths
+    for (std::size_t count = 0; count < 100; ++count)
+    {
+        const auto text = make(count, ' ', "x ");
+        EXPECT_EQ(scanWhitespace(text.data(), 0, text.size()), count);
+
+        const auto tabs = make(count, '\t', "\n");
+        EXPECT_EQ(scanWhitespace(tabs.data(), 0, tabs.size()), count);
+
+        const auto all = String(count, ' ');
+        EXPECT_EQ(scanWhitespace(all.data(), 0, all.size()), count);
+    }
+
+    const String text = "a  \t b";
+    EXPECT_EQ(scanWhitespace(text.data(), 1, text.size()), 5);
+    EXPECT_EQ(scanWhitespace(text.data(), 1, 3), 3);
+}
+
+/* ************************************************************************* */
+
+TEST(Scanner, identifier)
+{
+    const String chars =
+        "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_";
+
+    EXPECT_EQ(scanIdentifier(chars.data(), 0, chars.size()), chars.size());
+
+    for (std::size_t count = 0; count < 100; ++count)
+    {
+        for (char stop : {' ', '@', '[', '`', '{', '/', ':', '\x80', '\0'})
+        {
+            const auto text = make(count, 'z', String(1, stop) + "abc");
+            EXPECT_EQ(scanIdentifier(text.data(), 0, text.size()), count);
+        }
+    }
+}
+
+/* ************************************************************************* */
+
+TEST(Scanner, until)
+{
+    for (std::size_t count = 0; count < 100; ++count)
+    {
+        const auto text = make(count, 'a', "\nb\n");
+        EXPECT_EQ(scanUntil(text.data(), 0, text.size(), '\n'), count);
+
+        const auto none = String(count, 'a');
+        EXPECT_EQ(scanUntil(none.data(), 0, none.size(), '\n'), count);
+    }
+
+    const String text = "a*b*c";
+    EXPECT_EQ(scanUntil(text.data(), 2, text.size(), '*'), 3);
+}
+
+/* ************************************************************************* */
+
+TEST(Scanner, untilAny)
+{
+    for (std::size_t count = 0; count < 100; ++count)
+    {
+        const auto quote = make(count, 'a', "\"\\");
+        EXPECT_EQ(
+            scanUntilAny(quote.data(), 0, quote.size(), '"', '\\'), count);
+
+        const auto escape = make(count, 'a', "\\\"");
+        EXPECT_EQ(
+            scanUntilAny(escape.data(), 0, escape.size(), '"', '\\'), count);
+
+        const auto none = String(count, 'a');
+        EXPECT_EQ(scanUntilAny(none.data(), 0, none.size(), '"', '\\'), count);
+    }
+}
+
+/* ************************************************************************* */
@@ -18,11 +18,15 @@
 #include "gtest/gtest.h"
 
 // C++
+#include <cstdio>
+#include <fstream>
 #include <stdexcept>
+#include <system_error>
 
 // Shard
 #include "shard/String.hpp"
 #include "shard/tokenizer/Source.hpp"
+#include "shard/tokenizer/Tokenizer.hpp"
 
 /* ************************************************************************* */
 
@@ -77,6 +81,44 @@ TEST(Source, basic)
 
 /* ************************************************************************* */
 
+TEST(Source, replace)
+{
+    String expected = "Hello World!\n";
+    Source source(expected);
+
+    // Edits move the gap back and forth
+    source.replace(6, 5, "everyone");
+    expected.replace(6, 5, "everyone");
+    EXPECT_EQ(source.gap(), 14);
+
+    source.replace(0, 5, "Hi");
+    expected.replace(0, 5, "Hi");
+    EXPECT_EQ(source.gap(), 2);
+
+    ASSERT_EQ(source.size(), expected.size());
+
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        EXPECT_EQ(source[i], expected[i]);
+        EXPECT_EQ(source.at(i), expected[i]);
+    }
+
+    EXPECT_EQ(source[expected.size()], '\0');
+    EXPECT_THROW(source.at(expected.size()), std::out_of_range);
+
+    // View across the gap
+    EXPECT_EQ(source.view(1, 4), "i ev");
+    EXPECT_EQ(source.view(8, 10), "one!\n");
+
+    source.replace(9, 1, "\nWorld");
+    expected.replace(9, 1, "\nWorld");
+
+    EXPECT_EQ(source.source(), expected);
+    EXPECT_EQ(source.location(10), (SourceLocation{2, 1}));
+}
+
+/* ************************************************************************* */
+
 TEST(Source, eol)
 {
     auto source = Source("Line1\n  Line2\r\n    Line3\n");
@@ -123,3 +165,75 @@ TEST(Source, locations)
 }
 
 /* ************************************************************************* */
+
+TEST(Source, fromFile)
+{
+    const auto path = FilePath(testing::TempDir()) / "Source_fromFile.shard";
+
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << "a // x\r\n  bc\r\n";
+    }
+
+    auto source = Source::fromFile(path);
+    ASSERT_TRUE(source);
+
+#if defined(__unix__) || defined(__APPLE__)
+    EXPECT_TRUE(source->isMapped());
+#endif
+
+    // Mapped source is not modified
+    EXPECT_EQ(source->source(), "a // x\r\n  bc\r\n");
+    EXPECT_EQ(source->filename(), path);
+    EXPECT_EQ((*source)[source->size()], '\0');
+
+    Tokenizer tokenizer(*source);
+
+    auto token = tokenizer.tokenize();
+    EXPECT_EQ(token->value(), "a");
+    tokenizer.tokenize();
+
+    token = tokenizer.tokenize();
+    EXPECT_EQ(token->type(), TokenType::Comment);
+    EXPECT_EQ(token->value(), " x");
+
+    tokenizer.tokenize();
+    token = tokenizer.tokenize();
+    EXPECT_EQ(token->value(), "bc");
+    EXPECT_EQ(source->location(token->offset()), (SourceLocation{2, 3}));
+
+    token = tokenizer.tokenize();
+    EXPECT_EQ(token->type(), TokenType::EndOfLine);
+    EXPECT_EQ(token->value(), "\r\n");
+
+    EXPECT_FALSE(tokenizer.tokenize());
+
+    source.reset();
+    std::remove(path.c_str());
+
+    EXPECT_FALSE(Source::fromFile(path));
+}
+
+/* ************************************************************************* */
+
+#if defined(__unix__) || defined(__APPLE__)
+TEST(Source, fromFileTooLarge)
+{
+    const auto path = FilePath(testing::TempDir()) / "Source_tooLarge.shard";
+
+    {
+        std::ofstream file(path, std::ios::binary);
+    }
+
+    // Sparse file, the content is never read
+    std::error_code error;
+    resize_file(path, Source::MaxSize + 1, error);
+
+    if (!error)
+        EXPECT_THROW(Source::fromFile(path), std::length_error);
+
+    std::remove(path.c_str());
+}
+#endif
+
+/* ************************************************************************* */
@@ -0,0 +1,144 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// C++
+#include <sstream>
+#include <stdexcept>
+#include <streambuf>
+#include <system_error>
+#include <utility>
+
+// GTest
+#include "gtest/gtest.h"
+
+// Shard
+#include "shard/tokenizer/Source.hpp"
+#include "shard/tokenizer/StreamTokenizer.hpp"
+#include "shard/tokenizer/Tokenizer.hpp"
+#include "shard/tokenizer/exceptions.hpp"
+
+/* ************************************************************************* */
+
+using namespace shard;
+using namespace shard::tokenizer;
+
+/* ************************************************************************* */
+
+namespace {
+
+/* ************************************************************************* */
+
+/// Stream buffer which fails after its data.
+class FailingBuffer : public std::streambuf
+{
+public:
+    explicit FailingBuffer(String data)
+        : m_data(std::move(data))
+    {
+        setg(m_data.data(), m_data.data(), m_data.data() + m_data.size());
+    }
+
+protected:
+    int_type underflow() override
+    {
+        throw std::runtime_error("device error");
+    }
+
+private:
+    String m_data;
+};
+
+/* ************************************************************************* */
+
+} // namespace
+
+/* ************************************************************************* */
+
+TEST(StreamTokenizer, chunks)
+{
+    const String code = "var value = 5;\r\n"
+                        "/* multi\nline */ func main() {\n"
+                        "    return \"str\\\"ing\" + 'c'; // comment\n"
+                        "}\n";
+
+    Source source(code);
+
+    for (std::size_t chunkSize = 1; chunkSize < 16; ++chunkSize)
+    {
+        std::istringstream stream(code);
+        ChunkReader reader(stream, chunkSize);
+        StreamTokenizer streamTokenizer(reader);
+
+        for (const auto& expected : Tokenizer(source))
+        {
+            auto token = streamTokenizer.tokenize();
+            ASSERT_TRUE(token);
+            EXPECT_EQ(token->type(), expected.type());
+            EXPECT_EQ(token->value(), expected.value());
+            EXPECT_EQ(token->offset(), expected.offset());
+            EXPECT_EQ(token->keyword(), expected.keyword());
+            EXPECT_EQ(
+                streamTokenizer.location(token->offset()),
+                source.location(expected.offset()));
+        }
+
+        EXPECT_FALSE(streamTokenizer.tokenize());
+    }
+}
+
+/* ************************************************************************* */
+
+TEST(StreamTokenizer, error)
+{
+    std::istringstream stream("a\nb /* unterminated\ncomment");
+    ChunkReader reader(stream, 4);
+    StreamTokenizer tokenizer(reader);
+
+    for (int i = 0; i < 4; ++i)
+        ASSERT_TRUE(tokenizer.tokenize());
+
+    try
+    {
+        tokenizer.tokenize();
+        FAIL();
+    }
+    catch (const TokenizerError& err)
+    {
+        EXPECT_EQ(err.location(), (SourceLocation{2, 3}));
+    }
+}
+
+/* ************************************************************************* */
+
+TEST(StreamTokenizer, readError)
+{
+    FailingBuffer buffer("a b");
+    std::istream stream(&buffer);
+    ChunkReader reader(stream, 2);
+    StreamTokenizer tokenizer(reader);
+
+    auto token = tokenizer.tokenize();
+    ASSERT_TRUE(token);
+    EXPECT_EQ(token->value(), "a");
+
+    // Whitespace may continue in the next chunk
+    EXPECT_THROW(tokenizer.tokenize(), std::system_error);
+
+    // Failed input is not treated as its end
+    EXPECT_THROW(tokenizer.tokenize(), std::system_error);
+}
+
+/* ************************************************************************* */
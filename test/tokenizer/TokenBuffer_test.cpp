@@ -0,0 +1,105 @@
+/* ************************************************************************* */
+/* This file is part of Shard.                                               */
+/*                                                                           */
+/* Shard is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU Affero General Public License as            */
+/* published by the Free Software Foundation.                                */
+/*                                                                           */
+/* This program is distributed in the hope that it will be useful,           */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of            */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the              */
+/* GNU Affero General Public License for more details.                       */
+/*                                                                           */
+/* You should have received a copy of the GNU Affero General Public License  */
+/* along with this program. If not, see <http://www.gnu.org/licenses/>.      */
+/* ************************************************************************* */
+
+// Google test
+#include "gtest/gtest.h"
+
+// Shard
+#include "shard/tokenizer/TokenBuffer.hpp"
+#include "shard/tokenizer/Tokenizer.hpp"
+
+/* ************************************************************************* */
+
+using namespace shard;
+using namespace shard::tokenizer;
+
+/* ************************************************************************* */
+
+TEST(TokenBuffer, empty)
+{
+    Source source(" \n// comment\n");
+    Tokenizer tokenizer(source);
+
+    auto tokens = tokenizer.tokenizeAll();
+
+    EXPECT_TRUE(tokens.isEmpty());
+    EXPECT_EQ(tokens.size(), 0);
+    EXPECT_EQ(&tokens.source(), &source);
+}
+
+/* ************************************************************************* */
+
+TEST(TokenBuffer, tokenizeAll)
+{
+    Source source("var s = \"a b\";  // x\nif 'c'\n");
+    Tokenizer tokenizer(source);
+
+    auto tokens = tokenizer.tokenizeAll();
+
+    ASSERT_EQ(tokens.size(), 7);
+
+    EXPECT_EQ(tokens.type(0), TokenType::Identifier);
+    EXPECT_EQ(tokens.keyword(0), Keyword::Var);
+    EXPECT_EQ(tokens.value(0), "var");
+    EXPECT_EQ(tokens.offset(0), 0);
+    EXPECT_EQ(tokens.end(0), 3);
+
+    EXPECT_EQ(tokens.type(1), TokenType::Identifier);
+    EXPECT_EQ(tokens.keyword(1), Keyword::None);
+    EXPECT_EQ(tokens.value(1), "s");
+    EXPECT_EQ(tokens.symbol(1), Symbol("s"));
+    EXPECT_EQ(tokens.symbol(0), "var");
+    EXPECT_TRUE(tokens.symbol(2).empty());
+
+    EXPECT_EQ(tokens.type(2), TokenType::Other);
+    EXPECT_EQ(tokens.value(2), "=");
+
+    EXPECT_EQ(tokens.type(3), TokenType::StringLiteral);
+    EXPECT_EQ(tokens.value(3), "a b");
+    EXPECT_EQ(tokens.offset(3), 8);
+    EXPECT_EQ(tokens.end(3), 13);
+
+    EXPECT_EQ(tokens.type(4), TokenType::Other);
+    EXPECT_EQ(tokens.value(4), ";");
+
+    EXPECT_EQ(tokens.keyword(5), Keyword::If);
+    EXPECT_EQ(source.location(tokens.offset(5)), (SourceLocation{2, 1}));
+
+    auto token = tokens.token(6);
+    EXPECT_EQ(token.type(), TokenType::CharLiteral);
+    EXPECT_EQ(token.value(), "c");
+    EXPECT_EQ(token.offset(), 24);
+    EXPECT_EQ(tokens.end(6), 27);
+}
+
+/* ************************************************************************* */
+
+TEST(TokenBuffer, push)
+{
+    Source source("a  b");
+    TokenBuffer tokens(source);
+
+    tokens.push(Token(TokenType::Identifier, source.view(0, 1), 0));
+    tokens.push(Token(TokenType::WhiteSpace, source.view(1, 2), 1));
+    tokens.push(Token(TokenType::Identifier, source.view(3, 1), 3));
+
+    ASSERT_EQ(tokens.size(), 2);
+    EXPECT_EQ(tokens.value(0), "a");
+    EXPECT_EQ(tokens.value(1), "b");
+    EXPECT_EQ(tokens.offset(1), 3);
+}
+
+/* ************************************************************************* */
@@ -45,40 +45,40 @@ TEST(TokenFilterIterator, whiteSpace)
     EXPECT_NE(it, end);
     EXPECT_EQ(it->type(), TokenType::Identifier);
     EXPECT_EQ(it->value(), "var");
-    EXPECT_EQ(it->location(), (SourceLocation{1, 1}));
+    EXPECT_EQ(source.location(it->offset()), (SourceLocation{1, 1}));
     EXPECT_EQ((*it).type(), TokenType::Identifier);
     EXPECT_EQ((*it).value(), "var");
-    EXPECT_EQ((*it).location(), (SourceLocation{1, 1}));
+    EXPECT_EQ(source.location((*it).offset()), (SourceLocation{1, 1}));
 
     ++it;
     EXPECT_NE(it, end);
     EXPECT_EQ(it->type(), TokenType::Identifier);
     EXPECT_EQ(it->value(), "i");
-    EXPECT_EQ(it->location(), (SourceLocation{1, 5}));
+    EXPECT_EQ(source.location(it->offset()), (SourceLocation{1, 5}));
 
     ++it;
     EXPECT_NE(it, end);
     EXPECT_EQ(it->type(), TokenType::Other);
     EXPECT_EQ(it->value(), "=");
-    EXPECT_EQ(it->location(), (SourceLocation{1, 7}));
+    EXPECT_EQ(source.location(it->offset()), (SourceLocation{1, 7}));
 
     ++it;
     EXPECT_NE(it, end);
     EXPECT_EQ(it->type(), TokenType::NumberLiteral);
     EXPECT_EQ(it->value(), "8");
-    EXPECT_EQ(it->location(), (SourceLocation{1, 9}));
+    EXPECT_EQ(source.location(it->offset()), (SourceLocation{1, 9}));
 
     auto it2 = it++;
     EXPECT_NE(it, end);
     EXPECT_EQ(it->type(), TokenType::Other);
     EXPECT_EQ(it->value(), ";");
-    EXPECT_EQ(it->location(), (SourceLocation{1, 10}));
+    EXPECT_EQ(source.location(it->offset()), (SourceLocation{1, 10}));
 
     // Copied iterator
     EXPECT_NE(it2, end);
     EXPECT_EQ(it2->type(), TokenType::NumberLiteral);
     EXPECT_EQ(it2->value(), "8");
-    EXPECT_EQ(it2->location(), (SourceLocation{1, 9}));
+    EXPECT_EQ(source.location(it2->offset()), (SourceLocation{1, 9}));
 
     ++it;
     EXPECT_EQ(it, end);
@@ -106,76 +106,76 @@ TEST(TokenFilterIterator, multiple)
     EXPECT_NE(it, end);
     EXPECT_EQ(it->type(), TokenType::Identifier);
     EXPECT_EQ(it->value(), "var");
-    EXPECT_EQ(it->location(), (SourceLocation{1, 1}));
+    EXPECT_EQ(source.location(it->offset()), (SourceLocation{1, 1}));
     EXPECT_EQ((*it).type(), TokenType::Identifier);
     EXPECT_EQ((*it).value(), "var");
-    EXPECT_EQ((*it).location(), (SourceLocation{1, 1}));
+    EXPECT_EQ(source.location((*it).offset()), (SourceLocation{1, 1}));
 
     ++it;
     EXPECT_NE(it, end);
     EXPECT_EQ(it->type(), TokenType::Identifier);
     EXPECT_EQ(it->value(), "i");
-    EXPECT_EQ(it->location(), (SourceLocation{1, 5}));
+    EXPECT_EQ(source.location(it->offset()), (SourceLocation{1, 5}));
 
     ++it;
     EXPECT_NE(it, end);
     EXPECT_EQ(it->type(), TokenType::Other);
     EXPECT_EQ(it->value(), "=");
-    EXPECT_EQ(it->location(), (SourceLocation{1, 7}));
+    EXPECT_EQ(source.location(it->offset()), (SourceLocation{1, 7}));
 
     ++it;
     EXPECT_NE(it, end);
     EXPECT_EQ(it->type(), TokenType::NumberLiteral);
     EXPECT_EQ(it->value(), "8");
-    EXPECT_EQ(it->location(), (SourceLocation{1, 9}));
+    EXPECT_EQ(source.location(it->offset()), (SourceLocation{1, 9}));
 
     auto it2 = it++;
     EXPECT_NE(it, end);
     EXPECT_EQ(it->type(), TokenType::Other);
     EXPECT_EQ(it->value(), ";");
-    EXPECT_EQ(it->location(), (SourceLocation{1, 10}));
+    EXPECT_EQ(source.location(it->offset()), (SourceLocation{1, 10}));
 
     // Copied iterator
     EXPECT_NE(it2, end);
     EXPECT_EQ(it2->type(), TokenType::NumberLiteral);
     EXPECT_EQ(it2->value(), "8");
-    EXPECT_EQ(it2->location(), (SourceLocation{1, 9}));
+    EXPECT_EQ(source.location(it2->offset()), (SourceLocation{1, 9}));
 
     ++it;
     EXPECT_NE(it, end);
     EXPECT_EQ(it->type(), TokenType::Identifier);
     EXPECT_EQ(it->value(), "i");
-    EXPECT_EQ(it->location(), (SourceLocation{2, 1}));
+    EXPECT_EQ(source.location(it->offset()), (SourceLocation{2, 1}));
 
     ++it;
     EXPECT_NE(it, end);
     EXPECT_EQ(it->type(), TokenType::Other);
     EXPECT_EQ(it->value(), "=");
-    EXPECT_EQ(it->location(), (SourceLocation{2, 3}));
+    EXPECT_EQ(source.location(it->offset()), (SourceLocation{2, 3}));
 
     ++it;
     EXPECT_NE(it, end);
     EXPECT_EQ(it->type(), TokenType::Identifier);
     EXPECT_EQ(it->value(), "i");
-    EXPECT_EQ(it->location(), (SourceLocation{2, 5}));
+    EXPECT_EQ(source.location(it->offset()), (SourceLocation{2, 5}));
 
     ++it;
     EXPECT_NE(it, end);
     EXPECT_EQ(it->type(), TokenType::Other);
     EXPECT_EQ(it->value(), "*");
-    EXPECT_EQ(it->location(), (SourceLocation{2, 7}));
+    EXPECT_EQ(source.location(it->offset()), (SourceLocation{2, 7}));
 
     ++it;
     EXPECT_NE(it, end);
     EXPECT_EQ(it->type(), TokenType::NumberLiteral);
     EXPECT_EQ(it->value(), "2");
-    EXPECT_EQ(it->location(), (SourceLocation{2, 9}));
+    EXPECT_EQ(source.location(it->offset()), (SourceLocation{2, 9}));
 
     ++it;
     EXPECT_NE(it, end);
     EXPECT_EQ(it->type(), TokenType::Other);
     EXPECT_EQ(it->value(), ";");
-    EXPECT_EQ(it->location(), (SourceLocation{2, 10}));
+    EXPECT_EQ(source.location(it->offset()), (SourceLocation{2, 10}));
 
     ++it;
     EXPECT_EQ(it, end);
@@ -33,31 +33,44 @@ TEST(Token, def)
 
     EXPECT_EQ(token.type(), TokenType::Unknown);
     EXPECT_EQ(token.value(), "");
-    EXPECT_EQ(token.location(), (SourceLocation{0, 0}));
+    EXPECT_EQ(token.offset(), 0);
 }
 
 /* ************************************************************************* */
 
 TEST(Token, construct)
 {
-    Token token{TokenType::Identifier, "var", SourceLocation{5, 10}};
+    Token token{TokenType::Identifier, "var", 42};
 
     EXPECT_EQ(token.type(), TokenType::Identifier);
     EXPECT_EQ(token.value(), "var");
-    EXPECT_EQ(token.location(), (SourceLocation{5, 10}));
+    EXPECT_EQ(token.offset(), 42);
 
     // Copy
     Token token2 = token;
 
     EXPECT_EQ(token2.type(), TokenType::Identifier);
     EXPECT_EQ(token2.value(), "var");
-    EXPECT_EQ(token2.location(), (SourceLocation{5, 10}));
+    EXPECT_EQ(token2.offset(), 42);
 
-    token = Token{TokenType::NumberLiteral, "15", SourceLocation{1, 3}};
+    token = Token{TokenType::NumberLiteral, "15", 2};
 
     EXPECT_EQ(token.type(), TokenType::NumberLiteral);
     EXPECT_EQ(token.value(), "15");
-    EXPECT_EQ(token.location(), (SourceLocation{1, 3}));
+    EXPECT_EQ(token.offset(), 2);
+}
+
+/* ************************************************************************* */
+
+TEST(Token, decoded)
+{
+    Token token{TokenType::StringLiteral, "a\\tb\\\\", 0};
+
+    EXPECT_EQ(token.value(), "a\\tb\\\\");
+    EXPECT_EQ(token.decodedValue(), "a\tb\\");
+
+    EXPECT_EQ(Token::escape('n'), '\n');
+    EXPECT_FALSE(Token::escape('q'));
 }
 
 /* ************************************************************************* */
@@ -43,61 +43,61 @@ TEST(TokenizerIterator, def)
     EXPECT_NE(it, end);
     EXPECT_EQ(it->type(), TokenType::Identifier);
     EXPECT_EQ(it->value(), "var");
-    EXPECT_EQ(it->location(), (SourceLocation{1, 1}));
+    EXPECT_EQ(source.location(it->offset()), (SourceLocation{1, 1}));
     EXPECT_EQ((*it).type(), TokenType::Identifier);
     EXPECT_EQ((*it).value(), "var");
-    EXPECT_EQ((*it).location(), (SourceLocation{1, 1}));
+    EXPECT_EQ(source.location((*it).offset()), (SourceLocation{1, 1}));
 
     ++it;
     EXPECT_NE(it, end);
     EXPECT_EQ(it->type(), TokenType::WhiteSpace);
     EXPECT_EQ(it->value(), " ");
-    EXPECT_EQ(it->location(), (SourceLocation{1, 4}));
+    EXPECT_EQ(source.location(it->offset()), (SourceLocation{1, 4}));
     EXPECT_EQ((*it).type(), TokenType::WhiteSpace);
     EXPECT_EQ((*it).value(), " ");
-    EXPECT_EQ((*it).location(), (SourceLocation{1, 4}));
+    EXPECT_EQ(source.location((*it).offset()), (SourceLocation{1, 4}));
 
     ++it;
     EXPECT_NE(it, end);
     EXPECT_EQ(it->type(), TokenType::Identifier);
     EXPECT_EQ(it->value(), "i");
-    EXPECT_EQ(it->location(), (SourceLocation{1, 5}));
+    EXPECT_EQ(source.location(it->offset()), (SourceLocation{1, 5}));
 
     ++it;
     EXPECT_NE(it, end);
     EXPECT_EQ(it->type(), TokenType::WhiteSpace);
     EXPECT_EQ(it->value(), " ");
-    EXPECT_EQ(it->location(), (SourceLocation{1, 6}));
+    EXPECT_EQ(source.location(it->offset()), (SourceLocation{1, 6}));
 
     ++it;
     EXPECT_NE(it, end);
     EXPECT_EQ(it->type(), TokenType::Other);
     EXPECT_EQ(it->value(), "=");
-    EXPECT_EQ(it->location(), (SourceLocation{1, 7}));
+    EXPECT_EQ(source.location(it->offset()), (SourceLocation{1, 7}));
 
     ++it;
     EXPECT_NE(it, end);
     EXPECT_EQ(it->type(), TokenType::WhiteSpace);
     EXPECT_EQ(it->value(), " ");
-    EXPECT_EQ(it->location(), (SourceLocation{1, 8}));
+    EXPECT_EQ(source.location(it->offset()), (SourceLocation{1, 8}));
 
     ++it;
     EXPECT_NE(it, end);
     EXPECT_EQ(it->type(), TokenType::NumberLiteral);
     EXPECT_EQ(it->value(), "8");
-    EXPECT_EQ(it->location(), (SourceLocation{1, 9}));
+    EXPECT_EQ(source.location(it->offset()), (SourceLocation{1, 9}));
 
     auto it2 = it++;
     EXPECT_NE(it, end);
     EXPECT_EQ(it->type(), TokenType::Other);
     EXPECT_EQ(it->value(), ";");
-    EXPECT_EQ(it->location(), (SourceLocation{1, 10}));
+    EXPECT_EQ(source.location(it->offset()), (SourceLocation{1, 10}));
 
     // Copied iterator
     EXPECT_NE(it2, end);
     EXPECT_EQ(it2->type(), TokenType::NumberLiteral);
     EXPECT_EQ(it2->value(), "8");
-    EXPECT_EQ(it2->location(), (SourceLocation{1, 9}));
+    EXPECT_EQ(source.location(it2->offset()), (SourceLocation{1, 9}));
 
     ++it;
     EXPECT_EQ(it, end);
@@ -17,8 +17,13 @@
 // Google test
 #include "gtest/gtest.h"
 
+// C++
+#include <algorithm>
+#include <string>
+
 // Shard
 #include "shard/String.hpp"
+#include "shard/Vector.hpp"
 #include "shard/tokenizer/Tokenizer.hpp"
 #include "shard/tokenizer/exceptions.hpp"
 
@@ -92,7 +97,7 @@ TEST(Tokenizer, identifier)
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::Identifier);
         EXPECT_EQ(token->value(), "hello");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 1}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 1}));
 
         token = tokenizer.tokenize();
         EXPECT_FALSE(token);
@@ -106,7 +111,7 @@ TEST(Tokenizer, identifier)
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::Identifier);
         EXPECT_EQ(token->value(), "HelloWorld");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 1}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 1}));
 
         token = tokenizer.tokenize();
         EXPECT_FALSE(token);
@@ -120,7 +125,7 @@ TEST(Tokenizer, identifier)
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::Identifier);
         EXPECT_EQ(token->value(), "Hello_World_01");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 1}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 1}));
 
         token = tokenizer.tokenize();
         EXPECT_FALSE(token);
@@ -134,7 +139,7 @@ TEST(Tokenizer, identifier)
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::Identifier);
         EXPECT_EQ(token->value(), "_0123456");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 1}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 1}));
 
         token = tokenizer.tokenize();
         EXPECT_FALSE(token);
@@ -148,7 +153,7 @@ TEST(Tokenizer, identifier)
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::Identifier);
         EXPECT_EQ(token->value(), "a_0_123456zi");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 1}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 1}));
 
         token = tokenizer.tokenize();
         EXPECT_FALSE(token);
@@ -167,7 +172,7 @@ TEST(Tokenizer, number)
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::NumberLiteral);
         EXPECT_EQ(token->value(), "0");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 1}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 1}));
 
         token = tokenizer.tokenize();
         EXPECT_FALSE(token);
@@ -181,7 +186,7 @@ TEST(Tokenizer, number)
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::NumberLiteral);
         EXPECT_EQ(token->value(), "12345");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 1}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 1}));
 
         token = tokenizer.tokenize();
         EXPECT_FALSE(token);
@@ -195,7 +200,7 @@ TEST(Tokenizer, number)
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::NumberLiteral);
         EXPECT_EQ(token->value(), "0x123456");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 1}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 1}));
 
         token = tokenizer.tokenize();
         EXPECT_FALSE(token);
@@ -209,7 +214,7 @@ TEST(Tokenizer, number)
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::NumberLiteral);
         EXPECT_EQ(token->value(), "0b10011_01001");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 1}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 1}));
 
         token = tokenizer.tokenize();
         EXPECT_FALSE(token);
@@ -228,7 +233,7 @@ TEST(Tokenizer, string)
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::StringLiteral);
         EXPECT_EQ(token->value(), "");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 1}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 1}));
 
         token = tokenizer.tokenize();
         EXPECT_FALSE(token);
@@ -242,7 +247,7 @@ TEST(Tokenizer, string)
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::StringLiteral);
         EXPECT_EQ(token->value(), "Hello World!");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 1}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 1}));
 
         token = tokenizer.tokenize();
         EXPECT_FALSE(token);
@@ -255,8 +260,9 @@ TEST(Tokenizer, string)
         auto token = tokenizer.tokenize();
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::StringLiteral);
-        EXPECT_EQ(token->value(), "Hello\n\tWorld!\"quote\'");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 1}));
+        EXPECT_EQ(token->value(), "Hello\\n\\tWorld!\\\"quote\'");
+        EXPECT_EQ(token->decodedValue(), "Hello\n\tWorld!\"quote\'");
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 1}));
 
         token = tokenizer.tokenize();
         EXPECT_FALSE(token);
@@ -283,7 +289,7 @@ TEST(Tokenizer, character)
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::CharLiteral);
         EXPECT_EQ(token->value(), "A");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 1}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 1}));
 
         token = tokenizer.tokenize();
         EXPECT_FALSE(token);
@@ -296,8 +302,9 @@ TEST(Tokenizer, character)
         auto token = tokenizer.tokenize();
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::CharLiteral);
-        EXPECT_EQ(token->value(), "\n");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 1}));
+        EXPECT_EQ(token->value(), "\\n");
+        EXPECT_EQ(token->decodedValue(), "\n");
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 1}));
 
         token = tokenizer.tokenize();
         EXPECT_FALSE(token);
@@ -310,8 +317,9 @@ TEST(Tokenizer, character)
         auto token = tokenizer.tokenize();
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::CharLiteral);
-        EXPECT_EQ(token->value(), "\t");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 1}));
+        EXPECT_EQ(token->value(), "\\t");
+        EXPECT_EQ(token->decodedValue(), "\t");
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 1}));
 
         token = tokenizer.tokenize();
         EXPECT_FALSE(token);
@@ -324,8 +332,9 @@ TEST(Tokenizer, character)
         auto token = tokenizer.tokenize();
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::CharLiteral);
-        EXPECT_EQ(token->value(), "'");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 1}));
+        EXPECT_EQ(token->value(), "\\'");
+        EXPECT_EQ(token->decodedValue(), "'");
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 1}));
 
         token = tokenizer.tokenize();
         EXPECT_FALSE(token);
@@ -338,8 +347,9 @@ TEST(Tokenizer, character)
         auto token = tokenizer.tokenize();
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::CharLiteral);
-        EXPECT_EQ(token->value(), "\\");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 1}));
+        EXPECT_EQ(token->value(), "\\\\");
+        EXPECT_EQ(token->decodedValue(), "\\");
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 1}));
 
         token = tokenizer.tokenize();
         EXPECT_FALSE(token);
@@ -352,8 +362,9 @@ TEST(Tokenizer, character)
         auto token = tokenizer.tokenize();
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::CharLiteral);
-        EXPECT_EQ(token->value(), "\r");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 1}));
+        EXPECT_EQ(token->value(), "\\r");
+        EXPECT_EQ(token->decodedValue(), "\r");
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 1}));
 
         token = tokenizer.tokenize();
         EXPECT_FALSE(token);
@@ -366,8 +377,9 @@ TEST(Tokenizer, character)
         auto token = tokenizer.tokenize();
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::CharLiteral);
-        EXPECT_EQ(token->value(), "\n");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 1}));
+        EXPECT_EQ(token->value(), "\\n");
+        EXPECT_EQ(token->decodedValue(), "\n");
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 1}));
 
         token = tokenizer.tokenize();
         EXPECT_FALSE(token);
@@ -380,8 +392,9 @@ TEST(Tokenizer, character)
         auto token = tokenizer.tokenize();
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::CharLiteral);
-        EXPECT_EQ(token->value(), String("\0", 1));
-        EXPECT_EQ(token->location(), (SourceLocation{1, 1}));
+        EXPECT_EQ(token->value(), "\\0");
+        EXPECT_EQ(token->decodedValue(), String("\0", 1));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 1}));
 
         token = tokenizer.tokenize();
         EXPECT_FALSE(token);
@@ -432,7 +445,7 @@ TEST(Tokenizer, comment)
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::Comment);
         EXPECT_EQ(token->value(), " Hello World");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 1}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 1}));
 
         token = tokenizer.tokenize();
         EXPECT_FALSE(token);
@@ -446,7 +459,7 @@ TEST(Tokenizer, comment)
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::Comment);
         EXPECT_EQ(token->value(), " Hello World");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 1}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 1}));
 
         token = tokenizer.tokenize();
         EXPECT_FALSE(token);
@@ -460,7 +473,7 @@ TEST(Tokenizer, comment)
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::Comment);
         EXPECT_EQ(token->value(), " Hello\nWorld ");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 1}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 1}));
 
         token = tokenizer.tokenize();
         EXPECT_FALSE(token);
@@ -477,6 +490,35 @@ TEST(Tokenizer, comment)
 
 /* ************************************************************************* */
 
+TEST(Tokenizer, view)
+{
+    Source source("value = a / b; /* a*b */");
+    Tokenizer tokenizer(source);
+
+    // Values point into the source
+    auto token = tokenizer.tokenize();
+    ASSERT_TRUE(token);
+    EXPECT_EQ(token->value(), "value");
+    EXPECT_EQ(token->value().data(), source.source().data());
+
+    for (int i = 0; i < 6; ++i)
+        token = tokenizer.tokenize();
+
+    ASSERT_TRUE(token);
+    EXPECT_EQ(token->type(), TokenType::Other);
+    EXPECT_EQ(token->value(), "/");
+    EXPECT_EQ(token->value().data(), source.source().data() + 10);
+
+    for (int i = 0; i < 5; ++i)
+        token = tokenizer.tokenize();
+
+    ASSERT_TRUE(token);
+    EXPECT_EQ(token->type(), TokenType::Comment);
+    EXPECT_EQ(token->value(), " a*b ");
+}
+
+/* ************************************************************************* */
+
 TEST(Tokenizer, whitespace)
 {
     {
@@ -487,7 +529,7 @@ TEST(Tokenizer, whitespace)
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::WhiteSpace);
         EXPECT_EQ(token->value(), " ");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 1}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 1}));
 
         token = tokenizer.tokenize();
         EXPECT_FALSE(token);
@@ -501,7 +543,7 @@ TEST(Tokenizer, whitespace)
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::WhiteSpace);
         EXPECT_EQ(token->value(), "  \t \t   ");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 1}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 1}));
 
         token = tokenizer.tokenize();
         EXPECT_FALSE(token);
@@ -520,7 +562,7 @@ TEST(Tokenizer, endOfLine)
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::EndOfLine);
         EXPECT_EQ(token->value(), "\n");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 1}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 1}));
 
         token = tokenizer.tokenize();
         EXPECT_FALSE(token);
@@ -534,7 +576,7 @@ TEST(Tokenizer, endOfLine)
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::EndOfLine);
         EXPECT_EQ(token->value(), "\n");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 1}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 1}));
 
         token = tokenizer.tokenize();
         EXPECT_FALSE(token);
@@ -548,19 +590,19 @@ TEST(Tokenizer, endOfLine)
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::EndOfLine);
         EXPECT_EQ(token->value(), "\n");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 1}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 1}));
 
         token = tokenizer.tokenize();
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::EndOfLine);
         EXPECT_EQ(token->value(), "\n");
-        EXPECT_EQ(token->location(), (SourceLocation{2, 1}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{2, 1}));
 
         token = tokenizer.tokenize();
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::EndOfLine);
         EXPECT_EQ(token->value(), "\n");
-        EXPECT_EQ(token->location(), (SourceLocation{3, 1}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{3, 1}));
 
         token = tokenizer.tokenize();
         EXPECT_FALSE(token);
@@ -579,7 +621,7 @@ TEST(Tokenizer, other)
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::Other);
         EXPECT_EQ(token->value(), ";");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 1}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 1}));
 
         token = tokenizer.tokenize();
         EXPECT_FALSE(token);
@@ -593,7 +635,7 @@ TEST(Tokenizer, other)
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::Other);
         EXPECT_EQ(token->value(), "(");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 1}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 1}));
 
         token = tokenizer.tokenize();
         EXPECT_FALSE(token);
@@ -612,97 +654,92 @@ TEST(Tokenizer, multiple)
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::Identifier);
         EXPECT_EQ(token->value(), "var");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 1}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 1}));
 
         token = tokenizer.tokenize();
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::WhiteSpace);
         EXPECT_EQ(token->value(), " ");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 4}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 4}));
 
         token = tokenizer.tokenize();
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::Identifier);
         EXPECT_EQ(token->value(), "value");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 5}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 5}));
 
         token = tokenizer.tokenize();
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::WhiteSpace);
         EXPECT_EQ(token->value(), " ");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 10}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 10}));
 
         token = tokenizer.tokenize();
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::Other);
         EXPECT_EQ(token->value(), "=");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 11}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 11}));
 
         token = tokenizer.tokenize();
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::WhiteSpace);
         EXPECT_EQ(token->value(), " ");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 12}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 12}));
 
         token = tokenizer.tokenize();
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::NumberLiteral);
         EXPECT_EQ(token->value(), "5");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 13}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 13}));
 
         token = tokenizer.tokenize();
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::Other);
         EXPECT_EQ(token->value(), ";");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 14}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 14}));
 
         token = tokenizer.tokenize();
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::EndOfLine);
         EXPECT_EQ(token->value(), "\n");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 15}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 15}));
 
         token = tokenizer.tokenize();
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::Identifier);
         EXPECT_EQ(token->value(), "value");
-        EXPECT_EQ(token->location(), (SourceLocation{2, 1}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{2, 1}));
 
         token = tokenizer.tokenize();
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::WhiteSpace);
         EXPECT_EQ(token->value(), " ");
-        EXPECT_EQ(token->location(), (SourceLocation{2, 6}));
-
-        token = tokenizer.tokenize();
-        ASSERT_TRUE(token);
-        EXPECT_EQ(token->type(), TokenType::Other);
-        EXPECT_EQ(token->value(), "+");
-        EXPECT_EQ(token->location(), (SourceLocation{2, 7}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{2, 6}));
 
         token = tokenizer.tokenize();
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::Other);
-        EXPECT_EQ(token->value(), "=");
-        EXPECT_EQ(token->location(), (SourceLocation{2, 8}));
+        EXPECT_EQ(token->value(), "+=");
+        EXPECT_EQ(token->op(), Operator::PlusEqual);
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{2, 7}));
 
         token = tokenizer.tokenize();
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::WhiteSpace);
         EXPECT_EQ(token->value(), " ");
-        EXPECT_EQ(token->location(), (SourceLocation{2, 9}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{2, 9}));
 
         token = tokenizer.tokenize();
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::NumberLiteral);
         EXPECT_EQ(token->value(), "10");
-        EXPECT_EQ(token->location(), (SourceLocation{2, 10}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{2, 10}));
 
         token = tokenizer.tokenize();
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::Other);
         EXPECT_EQ(token->value(), ";");
-        EXPECT_EQ(token->location(), (SourceLocation{2, 12}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{2, 12}));
 
         token = tokenizer.tokenize();
         EXPECT_FALSE(token);
@@ -716,7 +753,7 @@ TEST(Tokenizer, multiple)
         ASSERT_TRUE(token);
         EXPECT_EQ(token->type(), TokenType::Other);
         EXPECT_EQ(token->value(), "(");
-        EXPECT_EQ(token->location(), (SourceLocation{1, 1}));
+        EXPECT_EQ(source.location(token->offset()), (SourceLocation{1, 1}));
 
         token = tokenizer.tokenize();
         EXPECT_FALSE(token);
@@ -733,72 +770,238 @@ TEST(Tokenizer, tokenize)
         Vector<Token> tokens;
         tokenize(source.begin(), source.end(), std::back_inserter(tokens));
 
-        ASSERT_EQ(tokens.size(), 16);
+        ASSERT_EQ(tokens.size(), 15);
 
         EXPECT_EQ(tokens[0].type(), TokenType::Identifier);
         EXPECT_EQ(tokens[0].value(), "var");
-        EXPECT_EQ(tokens[0].location(), (SourceLocation{1, 1}));
+        EXPECT_EQ(source.location(tokens[0].offset()), (SourceLocation{1, 1}));
 
         EXPECT_EQ(tokens[1].type(), TokenType::WhiteSpace);
         EXPECT_EQ(tokens[1].value(), " ");
-        EXPECT_EQ(tokens[1].location(), (SourceLocation{1, 4}));
+        EXPECT_EQ(source.location(tokens[1].offset()), (SourceLocation{1, 4}));
 
         EXPECT_EQ(tokens[2].type(), TokenType::Identifier);
         EXPECT_EQ(tokens[2].value(), "value");
-        EXPECT_EQ(tokens[2].location(), (SourceLocation{1, 5}));
+        EXPECT_EQ(source.location(tokens[2].offset()), (SourceLocation{1, 5}));
 
         EXPECT_EQ(tokens[3].type(), TokenType::WhiteSpace);
         EXPECT_EQ(tokens[3].value(), " ");
-        EXPECT_EQ(tokens[3].location(), (SourceLocation{1, 10}));
+        EXPECT_EQ(source.location(tokens[3].offset()), (SourceLocation{1, 10}));
 
         EXPECT_EQ(tokens[4].type(), TokenType::Other);
         EXPECT_EQ(tokens[4].value(), "=");
-        EXPECT_EQ(tokens[4].location(), (SourceLocation{1, 11}));
+        EXPECT_EQ(source.location(tokens[4].offset()), (SourceLocation{1, 11}));
 
         EXPECT_EQ(tokens[5].type(), TokenType::WhiteSpace);
         EXPECT_EQ(tokens[5].value(), " ");
-        EXPECT_EQ(tokens[5].location(), (SourceLocation{1, 12}));
+        EXPECT_EQ(source.location(tokens[5].offset()), (SourceLocation{1, 12}));
 
         EXPECT_EQ(tokens[6].type(), TokenType::NumberLiteral);
         EXPECT_EQ(tokens[6].value(), "5");
-        EXPECT_EQ(tokens[6].location(), (SourceLocation{1, 13}));
+        EXPECT_EQ(source.location(tokens[6].offset()), (SourceLocation{1, 13}));
 
         EXPECT_EQ(tokens[7].type(), TokenType::Other);
         EXPECT_EQ(tokens[7].value(), ";");
-        EXPECT_EQ(tokens[7].location(), (SourceLocation{1, 14}));
+        EXPECT_EQ(source.location(tokens[7].offset()), (SourceLocation{1, 14}));
 
         EXPECT_EQ(tokens[8].type(), TokenType::EndOfLine);
         EXPECT_EQ(tokens[8].value(), "\n");
-        EXPECT_EQ(tokens[8].location(), (SourceLocation{1, 15}));
+        EXPECT_EQ(source.location(tokens[8].offset()), (SourceLocation{1, 15}));
 
         EXPECT_EQ(tokens[9].type(), TokenType::Identifier);
         EXPECT_EQ(tokens[9].value(), "value");
-        EXPECT_EQ(tokens[9].location(), (SourceLocation{2, 1}));
+        EXPECT_EQ(source.location(tokens[9].offset()), (SourceLocation{2, 1}));
 
         EXPECT_EQ(tokens[10].type(), TokenType::WhiteSpace);
         EXPECT_EQ(tokens[10].value(), " ");
-        EXPECT_EQ(tokens[10].location(), (SourceLocation{2, 6}));
+        EXPECT_EQ(source.location(tokens[10].offset()), (SourceLocation{2, 6}));
 
         EXPECT_EQ(tokens[11].type(), TokenType::Other);
-        EXPECT_EQ(tokens[11].value(), "+");
-        EXPECT_EQ(tokens[11].location(), (SourceLocation{2, 7}));
+        EXPECT_EQ(tokens[11].value(), "+=");
+        EXPECT_EQ(source.location(tokens[11].offset()), (SourceLocation{2, 7}));
+
+        EXPECT_EQ(tokens[12].type(), TokenType::WhiteSpace);
+        EXPECT_EQ(tokens[12].value(), " ");
+        EXPECT_EQ(source.location(tokens[12].offset()), (SourceLocation{2, 9}));
+
+        EXPECT_EQ(tokens[13].type(), TokenType::NumberLiteral);
+        EXPECT_EQ(tokens[13].value(), "10");
+        EXPECT_EQ(
+            source.location(tokens[13].offset()), (SourceLocation{2, 10}));
+
+        EXPECT_EQ(tokens[14].type(), TokenType::Other);
+        EXPECT_EQ(tokens[14].value(), ";");
+        EXPECT_EQ(
+            source.location(tokens[14].offset()), (SourceLocation{2, 12}));
+    }
+}
+
+/* ************************************************************************* */
+
+TEST(Tokenizer, retokenize)
+{
+    struct Edit
+    {
+        std::uint32_t offset;
+        std::uint32_t length;
+        const char* text;
+    };
+
+    const String input = "var ab = 5;\nfunc f() { return \"x y\"; } // c\n";
+
+    const Edit edits[] = {
+        {0, 0, " "},      // Before first token
+        {5, 0, "c"},      // Extend identifier
+        {4, 3, "a"},      // Shrink identifier and drop whitespace
+        {7, 1, "=="},     // Longer operator
+        {11, 1, ""},      // Join lines
+        {12, 0, "/* */"}, // Comment before tokens
+        {20, 0, "//"},    // Comment out rest of line
+        {31, 2, "\" \""}, // Split string literal
+        {44, 0, "x\n"},   // Append after comment
+        {0, 44, "a"},     // Replace everything
+    };
+
+    for (const auto& edit : edits)
+    {
+        Source source(input);
+        Tokenizer tokenizer(source);
+        auto tokens = tokenizer.tokenizeAll();
+
+        String expected = input;
+        expected.replace(edit.offset, edit.length, edit.text);
 
-        EXPECT_EQ(tokens[12].type(), TokenType::Other);
-        EXPECT_EQ(tokens[12].value(), "=");
-        EXPECT_EQ(tokens[12].location(), (SourceLocation{2, 8}));
+        Source expectedSource(expected);
+        Tokenizer expectedTokenizer(expectedSource);
+        auto expectedTokens = expectedTokenizer.tokenizeAll();
 
-        EXPECT_EQ(tokens[13].type(), TokenType::WhiteSpace);
-        EXPECT_EQ(tokens[13].value(), " ");
-        EXPECT_EQ(tokens[13].location(), (SourceLocation{2, 9}));
+        retokenize(tokens, source, edit.offset, edit.length, edit.text);
 
-        EXPECT_EQ(tokens[14].type(), TokenType::NumberLiteral);
-        EXPECT_EQ(tokens[14].value(), "10");
-        EXPECT_EQ(tokens[14].location(), (SourceLocation{2, 10}));
+        SCOPED_TRACE(expected);
+        EXPECT_EQ(source.source(), expected);
+        ASSERT_EQ(source.lines().size(), expectedSource.lines().size());
 
-        EXPECT_EQ(tokens[15].type(), TokenType::Other);
-        EXPECT_EQ(tokens[15].value(), ";");
-        EXPECT_EQ(tokens[15].location(), (SourceLocation{2, 12}));
+        for (std::size_t i = 0; i < source.lines().size(); ++i)
+        {
+            EXPECT_EQ(
+                source.lines().lineStart(i),
+                expectedSource.lines().lineStart(i));
+        }
+
+        ASSERT_EQ(tokens.size(), expectedTokens.size());
+
+        for (std::size_t i = 0; i < tokens.size(); ++i)
+        {
+            EXPECT_EQ(tokens.type(i), expectedTokens.type(i));
+            EXPECT_EQ(tokens.keyword(i), expectedTokens.keyword(i));
+            EXPECT_EQ(tokens.op(i), expectedTokens.op(i));
+            EXPECT_EQ(tokens.offset(i), expectedTokens.offset(i));
+            EXPECT_EQ(tokens.value(i), expectedTokens.value(i));
+        }
+    }
+}
+
+/* ************************************************************************* */
+
+TEST(Tokenizer, retokenizeLocal)
+{
+    String input;
+
+    for (int i = 0; i < 20000; ++i)
+    {
+        input += "var x" + std::to_string(i) + " = " + std::to_string(i);
+        input += i == 15000 ? " + \"" + String(100, 's') + "\";\n" : ";\n";
+    }
+
+    Source source(input);
+    Tokenizer tokenizer(source);
+    auto tokens = tokenizer.tokenizeAll();
+
+    String expected = input;
+
+    const auto edit = [&](std::uint32_t offset,
+                          std::uint32_t length,
+                          StringView text) {
+        // Tokens far after the edit and the previous one
+        const auto end  = std::max<std::size_t>(offset + length, source.gap());
+        const auto tail = tokens.lowerBound(end + 1000);
+        const auto count = tokens.size() - tail;
+
+        Vector<std::uint32_t> offsets;
+        Vector<const char*> values;
+
+        for (auto i = tail; i < tokens.size(); ++i)
+        {
+            offsets.push_back(tokens.offset(i));
+            values.push_back(tokens.value(i).data());
+        }
+
+        retokenize(tokens, source, offset, length, text);
+        expected.replace(offset, length, text.data(), text.size());
+
+        // The source after the edit is not scanned nor moved
+        EXPECT_LT(source.gap(), offset + text.size() + 200);
+
+        const std::int64_t delta = std::int64_t(text.size()) - length;
+        const auto shifted = tokens.size() - count;
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            ASSERT_EQ(tokens.offset(shifted + i), offsets[i] + delta);
+            ASSERT_EQ(tokens.value(shifted + i).data(), values[i]);
+        }
+    };
+
+    // Edits move back and forth, the gap is large enough for insertions
+    edit(input.find("x10000 "), 6, "z");
+    edit(expected.find("x9000 "), 5, "y");
+    edit(expected.find("= 12000;") + 7, 0, " * 2");
+    edit(expected.find("x11000 ") + 7, 2, "==");
+
+    // String literal continues after the scanned window
+    edit(expected.find("\"sss") + 1, 0, "t");
+
+    Source expectedSource(expected);
+    Tokenizer expectedTokenizer(expectedSource);
+    auto expectedTokens = expectedTokenizer.tokenizeAll();
+
+    EXPECT_EQ(source.source(), expected);
+    ASSERT_EQ(tokens.size(), expectedTokens.size());
+
+    for (std::size_t i = 0; i < tokens.size(); ++i)
+    {
+        ASSERT_EQ(tokens.type(i), expectedTokens.type(i));
+        ASSERT_EQ(tokens.offset(i), expectedTokens.offset(i));
+        ASSERT_EQ(tokens.value(i), expectedTokens.value(i));
     }
 }
 
 /* ************************************************************************* */
+
+TEST(Tokenizer, retokenizeError)
+{
+    const String input = "var a = 'b';\nvar c = 5;\n";
+
+    Source source(input);
+    Tokenizer tokenizer(source);
+    auto tokens = tokenizer.tokenizeAll();
+    const auto size = tokens.size();
+
+    // Empty character literal
+    EXPECT_THROW(retokenize(tokens, source, 9, 1, ""), TokenizerError);
+
+    EXPECT_EQ(source.source(), input);
+    ASSERT_EQ(source.lines().size(), Source(input).lines().size());
+    EXPECT_EQ(source.lines().lineStart(1), 13);
+    ASSERT_EQ(tokens.size(), size);
+    EXPECT_EQ(tokens.type(3), TokenType::CharLiteral);
+    EXPECT_EQ(tokens.offset(3), 8);
+
+    // Source is usable after failed edit
+    retokenize(tokens, source, 9, 1, "d");
+
+    EXPECT_EQ(source.source(), "var a = 'd';\nvar c = 5;\n");
+    EXPECT_EQ(tokens.size(), size);
+}
+
+/* ************************************************************************* */
@@ -15,15 +15,14 @@
 /* ************************************************************************* */
 
 // C++
-#include <algorithm>
-#include <fstream>
-#include <ios>
 #include <iostream>
-#include <iterator>
+#include <stdexcept>
 
 // Shard
 #include "shard/Exception.hpp"
+#include "shard/ast/exceptions.hpp"
 #include "shard/builtin/Parser.hpp"
+#include "shard/exceptions.hpp"
 #include "shard/tokenizer/Source.hpp"
 #include "shard/tokenizer/Tokenizer.hpp"
 
@@ -64,30 +63,39 @@ int main(int argc, char** argv)
 
     try
     {
-        std::ifstream file(argv[1]);
+        auto source = tokenizer::Source::fromFile(argv[1]);
 
-        if (!file.is_open())
+        if (!source)
             return printError("unable to open file");
 
-        auto code = std::string{std::istreambuf_iterator<char>{file},
-                                std::istreambuf_iterator<char>{}};
-
-        auto source    = tokenizer::Source{code};
-        auto tokenizer = tokenizer::Tokenizer{source};
+        auto tokenizer = tokenizer::Tokenizer{*source};
         auto parser    = builtin::Parser{tokenizer};
 
         // Parse source
         auto ast = parser.parseSource();
 
         // Semantic analysis
-        ast.analyse();
-
-        ast.dump(std::cout);
+        try
+        {
+            ast.analyse();
+        }
+        catch (const ast::SemanticError& err)
+        {
+            // AST knows only offsets, resolve location for the report
+            throw LocationError(err.what(), source->location(err.offset()));
+        }
+
+        ast.dump(std::cout, &source->lines());
     }
     catch (const Exception& err)
     {
         return printError(err.what());
     }
+    catch (const std::length_error& err)
+    {
+        // Source too large for 32-bit offsets
+        return printError(err.what());
+    }
 }
 
 /* ************************************************************************* */
@@ -16,21 +16,16 @@
 
 // C++
 #include <iostream>
-#include <sstream>
-#include <fstream>
-#include <algorithm>
-#include <iterator>
-#include <ios>
+#include <stdexcept>
 
 // Shard
-#include "shard/FilePath.hpp"
-#include "shard/String.hpp"
-#include "shard/StringView.hpp"
 #include "shard/Exception.hpp"
-#include "shard/ast/Source.hpp"
-#include "shard/parser/Parser.hpp"
-#include "shard/ir/Module.hpp"
+#include "shard/Optional.hpp"
+#include "shard/driver/Cache.hpp"
+#include "shard/driver/compile.hpp"
 #include "shard/interpreter/Interpreter.hpp"
+#include "shard/ir/Module.hpp"
+#include "shard/tokenizer/Source.hpp"
 
 /* ************************************************************************* */
 
@@ -42,124 +37,63 @@ namespace {
 
 /* ************************************************************************* */
 
-/**
- * @brief      Creates an AST.
- *
- * @param      filename  The filename.
- *
- * @return     AST.
- */
-#if 0
-ast::Source createAst(StringView filename)
-{
-    String input;
-    input.reserve(4096);
-
-    if (filename == "-")
-    {
-        // Copy standard input to string
-        std::copy(
-            std::istream_iterator<char>(std::cin >> std::noskipws),
-            std::istream_iterator<char>(),
-            std::back_inserter(input)
-        );
-    }
-    else
-    {
-        std::ifstream file{String(filename)};
-
-        if (!file.is_open())
-            throw std::runtime_error("file not found: " + String(filename));
-
-        std::copy(
-            std::istream_iterator<char>(file >> std::noskipws),
-            std::istream_iterator<char>(),
-            std::back_inserter(input)
-        );
-
-    }
-
-    tokenizer::Source source("");
-    tokenizer::Tokenizer tokenizer(source);
-    parser::Parser parser(tokenizer);
-
-    return parser.parseSource();
-}
-#endif
-
-/* ************************************************************************* */
-
-ir::Module createModule()
+int printError(const char* msg) noexcept
 {
-    ir::Module module;
-
-    auto const1 = module.createConstant<ir::ConstInt32>(5);
-    auto const2 = module.createConstant<ir::ConstInt32>(3);
-
-    {
-        auto main = module.createFunction("main", {});
-        auto block = main->createBlock();
-
-        auto add = block->createInstruction<ir::InstructionCall>("add", ir::TypeInt32::instance(), Vector<ViewPtr<ir::Value>>{const1, const2});
-
-        auto print = block->createInstruction<ir::InstructionCall>("print", Vector<ViewPtr<ir::Value>>{add->result()});
-
-        block->createInstruction<ir::InstructionReturnVoid>();
-    }
-
-    {
-        auto add = module.createFunction("add", ir::TypeInt32::instance(), Vector<ViewPtr<ir::Type>>{ir::TypeInt32::instance(), ir::TypeInt32::instance()});
-
-        auto block = add->createBlock();
-
-        // Result variable
-        auto result = block->createInstruction<ir::InstructionAdd>(
-            ir::TypeInt32::instance(), add->arg(0), add->arg(1));
-
-        // Return result
-        block->createInstruction<ir::InstructionReturn>(
-            ir::TypeInt32::instance(), result->result());
-    }
-
-    return module;
+    std::cerr << "\033[31mERROR\033[0m: " << msg << std::endl;
+    return -1;
 }
 
 /* ************************************************************************* */
 
-}
+} // namespace
 
 /* ************************************************************************* */
 
 /**
- * @brief Entry function.
- * @param argc
- * @param argv
- * @return
+ * @brief      Entry function.
+ *
+ * @param      argc  Number of argument.
+ * @param      argv  Arguments.
+ *
+ * @return     Result code.
  */
 int main(int argc, char** argv)
 {
-    /*
-    if (argc < 2)
+    Optional<driver::Cache> cache;
+    int arg = 1;
+
+    // Compiled modules are reused from cache directory
+    if (arg + 1 < argc && String(argv[arg]) == "--cache")
     {
-        std::cerr << "no input file" << std::endl;
-        return -1;
+        cache.emplace(argv[arg + 1]);
+        arg += 2;
     }
-    */
+
+    if (arg >= argc)
+        return printError("no input file");
 
     try
     {
-        //auto ast = createAst(argv[1]);
-        auto module = createModule();
-        //interpreter::interpret(makeView(ast));
+        auto source = tokenizer::Source::fromFile(argv[arg]);
+
+        if (!source)
+            return printError("unable to open file");
+
+        auto module =
+            cache ? cache->compile(*source) : driver::compile(*source);
 
         interpreter::Interpreter interp;
         interp.load(module);
         interp.call("main", {});
     }
-    catch (const Exception& e)
+    catch (const Exception& err)
+    {
+        return printError(err.what());
+    }
+    catch (const std::length_error& err)
     {
-        std::cerr << "\033[31mERROR\033[0m: " << e.what() << "" << std::endl;
-        return -1;
+        // Source too large for 32-bit offsets
+        return printError(err.what());
     }
 }
 